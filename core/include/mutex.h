@@ -91,6 +91,29 @@
  *       `MUTEX_LOCK`.
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
+ *
+ * Priority Inheritance
+ * --------------------
+ *
+ * A thread of high priority waiting for a mutex held by a thread of low
+ * priority can be delayed for an unbounded time by threads of medium priority
+ * preempting the holder (priority inversion). With the module
+ * `core_mutex_priority_inheritance` used, the mutex stores its owner. A thread
+ * blocking on the mutex raises the priority of the owner to its own, if that
+ * is higher. Every thread keeps its base priority. On `mutex_unlock()` and
+ * when a waiting thread is cancelled with `mutex_cancel()`, the priority of
+ * the owner is set to the highest of its base priority and the priorities of
+ * the threads still blocked on mutexes it owns, so a thread holding nested
+ * locks keeps the priority it inherited through the outer lock. The waiters
+ * are found by scanning all threads, the mutexes a thread owns are not
+ * tracked. This way, a mutex used as a signal (locked by one thread and
+ * unlocked by another one, e.g. in @ref ztimer_sleep) may be discarded while
+ * still locked.
+ *
+ * @note    Priorities are only inherited by the owner of the mutex a thread
+ *          blocks on. If that owner itself is blocked on a mutex, it is moved
+ *          up in the wait queue of that mutex, but the owner of that mutex is
+ *          not boosted.
  * @{
  *
  * @file
@@ -127,6 +150,15 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    /**
+     * @brief   The current owner of the mutex or `KERNEL_PID_UNDEF`
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     * @internal
+     */
+    kernel_pid_t owner;
+#endif
 } mutex_t;
 
 /**
@@ -141,6 +173,10 @@ typedef struct {
     uint8_t cancelled;  /**< Flag whether the mutex has been cancelled */
 } mutex_cancel_t;
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) && !defined(DOXYGEN)
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF }
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF }
+#else
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
@@ -151,6 +187,7 @@ typedef struct {
  * @brief Static initializer for mutex_t with a locked mutex
  */
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -171,6 +208,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
 }
 
 /**
@@ -232,6 +272,9 @@ static inline int mutex_trylock(mutex_t *mutex)
     if (mutex->queue.next == NULL) {
         mutex->queue.next = MUTEX_LOCKED;
         retval = 1;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = thread_getpid();
+#endif
     }
     irq_restore(irq_state);
     return retval;
@@ -212,6 +212,24 @@ void sched_set_status(thread_t *process, thread_status_t status);
  */
 void sched_switch(uint16_t other_prio);
 
+/**
+ * @brief   Changes the priority of a thread
+ *
+ * A thread on the runqueue is moved to the runqueue of the new priority. If
+ * the change lets another thread preempt the active one, the active thread
+ * yields.
+ *
+ * @warning This API is not intended for out of tree users. It is used by
+ *          `core_mutex_priority_inheritance` to boost the owner of a mutex.
+ *
+ * @pre     @p thread is not `NULL`
+ * @pre     @p priority is lower than @ref SCHED_PRIO_LEVELS
+ *
+ * @param[in,out]   thread      The thread to change the priority of
+ * @param[in]       priority    The new priority of @p thread
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief   Call context switching at thread exit
  */
@@ -33,6 +33,83 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+/**
+ * @brief   Changes the priority of @p thread and keeps the wait queue of the
+ *          mutex it is blocked on, if any, sorted
+ */
+static void _change_priority(thread_t *thread, uint8_t priority)
+{
+    unsigned irq_state = irq_disable();
+
+    if (thread->status == STATUS_MUTEX_BLOCKED) {
+        mutex_t *mutex = thread->mutex_wait;
+        list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry);
+        thread->priority = priority;
+        thread_add_to_list(&mutex->queue, thread);
+    }
+    irq_restore(irq_state);
+    sched_change_priority(thread, priority);
+}
+
+/**
+ * @brief   Raises the priority of the owner of @p mutex to the one of
+ *          @p waiter, if that is higher
+ * @pre     IRQs are disabled
+ */
+static inline void _boost_owner(mutex_t *mutex, thread_t *waiter)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if ((owner != NULL) && (owner->priority > waiter->priority)) {
+        DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): raising priority of "
+              "owner %" PRIkernel_pid " from %u to %u\n", waiter->pid,
+              owner->pid, (unsigned)owner->priority,
+              (unsigned)waiter->priority);
+        _change_priority(owner, waiter->priority);
+    }
+}
+
+/**
+ * @brief   Returns the priority @p owner is entitled to: the highest of its
+ *          base priority and the priorities of the threads blocked on
+ *          mutexes it owns
+ * @pre     IRQs are disabled
+ *
+ * The waiters are found by scanning all threads rather than by keeping a
+ * list of owned mutexes in the owner. A mutex used as a signal, e.g. by
+ * @ref ztimer_sleep, is never unlocked by the thread it was handed to and
+ * may well live on a stack that is gone by now.
+ */
+static uint8_t _owner_priority(const thread_t *owner)
+{
+    uint8_t priority = owner->base_priority;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *waiter = thread_get_unchecked(pid);
+        if ((waiter != NULL) && (waiter->status == STATUS_MUTEX_BLOCKED) &&
+            (((mutex_t *)waiter->mutex_wait)->owner == owner->pid) &&
+            (waiter->priority < priority)) {
+            priority = waiter->priority;
+        }
+    }
+    return priority;
+}
+
+/**
+ * @brief   Gives the previous owner of a mutex the priority it is entitled to
+ * @pre     IRQs are enabled
+ */
+static inline void _restore_priority(thread_t *owner, uint8_t priority)
+{
+    if ((owner != NULL) && (owner->priority != priority)) {
+        DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): restoring priority "
+              "%u\n", owner->pid, (unsigned)priority);
+        _change_priority(owner, priority);
+    }
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -62,6 +139,10 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex,
     else {
         thread_add_to_list(&mutex->queue, me);
     }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    me->mutex_wait = mutex;
+    _boost_owner(mutex, me);
+#endif
 
     irq_restore(irq_state);
     thread_yield_higher();
@@ -77,6 +158,9 @@ void mutex_lock(mutex_t *mutex)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = thread_getpid();
+#endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -105,6 +189,9 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = thread_getpid();
+#endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -133,10 +220,19 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *owner = thread_get(mutex->owner);
+    mutex->owner = KERNEL_PID_UNDEF;
+    uint8_t owner_priority = (owner != NULL) ? _owner_priority(owner) : 0;
+#endif
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        _restore_priority(owner, owner_priority);
+#endif
         return;
     }
 
@@ -151,10 +247,16 @@ void mutex_unlock(mutex_t *mutex)
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
     }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = process->pid;
+#endif
 
     uint16_t process_priority = process->priority;
 
     irq_restore(irqstate);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    _restore_priority(owner, owner_priority);
+#endif
     sched_switch(process_priority);
 }
 
@@ -163,8 +265,19 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): queue.next: %p\n",
           thread_getpid(), (void *)mutex->queue.next);
     unsigned irqstate = irq_disable();
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *owner = NULL;
+    uint8_t owner_priority = 0;
+#endif
 
     if (mutex->queue.next) {
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        owner = thread_get(mutex->owner);
+        mutex->owner = KERNEL_PID_UNDEF;
+        if (owner != NULL) {
+            owner_priority = _owner_priority(owner);
+        }
+#endif
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -178,13 +291,26 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            mutex->owner = process->pid;
+#endif
         }
     }
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): going to sleep.\n",
           thread_getpid());
     sched_set_status(thread_get_active(), STATUS_SLEEPING);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    if (owner == thread_get_active()) {
+        /* not on the runqueue while sleeping, no need to move it */
+        owner->priority = owner_priority;
+        owner = NULL;
+    }
+#endif
     irq_restore(irqstate);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    _restore_priority(owner, owner_priority);
+#endif
     thread_yield_higher();
 }
 
@@ -212,7 +338,15 @@ void mutex_cancel(mutex_cancel_t *mc)
             mutex->queue.next = MUTEX_LOCKED;
         }
         sched_set_status(thread, STATUS_PENDING);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        /* the owner may have inherited the priority of the thread */
+        thread_t *owner = thread_get(mutex->owner);
+        uint8_t owner_priority = (owner != NULL) ? _owner_priority(owner) : 0;
+#endif
         irq_restore(irq_state);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        _restore_priority(owner, owner_priority);
+#endif
         sched_switch(thread->priority);
         return;
     }
@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <inttypes.h>
 
+#include "assert.h"
 #include "sched.h"
 #include "clist.h"
 #include "bitarithm.h"
@@ -33,6 +34,10 @@
 #include "mpu.h"
 #endif
 
+#ifdef MODULE_THREAD_PROFILE
+#include "thread_profile.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -132,6 +137,9 @@ static void _unschedule(thread_t *active_thread)
         sched_cb(active_thread->pid, KERNEL_PID_UNDEF);
     }
 #endif
+#ifdef MODULE_THREAD_PROFILE
+    thread_profile_sched(active_thread->pid, KERNEL_PID_UNDEF);
+#endif
 }
 
 thread_t *__attribute__((used)) sched_run(void)
@@ -176,6 +184,11 @@ thread_t *__attribute__((used)) sched_run(void)
         if (sched_cb && !active_thread) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
         }
+#endif
+#ifdef MODULE_THREAD_PROFILE
+        if (!active_thread) {
+            thread_profile_sched(KERNEL_PID_UNDEF, next_thread->pid);
+        }
 #endif
         DEBUG("sched_run: done, sched_active_thread was not changed.\n");
     }
@@ -192,6 +205,9 @@ thread_t *__attribute__((used)) sched_run(void)
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
         }
 #endif
+#ifdef MODULE_THREAD_PROFILE
+        thread_profile_sched(KERNEL_PID_UNDEF, next_thread->pid);
+#endif
 
 #ifdef PICOLIBC_TLS
         _set_tls(next_thread->tls);
@@ -220,6 +236,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
             clist_rpush(&sched_runqueues[process->priority],
                         &(process->rq_entry));
             _set_runqueue_bit(process);
+#ifdef MODULE_THREAD_PROFILE
+            thread_profile_wakeup(process->pid);
+#endif
         }
     }
     else {
@@ -238,6 +257,43 @@ void sched_set_status(thread_t *process, thread_status_t status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert(thread != NULL);
+    assert(priority < SCHED_PRIO_LEVELS);
+
+    if (thread->priority == priority) {
+        return;
+    }
+
+    unsigned irq_state = irq_disable();
+
+    if (thread_is_active(thread)) {
+        clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+        if (!sched_runqueues[thread->priority].next) {
+            _clear_runqueue_bit(thread);
+        }
+        thread->priority = priority;
+        clist_rpush(&sched_runqueues[priority], &thread->rq_entry);
+        _set_runqueue_bit(thread);
+    }
+    else {
+        thread->priority = priority;
+    }
+
+    irq_restore(irq_state);
+
+    thread_t *active = thread_get_active();
+
+    /* yield if the active thread was lowered below another one, or a thread
+     * on the runqueue was raised above the active one */
+    if ((active == thread) ||
+        ((active != NULL) && (active->priority > priority) &&
+         thread_is_active(thread))) {
+        thread_yield_higher();
+    }
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = thread_get_active();
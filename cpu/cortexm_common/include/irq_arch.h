@@ -29,6 +29,14 @@
 extern "C" {
 #endif
 
+#ifndef DOXYGEN
+#ifdef MODULE_THREAD_PROFILE_IRQ
+/* hooks of thread_profile.h, which can not be included from here */
+void thread_profile_irq_off(const void *where);
+void thread_profile_irq_on(void);
+#endif
+#endif
+
 /**
  * @brief Disable all maskable interrupts
  */
@@ -37,6 +45,11 @@ static inline __attribute__((always_inline)) unsigned int irq_disable(void)
     uint32_t mask = __get_PRIMASK();
 
     __disable_irq();
+#ifdef MODULE_THREAD_PROFILE_IRQ
+    if (!mask) {
+        thread_profile_irq_off(NULL);
+    }
+#endif
     return mask;
 }
 
@@ -48,6 +61,11 @@ irq_enable(void)
 {
     unsigned result = __get_PRIMASK();
 
+#ifdef MODULE_THREAD_PROFILE_IRQ
+    if (result) {
+        thread_profile_irq_on();
+    }
+#endif
     __enable_irq();
     return result;
 }
@@ -58,6 +76,11 @@ irq_enable(void)
 static inline __attribute__((always_inline)) void irq_restore(
     unsigned int state)
 {
+#ifdef MODULE_THREAD_PROFILE_IRQ
+    if (!state && __get_PRIMASK()) {
+        thread_profile_irq_on();
+    }
+#endif
     __set_PRIMASK(state);
 }
 
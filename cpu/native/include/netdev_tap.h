@@ -44,6 +44,9 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscuous;                 /**< Flag for promiscuous mode */
+    uint8_t vnet_hdr;                   /**< Frames carry a virtio-net header */
+    uint8_t csum_offload;               /**< Enabled checksum offloads, see
+                                             @ref NETOPT_CHECKSUM_OFFLOAD */
 } netdev_tap_t;
 
 /**
@@ -40,6 +40,10 @@
 
 #include "native_internal.h"
 
+#ifdef MODULE_THREAD_PROFILE_IRQ
+#include "thread_profile.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -164,6 +168,12 @@ unsigned irq_disable(void)
     prev_state = native_interrupts_enabled;
     native_interrupts_enabled = 0;
 
+#ifdef MODULE_THREAD_PROFILE_IRQ
+    if (prev_state) {
+        thread_profile_irq_off(__builtin_return_address(0));
+    }
+#endif
+
     DEBUG("irq_disable(): return\n");
     _native_syscall_leave();
 
@@ -193,6 +203,11 @@ unsigned irq_enable(void)
      */
 
     prev_state = native_interrupts_enabled;
+#ifdef MODULE_THREAD_PROFILE_IRQ
+    if (!prev_state) {
+        thread_profile_irq_on();
+    }
+#endif
     native_interrupts_enabled = 1;
 
     if (sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
@@ -46,6 +46,7 @@
 #include <net/if.h>
 #include <linux/if_tun.h>
 #include <linux/if_ether.h>
+#include <linux/virtio_net.h>
 #endif
 
 #include "native_internal.h"
@@ -53,17 +54,28 @@
 #include "async_read.h"
 
 #include "iolist.h"
+#include "kernel_defines.h"
 #include "net/eui64.h"
 #include "net/netdev.h"
 #include "net/netdev/eth.h"
 #include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
+#include "net/ethertype.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
 #include "netdev_tap.h"
 #include "net/netopt.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if (defined(__MACH__) || defined(__FreeBSD__)) /* OSX/FreeBSD */
+#define VNET_HDR_SUPPORTED  (0)
+#else /* Linux */
+/* frames are exchanged with a virtio-net header to offload checksums */
+#define VNET_HDR_SUPPORTED  (1)
+#endif
+
 /* netdev interface */
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
@@ -124,6 +136,11 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             *((bool*)value) = (bool)_get_promiscuous(dev);
             res = sizeof(bool);
             break;
+        case NETOPT_CHECKSUM_OFFLOAD:
+            assert(max_len >= sizeof(netopt_csum_offload_t));
+            *((netopt_csum_offload_t *)value) = ((netdev_tap_t *)dev)->csum_offload;
+            res = sizeof(netopt_csum_offload_t);
+            break;
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -147,6 +164,16 @@ static int _set(netdev_t *dev, netopt_t opt, const void *value, size_t value_len
             _set_promiscuous(dev, ((const bool *)value)[0]);
             res = sizeof(netopt_enable_t);
             break;
+        case NETOPT_CHECKSUM_OFFLOAD:
+            assert(value_len >= sizeof(netopt_csum_offload_t));
+            /* both directions need the virtio-net header */
+            if (((netdev_tap_t *)dev)->vnet_hdr) {
+                ((netdev_tap_t *)dev)->csum_offload =
+                    *((const netopt_csum_offload_t *)value) &
+                    (NETOPT_CSUM_OFFLOAD_TX | NETOPT_CSUM_OFFLOAD_RX);
+            }
+            res = sizeof(netopt_csum_offload_t);
+            break;
         default:
             res = netdev_eth_set(dev, opt, value, value_len);
             break;
@@ -204,10 +231,44 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_in_syscall--;
 }
 
+#if VNET_HDR_SUPPORTED
+static ssize_t _read_frame(netdev_tap_t *dev, void *buf, size_t len,
+                           netdev_eth_rx_info_t *info)
+{
+    if (!dev->vnet_hdr) {
+        return real_read(dev->tap_fd, buf, len);
+    }
+
+    struct virtio_net_hdr vnet;
+    struct iovec iov[] = {
+        { .iov_base = &vnet, .iov_len = sizeof(vnet) },
+        { .iov_base = buf, .iov_len = len },
+    };
+    ssize_t nread = real_readv(dev->tap_fd, iov, ARRAY_SIZE(iov));
+
+    if (nread < (ssize_t)sizeof(vnet)) {
+        return (nread < 0) ? nread : 0;
+    }
+    /* TUN_F_CSUM is not set, so the host completes all checksums before
+     * handing out a frame, but it tells if they were already verified */
+    if ((info != NULL) && (dev->csum_offload & NETOPT_CSUM_OFFLOAD_RX) &&
+        (vnet.flags & VIRTIO_NET_HDR_F_DATA_VALID)) {
+        info->flags |= NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID;
+    }
+    return nread - sizeof(vnet);
+}
+#else
+static ssize_t _read_frame(netdev_tap_t *dev, void *buf, size_t len,
+                           netdev_eth_rx_info_t *info)
+{
+    (void)info;
+    return real_read(dev->tap_fd, buf, len);
+}
+#endif
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = (netdev_tap_t*)netdev;
-    (void)info;
 
     if (!buf) {
         if (len > 0) {
@@ -234,7 +295,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
         return ETHERNET_FRAME_LEN;
     }
 
-    int nread = real_read(dev->tap_fd, buf, len);
+    int nread = _read_frame(dev, buf, len, info);
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
@@ -273,6 +334,166 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     return -1;
 }
 
+#if VNET_HDR_SUPPORTED
+/* copies @p len bytes found at @p offset of the frame in @p iolist */
+static bool _iol_read(const iolist_t *iolist, size_t offset, void *dst,
+                      size_t len)
+{
+    uint8_t *out = dst;
+
+    for (; (iolist != NULL) && (len > 0); iolist = iolist->iol_next) {
+        if (offset >= iolist->iol_len) {
+            offset -= iolist->iol_len;
+            continue;
+        }
+        size_t chunk = iolist->iol_len - offset;
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(out, (uint8_t *)iolist->iol_base + offset, chunk);
+        out += chunk;
+        len -= chunk;
+        offset = 0;
+    }
+    return len == 0;
+}
+
+/* converts @p iolist to @p iov, replacing the two bytes at @p pos of the
+ * frame by @p patch */
+static unsigned _to_iovec_patched(const iolist_t *iolist, struct iovec *iov,
+                                  size_t pos, uint8_t *patch)
+{
+    unsigned n = 0;
+    size_t start = 0;
+
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        uint8_t *base = iolist->iol_base;
+        size_t end = start + iolist->iol_len;
+        size_t from = start;
+
+        if ((pos < end) && (pos + 2 > start)) {
+            size_t lo = (pos > start) ? pos : start;
+            size_t hi = (pos + 2 < end) ? pos + 2 : end;
+            if (lo > start) {
+                iov[n].iov_base = base;
+                iov[n++].iov_len = lo - start;
+            }
+            iov[n].iov_base = patch + (lo - pos);
+            iov[n++].iov_len = hi - lo;
+            from = hi;
+        }
+        if (end > from) {
+            iov[n].iov_base = base + (from - start);
+            iov[n++].iov_len = end - from;
+        }
+        start = end;
+    }
+    return n;
+}
+
+/* Locates the upper layer checksum field of an IPv6 frame and, if it is
+ * zero, lets the host compute the checksum. Returns the number of iovecs
+ * used for the frame. */
+static unsigned _offload_csum(const iolist_t *iolist, struct iovec *iov,
+                              struct virtio_net_hdr *vnet,
+                              network_uint16_t *pseudo_sum)
+{
+    network_uint16_t ethertype, csum;
+    ipv6_hdr_t ipv6;
+    size_t l4 = sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t);
+    size_t field;
+    unsigned n;
+
+    if (!_iol_read(iolist, offsetof(ethernet_hdr_t, type), &ethertype,
+                   sizeof(ethertype)) ||
+        (byteorder_ntohs(ethertype) != ETHERTYPE_IPV6) ||
+        !_iol_read(iolist, sizeof(ethernet_hdr_t), &ipv6, sizeof(ipv6))) {
+        goto no_offload;
+    }
+
+    size_t end = l4 + byteorder_ntohs(ipv6.len);
+    uint8_t nh = ipv6.nh;
+
+    /* fragmented packets carry complete checksums */
+    while ((nh == PROTNUM_IPV6_EXT_HOPOPT) || (nh == PROTNUM_IPV6_EXT_RH) ||
+           (nh == PROTNUM_IPV6_EXT_DST)) {
+        uint8_t ext[2];
+        if (!_iol_read(iolist, l4, ext, sizeof(ext))) {
+            goto no_offload;
+        }
+        nh = ext[0];
+        l4 += (ext[1] + 1) * 8;
+    }
+    switch (nh) {
+        case PROTNUM_UDP:
+            field = 6;
+            break;
+        case PROTNUM_TCP:
+            field = 16;
+            break;
+        case PROTNUM_ICMPV6:
+            field = 2;
+            break;
+        default:
+            goto no_offload;
+    }
+    if ((l4 + field + sizeof(csum) > end) ||
+        !_iol_read(iolist, l4 + field, &csum, sizeof(csum)) ||
+        (csum.u16 != 0)) {
+        /* e.g. forwarded packets already have a checksum */
+        goto no_offload;
+    }
+
+    /* the host adds up the upper layer header and payload, with the sum of
+     * the pseudo header in place of the checksum field */
+    *pseudo_sum = byteorder_htons(ipv6_hdr_inet_csum(0, &ipv6, nh, end - l4));
+    n = _to_iovec_patched(iolist, iov, l4 + field, (uint8_t *)pseudo_sum);
+    vnet->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+    vnet->csum_start = l4;
+    vnet->csum_offset = field;
+    return n;
+
+no_offload:
+    iolist_to_iovec(iolist, iov, &n);
+    return n;
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+
+    /* room for the virtio-net header and for patching the checksum field */
+    struct iovec iov[iolist_count(iolist) + 3];
+    struct virtio_net_hdr vnet = { .gso_type = VIRTIO_NET_HDR_GSO_NONE };
+    network_uint16_t pseudo_sum;
+    unsigned n;
+    int res;
+
+    if (dev->vnet_hdr) {
+        iov[0].iov_base = &vnet;
+        iov[0].iov_len = sizeof(vnet);
+        if (dev->csum_offload & NETOPT_CSUM_OFFLOAD_TX) {
+            n = _offload_csum(iolist, &iov[1], &vnet, &pseudo_sum);
+        }
+        else {
+            iolist_to_iovec(iolist, &iov[1], &n);
+        }
+        res = _native_writev(dev->tap_fd, iov, n + 1);
+        if (res > 0) {
+            res -= sizeof(vnet);
+        }
+    }
+    else {
+        iolist_to_iovec(iolist, iov, &n);
+        res = _native_writev(dev->tap_fd, iov, n);
+    }
+
+    if (netdev->event_callback) {
+        netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
+    }
+    return res;
+}
+#else
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     netdev_tap_t *dev = (netdev_tap_t*)netdev;
@@ -289,6 +510,7 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     }
     return res;
 }
+#endif
 
 void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params) {
     dev->netdev.driver = &netdev_driver_tap;
@@ -333,6 +555,8 @@ static int _init(netdev_t *netdev)
 #endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+    dev->vnet_hdr = 0;
+    dev->csum_offload = NETOPT_CSUM_OFFLOAD_NONE;
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
@@ -353,7 +577,18 @@ static int _init(netdev_t *netdev)
     memset(&ifr, 0, sizeof(ifr));
     ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
     strncpy(ifr.ifr_name, name, IFNAMSIZ);
-    if (real_ioctl(dev->tap_fd, TUNSETIFF, (void *)&ifr) == -1) {
+    /* the virtio-net header is only needed to offload checksums */
+    if (IS_USED(MODULE_GNRC_NETIF_CSUM_OFFLOAD)) {
+        ifr.ifr_flags |= IFF_VNET_HDR;
+        if (real_ioctl(dev->tap_fd, TUNSETIFF, (void *)&ifr) == 0) {
+            dev->vnet_hdr = 1;
+        }
+        else {
+            /* fall back to plain frames, without checksum offloading */
+            ifr.ifr_flags &= ~IFF_VNET_HDR;
+        }
+    }
+    if (!dev->vnet_hdr && (real_ioctl(dev->tap_fd, TUNSETIFF, (void *)&ifr) == -1)) {
         _native_in_syscall++;
         warn("ioctl TUNSETIFF");
         warnx("probably the tap interface (%s) does not exist or is already in use", name);
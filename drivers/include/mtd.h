@@ -52,6 +52,11 @@ enum mtd_power_state {
  */
 typedef struct mtd_desc mtd_desc_t;
 
+/**
+ * @brief   Asynchronous MTD request, see @ref drivers_mtd_async
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
 /**
  * @brief   MTD device descriptor
  */
@@ -212,6 +217,24 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+#if defined(MODULE_MTD_ASYNC) || DOXYGEN
+    /**
+     * @brief   Start an operation in the background (optional)
+     *
+     * The driver starts the operation described by @p req and returns
+     * without waiting for it to finish. Once done, the driver must call
+     * @ref mtd_async_complete, this may happen from interrupt context.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     * @param[in] req       Request to execute
+     *
+     * @return 0 if the operation was started
+     * @return -ENOTSUP to have the operation executed with the blocking API
+     * @return < 0 value on error
+     */
+    int (*async)(mtd_dev_t *dev, mtd_async_req_t *req);
+#endif
+
     /**
      * @brief   Properties of the MTD driver
      */
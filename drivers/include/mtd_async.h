@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD operations
+ * @ingroup     drivers_storage
+ * @brief       Queued, non-blocking read, write and erase requests on MTD devices
+ *
+ * This module allows a thread to hand a read, write or erase operation over
+ * to an @ref sys_event queue and carry on with other work while the flash
+ * is busy. Requests posted to the same queue are executed one after the other
+ * in the order of submission, so several flash users can share one device
+ * without blocking each other.
+ *
+ * When the request has been processed, its callback is called from the
+ * thread serving the queue with the result stored in @ref mtd_async_req_t::res.
+ *
+ * The thread serving the queue blocks until the flash has finished each
+ * request, for an erase this may take tens of milliseconds. Use a queue
+ * with a thread of its own for the requests. A queue shared with other
+ * users, such as the `EVENT_PRIO_*` queues of `event_thread`, would stall
+ * all their events meanwhile.
+ *
+ * ## Driver support
+ *
+ * Drivers that can run an operation in the background (e.g. using DMA, or by
+ * polling the busy flag of a SPI NOR flash from an interrupt) implement
+ * @ref mtd_desc_t::async. It starts the operation and returns 0, and the
+ * driver later reports the result with @ref mtd_async_complete, which may be
+ * called from interrupt context. If a driver does not implement the hook or
+ * returns `-ENOTSUP` for an operation, the request is executed with the
+ * blocking MTD API from the thread serving the queue instead.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * static char flash_stack[THREAD_STACKSIZE_DEFAULT];
+ * static event_queue_t flash_queue;
+ *
+ * static void *_flash_thread(void *arg)
+ * {
+ *     event_queue_init(&flash_queue);
+ *     event_loop(&flash_queue);
+ *     return NULL;
+ * }
+ *
+ * static void _done(mtd_async_req_t *req, void *arg)
+ * {
+ *     printf("write finished: %d\n", req->res);
+ * }
+ *
+ * [...]
+ * thread_create(flash_stack, sizeof(flash_stack), THREAD_PRIORITY_MAIN - 1,
+ *               THREAD_CREATE_STACKTEST, _flash_thread, NULL, "flash");
+ *
+ * static mtd_async_req_t req;
+ * mtd_async_write_page(&req, MTD_0, buf, page, 0, sizeof(buf), _done, NULL);
+ * mtd_async_submit(&flash_queue, &req);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for asynchronous MTD operations
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+#include <stdint.h>
+
+#include "event.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Operations that can be queued
+ */
+typedef enum {
+    MTD_ASYNC_OP_READ,          /**< @ref mtd_read_page */
+    MTD_ASYNC_OP_WRITE,         /**< @ref mtd_write_page_raw */
+    MTD_ASYNC_OP_ERASE,         /**< @ref mtd_erase_sector */
+} mtd_async_op_t;
+
+/**
+ * @brief   Completion callback
+ *
+ * @param[in] req   The finished request, its result is in `req->res`
+ * @param[in] arg   Argument given when the request was set up
+ */
+typedef void (*mtd_async_cb_t)(mtd_async_req_t *req, void *arg);
+
+/**
+ * @brief   An asynchronous MTD request
+ *
+ * The request must not be modified or reused between submission and the
+ * call of its callback.
+ */
+struct mtd_async_req {
+    event_t event;              /**< Queue entry */
+    mtd_dev_t *mtd;             /**< Device to operate on */
+    mtd_async_cb_t cb;          /**< Completion callback, may be NULL */
+    void *arg;                  /**< Argument passed to @p cb */
+    void *buf;                  /**< Data buffer, unused for erase */
+    uint32_t page;              /**< First page, or first sector for erase */
+    uint32_t offset;            /**< Byte offset from the start of @p page */
+    uint32_t size;              /**< Number of bytes, or sectors for erase */
+    mtd_async_op_t op;          /**< Operation to perform */
+    int res;                    /**< Result of the operation */
+    mutex_t *done;              /**< Internal, signals driver completion */
+};
+
+/**
+ * @brief   Set up a request reading from a MTD device
+ *
+ * See @ref mtd_read_page for the parameters.
+ *
+ * @param[out] req      Request to set up
+ * @param[in]  mtd      The device to read from
+ * @param[out] dest     The buffer to fill in, must stay valid until @p cb
+ * @param[in]  page     Page number to start reading from
+ * @param[in]  offset   Offset from the start of the page (in bytes)
+ * @param[in]  size     The number of bytes to read
+ * @param[in]  cb       Completion callback, may be NULL
+ * @param[in]  arg      Argument passed to @p cb
+ */
+void mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                         uint32_t page, uint32_t offset, uint32_t size,
+                         mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Set up a request writing to a MTD device
+ *
+ * See @ref mtd_write_page_raw for the parameters. No read-modify-write cycle
+ * is performed, the target area must have been erased before.
+ *
+ * @param[out] req      Request to set up
+ * @param[in]  mtd      The device to write to
+ * @param[in]  src      The buffer to write, must stay valid until @p cb
+ * @param[in]  page     Page number to start writing to
+ * @param[in]  offset   Byte offset from the start of the page
+ * @param[in]  size     The number of bytes to write
+ * @param[in]  cb       Completion callback, may be NULL
+ * @param[in]  arg      Argument passed to @p cb
+ */
+void mtd_async_write_page(mtd_async_req_t *req, mtd_dev_t *mtd, const void *src,
+                          uint32_t page, uint32_t offset, uint32_t size,
+                          mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Set up a request erasing sectors of a MTD device
+ *
+ * @param[out] req      Request to set up
+ * @param[in]  mtd      The device to erase
+ * @param[in]  sector   The first sector number to erase
+ * @param[in]  num      The number of sectors to erase
+ * @param[in]  cb       Completion callback, may be NULL
+ * @param[in]  arg      Argument passed to @p cb
+ */
+void mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                            uint32_t sector, uint32_t num,
+                            mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a request for execution
+ *
+ * Returns immediately. The request is executed by the thread serving
+ * @p queue, which also calls the completion callback.
+ *
+ * @param[in] queue     Event queue executing the request, should be served
+ *                      by a thread of its own
+ * @param[in] req       Request set up with one of the `mtd_async_*` helpers
+ */
+void mtd_async_submit(event_queue_t *queue, mtd_async_req_t *req);
+
+/**
+ * @brief   Report the result of an operation started with
+ *          @ref mtd_desc_t::async
+ *
+ * For use by MTD drivers only, may be called from interrupt context.
+ *
+ * @param[in] req       The request that finished
+ * @param[in] res       0 on success, negative errno on failure
+ */
+void mtd_async_complete(mtd_async_req_t *req, int res);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_ASYNC_H */
+/** @} */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD sector write-back cache
+ * @ingroup     drivers_storage
+ * @brief       Stackable MTD device caching whole sectors of another MTD in RAM
+ *
+ * This MTD module sits on top of another MTD device and keeps a small number
+ * of sectors in RAM. Erases and writes to a cached sector only modify the RAM
+ * copy, so a file system issuing many small writes to the same sector causes
+ * a single erase and one write per modified page when the sector is written
+ * back. Repeated erases of a cached sector are merged into one.
+ *
+ * Sectors are allocated on write or erase. When no free slot is left, the
+ * least recently used sector is written back to make room. Reads of sectors
+ * that are not cached are passed through to the backing device without
+ * allocating a slot. Dirty sectors are also written back by
+ * @ref mtd_cache_flush and when the device is powered down.
+ *
+ * @warning Data that is only in the cache is lost on reset or power loss.
+ *          Call @ref mtd_cache_flush at consistency points of the user.
+ *
+ * @note    Unless a pending erase is written back, dirty pages are programmed
+ *          again as a whole, including bytes that were programmed before. The
+ *          backing device must tolerate this, which is the case for NOR flash
+ *          and block devices such as SD cards.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * ```
+ * static uint8_t cache_buf[2 * SECTOR_SIZE];
+ * static mtd_cache_line_t cache_lines[2];
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0, cache_lines, cache_buf, 2);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry of the cached device is taken from the backing device by
+ * @ref mtd_init.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD sector cache
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sector number of an unused cache slot
+ */
+#define MTD_CACHE_SECTOR_NONE   (UINT32_MAX)
+
+/**
+ * @brief   Shortcut macro for initializing an @ref mtd_cache_t
+ *
+ * @param[in] _parent   backing MTD device
+ * @param[in] _lines    array of @p _numof @ref mtd_cache_line_t
+ * @param[in] _buf      buffer of @p _numof times the sector size
+ * @param[in] _numof    number of sectors to cache
+ */
+#define MTD_CACHE_INIT(_parent, _lines, _buf, _numof) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .lines = _lines, \
+    .buf = _buf, \
+    .lines_numof = _numof, \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   State of one cached sector
+ */
+typedef struct {
+    uint32_t sector;        /**< cached sector, or @ref MTD_CACHE_SECTOR_NONE */
+    uint32_t last_use;      /**< LRU time stamp */
+    uint32_t dirty_pages;   /**< pages to write back, bit 31 covers the rest */
+    bool erase;             /**< sector must be erased before write back */
+} mtd_cache_line_t;
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< accesses served from RAM */
+    uint32_t misses;        /**< accesses that went to the backing device */
+    uint32_t flushes;       /**< sectors written back */
+    uint32_t erases;        /**< erases issued to the backing device */
+    uint32_t erases_avoided;    /**< erases merged into a pending one */
+    uint32_t writes_merged;     /**< page writes merged into a dirty page */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   MTD sector cache
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mtd_cache_line_t *lines;    /**< cache slots */
+    uint8_t *buf;               /**< sector data, one sector per slot */
+    uint8_t lines_numof;        /**< number of cache slots */
+    mutex_t lock;               /**< guards the cache and the backing device */
+    uint32_t clock;             /**< LRU clock */
+    mtd_cache_stats_t stats;    /**< cache statistics */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Write all dirty sectors back to the backing device
+ *
+ * @param[in] cache     cache to flush
+ *
+ * @return 0 on success
+ * @return < 0 value on error
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_ftl  MTD wear-leveling flash translation layer
+ * @ingroup     drivers_storage
+ * @brief       Log-structured, wear-leveling MTD device on top of raw flash
+ *
+ * This MTD module presents a logical MTD device that can be written like a
+ * block device, i.e. pages can be rewritten without erasing the sector first,
+ * and spreads the erase cycles over all sectors of the backing flash.
+ *
+ * ## Operation
+ *
+ * Logical pages are never written in place. Every write appends a full page
+ * to the currently open physical sector and updates a page map held in RAM.
+ * Erasing a logical sector only marks its pages as trimmed. The first page of
+ * every physical sector holds a header with a sequence number, the erase
+ * counter of the sector and one entry per data page naming the logical page
+ * stored there. On @ref mtd_init these headers are scanned in sequence order
+ * to rebuild the page map.
+ *
+ * ## Power loss
+ *
+ * A page is committed by its entry, which is programmed after the page data,
+ * and a header by its magic, which is programmed after the rest of the
+ * header. Each entry carries the number of zero bits it holds, so an entry
+ * torn by a reset during programming or erasing is detected and ignored
+ * rather than read as a different logical page. After a reset, a write that
+ * was in progress is either complete or lost, all earlier writes are kept.
+ * This relies on the flash only ever programming bits from 1 to 0.
+ *
+ * When the number of free sectors drops below a threshold, the garbage
+ * collector picks the sector with the fewest valid pages, moves these pages
+ * to the open sector and erases it. If the erase counters of the sectors
+ * drift apart by more than @ref CONFIG_MTD_FTL_WEAR_DELTA, the least worn
+ * sector is collected instead, so that sectors holding static data take part
+ * in wear-leveling too. Garbage collection runs on demand when a write needs
+ * space, and can be scheduled ahead of time, e.g. from a low priority thread,
+ * with @ref mtd_ftl_gc.
+ *
+ * The logical device has the same page and sector size as the backing
+ * device. Some of the physical space is used for sector headers and as
+ * spare area, so it has fewer sectors.
+ *
+ * @note    Entries of a sector header are programmed one at a time. The
+ *          backing device must support programming individual 32 bit words
+ *          of a page, which is the case for NOR flash.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_ftl
+ * ```
+ *
+ * ```
+ * static mtd_ftl_sector_t sectors[PHYS_SECTORS];
+ * static uint32_t map[MTD_FTL_MAP_SIZE(PHYS_SECTORS, PAGES_PER_SECTOR)];
+ * static uint8_t buf[2 * PAGE_SIZE];
+ * static mtd_ftl_t ftl = MTD_FTL_INIT(MTD_0, sectors, map, buf);
+ *
+ * mtd_dev_t *dev = &ftl.mtd;
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD flash translation layer
+ */
+
+#ifndef MTD_FTL_H
+#define MTD_FTL_H
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_ftl_config     MTD FTL compile time configuration
+ * @ingroup config
+ * @{
+ */
+#ifndef CONFIG_MTD_FTL_RESERVED_SECTORS
+/**
+ * @brief   Number of physical sectors kept as spare area
+ *
+ * At least two are needed: one to move valid pages into during garbage
+ * collection and one to account for the sector header pages.
+ */
+#define CONFIG_MTD_FTL_RESERVED_SECTORS     (2)
+#endif
+
+#ifndef CONFIG_MTD_FTL_GC_FREE_TARGET
+/**
+ * @brief   Number of free sectors @ref mtd_ftl_gc tries to keep available
+ */
+#define CONFIG_MTD_FTL_GC_FREE_TARGET       (2)
+#endif
+
+#ifndef CONFIG_MTD_FTL_WEAR_DELTA
+/**
+ * @brief   Maximum difference of erase counters before static wear-leveling
+ *          moves the data of the least worn sector
+ */
+#define CONFIG_MTD_FTL_WEAR_DELTA           (16)
+#endif
+/** @} */
+
+/**
+ * @brief   Size of the page map needed for a backing device of
+ *          @p sectors sectors with @p pages_per_sector pages each
+ */
+#define MTD_FTL_MAP_SIZE(sectors, pages_per_sector) \
+    (((sectors) - CONFIG_MTD_FTL_RESERVED_SECTORS) * ((pages_per_sector) - 1))
+
+/**
+ * @brief   Shortcut macro for initializing an @ref mtd_ftl_t
+ *
+ * @param[in] _parent   backing MTD device
+ * @param[in] _sectors  array of @ref mtd_ftl_sector_t, one per backing sector
+ * @param[in] _map      page map array, see @ref MTD_FTL_MAP_SIZE
+ * @param[in] _buf      buffer of two pages
+ */
+#define MTD_FTL_INIT(_parent, _sectors, _map, _buf) \
+{ \
+    .mtd = { .driver = &mtd_ftl_driver }, \
+    .parent = _parent, \
+    .sectors = _sectors, \
+    .map = _map, \
+    .map_size = ARRAY_SIZE(_map), \
+    .buf = _buf, \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   RAM state of a physical sector
+ */
+typedef struct {
+    uint32_t erase_count;       /**< number of times the sector was erased */
+    uint32_t seq;               /**< sequence number, 0 if free */
+    uint16_t valid;             /**< number of live entries */
+    uint16_t used;              /**< number of entries written */
+    uint8_t flags;              /**< internal flags */
+} mtd_ftl_sector_t;
+
+/**
+ * @brief   FTL statistics
+ */
+typedef struct {
+    uint32_t host_writes;       /**< pages written by the user */
+    uint32_t flash_writes;      /**< pages written to the backing device */
+    uint32_t relocations;       /**< pages moved by the garbage collector */
+    uint32_t gc_runs;           /**< sectors collected */
+    uint32_t erases;            /**< sectors erased */
+} mtd_ftl_stats_t;
+
+/**
+ * @brief   MTD flash translation layer
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mtd_ftl_sector_t *sectors;  /**< state of every backing sector */
+    uint32_t *map;              /**< physical location of every logical page */
+    uint32_t map_size;          /**< number of entries in @p map */
+    uint8_t *buf;               /**< scratch buffer of two pages */
+    mutex_t lock;               /**< guards all of the above */
+    uint32_t seq;               /**< next sequence number */
+    uint32_t active;            /**< sector currently written to */
+    uint32_t free_sectors;      /**< number of free sectors */
+    mtd_ftl_stats_t stats;      /**< FTL statistics */
+} mtd_ftl_t;
+
+/**
+ * @brief   FTL MTD device operations table
+ */
+extern const mtd_desc_t mtd_ftl_driver;
+
+/**
+ * @brief   Collect garbage ahead of time
+ *
+ * Collects up to @p budget sectors as long as fewer than
+ * @ref CONFIG_MTD_FTL_GC_FREE_TARGET sectors are free, or the static
+ * wear-leveling threshold is exceeded. Intended to be called when the system
+ * is idle, so that later writes do not have to wait for an erase.
+ *
+ * @param[in] ftl       FTL device
+ * @param[in] budget    maximum number of sectors to collect
+ *
+ * @return number of sectors collected
+ * @return < 0 value on error
+ */
+int mtd_ftl_gc(mtd_ftl_t *ftl, unsigned budget);
+
+/**
+ * @brief   Get a histogram of the erase counters of all backing sectors
+ *
+ * The range between the lowest and the highest erase counter is split into
+ * @p numof equally wide bins.
+ *
+ * @param[in]  ftl      FTL device
+ * @param[out] hist     sector count per bin
+ * @param[in]  numof    number of bins
+ * @param[out] min      lowest erase counter, may be NULL
+ * @param[out] max      highest erase counter, may be NULL
+ */
+void mtd_ftl_erase_histogram(mtd_ftl_t *ftl, uint32_t *hist, unsigned numof,
+                             uint32_t *min, uint32_t *max);
+
+/**
+ * @brief   Get the write amplification in percent
+ *
+ * @param[in] ftl       FTL device
+ *
+ * @return pages written to flash per 100 pages written by the user
+ */
+uint32_t mtd_ftl_write_amplification(const mtd_ftl_t *ftl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_FTL_H */
+/** @} */
@@ -34,6 +34,8 @@ extern "C" {
  * @{
  */
 #define NETDEV_ETH_RX_INFO_FLAG_TIMESTAMP       (0x01)  /**< Timestamp valid */
+#define NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID      (0x02)  /**< Upper layer
+                                                         *   checksum verified */
 /** @} */
 
 /**
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD request queue
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static int _run_sync(mtd_async_req_t *req)
+{
+    switch (req->op) {
+    case MTD_ASYNC_OP_READ:
+        return mtd_read_page(req->mtd, req->buf, req->page, req->offset,
+                             req->size);
+    case MTD_ASYNC_OP_WRITE:
+        return mtd_write_page_raw(req->mtd, req->buf, req->page, req->offset,
+                                  req->size);
+    case MTD_ASYNC_OP_ERASE:
+        return mtd_erase_sector(req->mtd, req->page, req->size);
+    }
+    return -EINVAL;
+}
+
+static void _run(event_t *event)
+{
+    mtd_async_req_t *req = container_of(event, mtd_async_req_t, event);
+    int res = -ENOTSUP;
+
+    if (!req->mtd || !req->mtd->driver) {
+        res = -ENODEV;
+    }
+    else if (req->mtd->driver->async) {
+        /* requests on a queue never overlap, so wait for the driver before
+         * picking up the next one */
+        mutex_t done = MUTEX_INIT_LOCKED;
+        req->done = &done;
+        res = req->mtd->driver->async(req->mtd, req);
+        if (res == 0) {
+            mutex_lock(&done);
+            res = req->res;
+        }
+        req->done = NULL;
+    }
+
+    if (res == -ENOTSUP) {
+        DEBUG("mtd_async: falling back to blocking op %u\n", (unsigned)req->op);
+        res = _run_sync(req);
+    }
+
+    req->res = res;
+    if (req->cb) {
+        req->cb(req, req->arg);
+    }
+}
+
+static void _setup(mtd_async_req_t *req, mtd_dev_t *mtd, mtd_async_op_t op,
+                   void *buf, uint32_t page, uint32_t offset, uint32_t size,
+                   mtd_async_cb_t cb, void *arg)
+{
+    req->event.handler = _run;
+    req->mtd = mtd;
+    req->cb = cb;
+    req->arg = arg;
+    req->buf = buf;
+    req->page = page;
+    req->offset = offset;
+    req->size = size;
+    req->op = op;
+    req->res = -EINPROGRESS;
+    req->done = NULL;
+}
+
+void mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                         uint32_t page, uint32_t offset, uint32_t size,
+                         mtd_async_cb_t cb, void *arg)
+{
+    _setup(req, mtd, MTD_ASYNC_OP_READ, dest, page, offset, size, cb, arg);
+}
+
+void mtd_async_write_page(mtd_async_req_t *req, mtd_dev_t *mtd, const void *src,
+                          uint32_t page, uint32_t offset, uint32_t size,
+                          mtd_async_cb_t cb, void *arg)
+{
+    _setup(req, mtd, MTD_ASYNC_OP_WRITE, (void *)src, page, offset, size, cb, arg);
+}
+
+void mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                            uint32_t sector, uint32_t num,
+                            mtd_async_cb_t cb, void *arg)
+{
+    _setup(req, mtd, MTD_ASYNC_OP_ERASE, NULL, sector, 0, num, cb, arg);
+}
+
+void mtd_async_submit(event_queue_t *queue, mtd_async_req_t *req)
+{
+    req->res = -EINPROGRESS;
+    event_post(queue, &req->event);
+}
+
+void mtd_async_complete(mtd_async_req_t *req, int res)
+{
+    req->res = res;
+    mutex_unlock(req->done);
+}
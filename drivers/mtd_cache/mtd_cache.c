@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD sector write-back cache
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* all pages from this one on share the last bit of the dirty mask */
+#define DIRTY_BITS  (32U)
+
+#define MIN(x, y)   (((x) < (y)) ? (x) : (y))
+
+static uint32_t _sector_size(const mtd_dev_t *mtd)
+{
+    return mtd->page_size * mtd->pages_per_sector;
+}
+
+static uint32_t _page_bit(uint32_t page)
+{
+    return 1UL << ((page < DIRTY_BITS) ? page : DIRTY_BITS - 1);
+}
+
+static uint8_t *_line_data(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    return cache->buf + (line - cache->lines) * _sector_size(&cache->mtd);
+}
+
+static mtd_cache_line_t *_lookup(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        if (cache->lines[i].sector == sector) {
+            cache->lines[i].last_use = ++cache->clock;
+            return &cache->lines[i];
+        }
+    }
+    return NULL;
+}
+
+static int _write_back(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (!line->erase && !line->dirty_pages) {
+        return 0;
+    }
+
+    mtd_dev_t *mtd = &cache->mtd;
+    uint8_t *data = _line_data(cache, line);
+    uint32_t first_page = line->sector * mtd->pages_per_sector;
+    int res;
+
+    DEBUG("mtd_cache: write back sector %" PRIu32 " (erase=%u, dirty=0x%" PRIx32 ")\n",
+          line->sector, line->erase, line->dirty_pages);
+
+    if (line->erase) {
+        res = mtd_erase_sector(cache->parent, line->sector, 1);
+        if (res < 0) {
+            return res;
+        }
+        cache->stats.erases++;
+        line->erase = false;
+    }
+
+    for (uint32_t page = 0; page < mtd->pages_per_sector; page++) {
+        if (!(line->dirty_pages & _page_bit(page))) {
+            continue;
+        }
+        res = mtd_write_page_raw(cache->parent, data + page * mtd->page_size,
+                                 first_page + page, 0, mtd->page_size);
+        if (res < 0) {
+            return res;
+        }
+    }
+    line->dirty_pages = 0;
+    cache->stats.flushes++;
+    return 0;
+}
+
+/* get a slot for @p sector, evicting the least recently used one */
+static int _allocate(mtd_cache_t *cache, uint32_t sector, bool load,
+                     mtd_cache_line_t **out)
+{
+    mtd_cache_line_t *line = NULL;
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *cur = &cache->lines[i];
+        if (cur->sector == MTD_CACHE_SECTOR_NONE) {
+            line = cur;
+            break;
+        }
+        if (!line || (cur->last_use < line->last_use)) {
+            line = cur;
+        }
+    }
+
+    int res = _write_back(cache, line);
+    if (res < 0) {
+        return res;
+    }
+    line->sector = MTD_CACHE_SECTOR_NONE;
+
+    if (load) {
+        mtd_dev_t *mtd = &cache->mtd;
+        res = mtd_read_page(cache->parent, _line_data(cache, line),
+                            sector * mtd->pages_per_sector, 0,
+                            _sector_size(mtd));
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    line->sector = sector;
+    line->last_use = ++cache->clock;
+    *out = line;
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    assert(cache->lines_numof > 0);
+
+    int res = mtd_init(cache->parent);
+    if (res < 0) {
+        return res;
+    }
+
+    mtd->sector_count = cache->parent->sector_count;
+    mtd->pages_per_sector = cache->parent->pages_per_sector;
+    mtd->page_size = cache->parent->page_size;
+
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        cache->lines[i] = (mtd_cache_line_t) { .sector = MTD_CACHE_SECTOR_NONE };
+    }
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t sector = page / mtd->pages_per_sector;
+    uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size
+                           + offset;
+
+    /* stay within the sector, the MTD layer calls again for the rest */
+    count = MIN(count, _sector_size(mtd) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    int res = count;
+    mtd_cache_line_t *line = _lookup(cache, sector);
+    if (line) {
+        cache->stats.hits++;
+        memcpy(dest, _line_data(cache, line) + sector_offset, count);
+    }
+    else {
+        cache->stats.misses++;
+        int err = mtd_read_page(cache->parent, dest, page, offset, count);
+        if (err < 0) {
+            res = err;
+        }
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t sector = page / mtd->pages_per_sector;
+    uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size
+                           + offset;
+
+    count = MIN(count, _sector_size(mtd) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    mtd_cache_line_t *line = _lookup(cache, sector);
+    if (line) {
+        cache->stats.hits++;
+    }
+    else {
+        cache->stats.misses++;
+        int res = _allocate(cache, sector, true, &line);
+        if (res < 0) {
+            mutex_unlock(&cache->lock);
+            return res;
+        }
+    }
+
+    uint8_t *data = _line_data(cache, line) + sector_offset;
+    const uint8_t *in = src;
+    if (cache->parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE) {
+        memcpy(data, in, count);
+    }
+    else {
+        /* programming flash can only clear bits */
+        for (uint32_t i = 0; i < count; i++) {
+            data[i] &= in[i];
+        }
+    }
+
+    uint32_t first = sector_offset / mtd->page_size;
+    uint32_t last = (sector_offset + count - 1) / mtd->page_size;
+    for (uint32_t p = first; p <= last; p++) {
+        if (line->dirty_pages & _page_bit(p)) {
+            cache->stats.writes_merged++;
+        }
+        line->dirty_pages |= _page_bit(p);
+    }
+    mutex_unlock(&cache->lock);
+    return count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    if (sector + count > mtd->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    for (; count > 0; sector++, count--) {
+        mtd_cache_line_t *line = _lookup(cache, sector);
+        if (line) {
+            cache->stats.hits++;
+            if (line->erase) {
+                cache->stats.erases_avoided++;
+            }
+        }
+        else {
+            cache->stats.misses++;
+            /* no need to load data that is about to be erased */
+            res = _allocate(cache, sector, false, &line);
+            if (res < 0) {
+                break;
+            }
+        }
+        memset(_line_data(cache, line), 0xff, _sector_size(mtd));
+        line->erase = true;
+        line->dirty_pages = 0;
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = mtd_cache_flush(cache);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return mtd_power(cache->parent, power);
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        if (cache->lines[i].sector == MTD_CACHE_SECTOR_NONE) {
+            continue;
+        }
+        res = _write_back(cache, &cache->lines[i]);
+        if (res < 0) {
+            break;
+        }
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+};
@@ -0,0 +1,648 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_ftl
+ * @{
+ *
+ * @file
+ * @brief       Log-structured wear-leveling flash translation layer
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_ftl.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define MTD_FTL_MAGIC       (0x46544c31UL)  /**< "FTL1" */
+
+/* sector header: magic, sequence number, erase counter, then one entry per
+ * data page */
+#define HDR_MAGIC           (0U)
+#define HDR_SEQ             (1U)
+#define HDR_ERASE_COUNT     (2U)
+#define HDR_WORDS           (3U)
+#define HDR_SIZE            (HDR_WORDS * sizeof(uint32_t))
+
+/* slot entry: logical page number, trim flag and the number of zero bits
+ * in both. A torn program or erase only flips bits in one direction, so the
+ * count of zeros and the stored count can no longer agree. */
+#define ENTRY_FREE          (UINT32_MAX)    /**< slot not written */
+#define ENTRY_LPN_MASK      (0x00ffffffUL)  /**< logical page number */
+#define ENTRY_TRIM          (0x01000000UL)  /**< logical page was erased */
+#define ENTRY_DATA_MASK     (ENTRY_LPN_MASK | ENTRY_TRIM)
+#define ENTRY_DATA_BITS     (25U)
+#define ENTRY_CHECK_SHIFT   (25U)
+#define ENTRY_CHECK_MASK    (0x1fUL << ENTRY_CHECK_SHIFT)
+#define ENTRY_UNUSED        (0xc0000000UL)  /**< left erased */
+
+#define MAP_CLEAN           (UINT32_MAX)    /**< never written */
+#define MAP_TRIM            (0x80000000UL)  /**< location of a trim entry */
+
+#define SECTOR_NONE         (UINT32_MAX)
+
+#define FLAG_ERASED         (0x01)          /**< sector is known to be erased */
+
+static uint32_t _slots(const mtd_ftl_t *ftl)
+{
+    return ftl->mtd.pages_per_sector - 1;
+}
+
+static uint32_t _phys_page(const mtd_ftl_t *ftl, uint32_t sector, uint32_t slot)
+{
+    return sector * ftl->mtd.pages_per_sector + 1 + slot;
+}
+
+static uint32_t _sector_of(const mtd_ftl_t *ftl, uint32_t loc)
+{
+    return (loc & ~MAP_TRIM) / ftl->mtd.pages_per_sector;
+}
+
+static uint32_t _logical_pages(const mtd_ftl_t *ftl)
+{
+    return ftl->mtd.sector_count * ftl->mtd.pages_per_sector;
+}
+
+static uint8_t *_page_buf(mtd_ftl_t *ftl)
+{
+    return ftl->buf;
+}
+
+static uint8_t *_meta_buf(mtd_ftl_t *ftl)
+{
+    return ftl->buf + ftl->mtd.page_size;
+}
+
+static uint32_t _entry_check(uint32_t entry)
+{
+    return ENTRY_DATA_BITS - bitarithm_bits_set_u32(entry & ENTRY_DATA_MASK);
+}
+
+static uint32_t _entry_encode(uint32_t lpn, bool trim)
+{
+    uint32_t entry = lpn | (trim ? ENTRY_TRIM : 0);
+
+    return entry | (_entry_check(entry) << ENTRY_CHECK_SHIFT) | ENTRY_UNUSED;
+}
+
+/* get the entry of @p slot, ENTRY_FREE if it is unused or torn */
+static uint32_t _entry(const uint8_t *meta, uint32_t slot)
+{
+    uint32_t entry;
+    memcpy(&entry, meta + HDR_SIZE + slot * sizeof(entry), sizeof(entry));
+    if ((entry != ENTRY_FREE) &&
+        (((entry & ENTRY_CHECK_MASK) >> ENTRY_CHECK_SHIFT) !=
+         _entry_check(entry))) {
+        DEBUG("mtd_ftl: torn entry %08" PRIx32 "\n", entry);
+        return ENTRY_FREE;
+    }
+    return entry;
+}
+
+static int _erase(mtd_ftl_t *ftl, uint32_t sector)
+{
+    mtd_ftl_sector_t *s = &ftl->sectors[sector];
+
+    int res = mtd_erase_sector(ftl->parent, sector, 1);
+    if (res < 0) {
+        return res;
+    }
+    s->erase_count++;
+    s->seq = 0;
+    s->valid = 0;
+    s->used = 0;
+    s->flags = FLAG_ERASED;
+    ftl->stats.erases++;
+    return 0;
+}
+
+/* open the least worn free sector for writing */
+static int _open(mtd_ftl_t *ftl)
+{
+    uint32_t sector = SECTOR_NONE;
+    for (uint32_t i = 0; i < ftl->parent->sector_count; i++) {
+        if ((ftl->sectors[i].seq == 0) && ((sector == SECTOR_NONE) ||
+            (ftl->sectors[i].erase_count < ftl->sectors[sector].erase_count))) {
+            sector = i;
+        }
+    }
+    if (sector == SECTOR_NONE) {
+        return -ENOSPC;
+    }
+
+    mtd_ftl_sector_t *s = &ftl->sectors[sector];
+    int res;
+    if (!(s->flags & FLAG_ERASED)) {
+        res = _erase(ftl, sector);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    uint32_t hdr[HDR_WORDS];
+    hdr[HDR_MAGIC] = MTD_FTL_MAGIC;
+    hdr[HDR_SEQ] = ftl->seq++;
+    hdr[HDR_ERASE_COUNT] = s->erase_count;
+
+    /* once written to, the sector is no longer free, even if this fails */
+    s->seq = hdr[HDR_SEQ];
+    s->flags = 0;
+    ftl->free_sectors--;
+    ftl->active = sector;
+
+    DEBUG("mtd_ftl: open sector %" PRIu32 " (seq %" PRIu32 ", erased %" PRIu32 "x)\n",
+          sector, s->seq, s->erase_count);
+
+    /* the magic commits the header */
+    uint32_t page = sector * ftl->mtd.pages_per_sector;
+    res = mtd_write_page_raw(ftl->parent, &hdr[HDR_SEQ], page,
+                             HDR_SEQ * sizeof(uint32_t),
+                             HDR_SIZE - HDR_SEQ * sizeof(uint32_t));
+    if (res < 0) {
+        return res;
+    }
+    return mtd_write_page_raw(ftl->parent, &hdr[HDR_MAGIC], page,
+                              HDR_MAGIC * sizeof(uint32_t), sizeof(uint32_t));
+}
+
+/* write @p data (or a trim entry if NULL) for logical page @p lpn to the next
+ * slot of the active sector */
+static int _append(mtd_ftl_t *ftl, uint32_t lpn, const void *data)
+{
+    mtd_ftl_sector_t *s = &ftl->sectors[ftl->active];
+    uint32_t slot = s->used++;
+    uint32_t phys = _phys_page(ftl, ftl->active, slot);
+    uint32_t entry = _entry_encode(lpn, data == NULL);
+    int res;
+
+    assert(slot < _slots(ftl));
+
+    if (data) {
+        res = mtd_write_page_raw(ftl->parent, data, phys, 0, ftl->mtd.page_size);
+        if (res < 0) {
+            return res;
+        }
+        ftl->stats.flash_writes++;
+    }
+    else {
+        phys |= MAP_TRIM;
+    }
+
+    /* the entry commits the page */
+    res = mtd_write_page_raw(ftl->parent, &entry,
+                             ftl->active * ftl->mtd.pages_per_sector,
+                             HDR_SIZE + slot * sizeof(entry), sizeof(entry));
+    if (res < 0) {
+        return res;
+    }
+
+    if (ftl->map[lpn] != MAP_CLEAN) {
+        ftl->sectors[_sector_of(ftl, ftl->map[lpn])].valid--;
+    }
+    ftl->map[lpn] = phys;
+    s->valid++;
+    return 0;
+}
+
+/* sector with the fewest live entries that can be collected */
+static uint32_t _greedy_victim(const mtd_ftl_t *ftl)
+{
+    uint32_t victim = SECTOR_NONE;
+    for (uint32_t i = 0; i < ftl->parent->sector_count; i++) {
+        const mtd_ftl_sector_t *s = &ftl->sectors[i];
+        if ((s->seq == 0) || (i == ftl->active) || (s->valid >= _slots(ftl))) {
+            continue;
+        }
+        if ((victim == SECTOR_NONE) || (s->valid < ftl->sectors[victim].valid) ||
+            ((s->valid == ftl->sectors[victim].valid) &&
+             (s->erase_count < ftl->sectors[victim].erase_count))) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+/* least worn sector holding data, if it lags behind too much */
+static uint32_t _wear_victim(const mtd_ftl_t *ftl)
+{
+    uint32_t victim = SECTOR_NONE;
+    uint32_t max = 0;
+    for (uint32_t i = 0; i < ftl->parent->sector_count; i++) {
+        const mtd_ftl_sector_t *s = &ftl->sectors[i];
+        max = (s->erase_count > max) ? s->erase_count : max;
+        if ((s->seq == 0) || (i == ftl->active)) {
+            continue;
+        }
+        if ((victim == SECTOR_NONE) ||
+            (s->erase_count < ftl->sectors[victim].erase_count)) {
+            victim = i;
+        }
+    }
+    if ((victim != SECTOR_NONE) &&
+        (max - ftl->sectors[victim].erase_count > CONFIG_MTD_FTL_WEAR_DELTA)) {
+        return victim;
+    }
+    return SECTOR_NONE;
+}
+
+static int _ensure_slot(mtd_ftl_t *ftl, bool allow_gc);
+
+/* move the live entries of @p victim to the active sector and erase it */
+static int _collect(mtd_ftl_t *ftl, uint32_t victim)
+{
+    mtd_ftl_sector_t *s = &ftl->sectors[victim];
+    uint8_t *meta = _meta_buf(ftl);
+    int res;
+
+    DEBUG("mtd_ftl: collect sector %" PRIu32 " (%u live)\n", victim, s->valid);
+
+    if (s->valid) {
+        res = mtd_read_page(ftl->parent, meta,
+                            victim * ftl->mtd.pages_per_sector, 0,
+                            ftl->mtd.page_size);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    for (uint32_t slot = 0; (slot < s->used) && s->valid; slot++) {
+        uint32_t entry = _entry(meta, slot);
+        uint32_t lpn = entry & ENTRY_LPN_MASK;
+        uint32_t loc = _phys_page(ftl, victim, slot);
+
+        if ((entry == ENTRY_FREE) || (lpn >= _logical_pages(ftl))) {
+            continue;
+        }
+        if (entry & ENTRY_TRIM) {
+            loc |= MAP_TRIM;
+        }
+        if (ftl->map[lpn] != loc) {
+            /* superseded */
+            continue;
+        }
+
+        res = _ensure_slot(ftl, false);
+        if (res < 0) {
+            return res;
+        }
+        if (entry & ENTRY_TRIM) {
+            res = _append(ftl, lpn, NULL);
+        }
+        else {
+            res = mtd_read_page(ftl->parent, _page_buf(ftl), loc, 0,
+                                ftl->mtd.page_size);
+            if (res == 0) {
+                res = _append(ftl, lpn, _page_buf(ftl));
+            }
+        }
+        if (res < 0) {
+            return res;
+        }
+        ftl->stats.relocations++;
+    }
+
+    res = _erase(ftl, victim);
+    if (res < 0) {
+        return res;
+    }
+    ftl->free_sectors++;
+    ftl->stats.gc_runs++;
+    return 0;
+}
+
+static int _ensure_slot(mtd_ftl_t *ftl, bool allow_gc)
+{
+    if ((ftl->active != SECTOR_NONE) &&
+        (ftl->sectors[ftl->active].used < _slots(ftl))) {
+        return 0;
+    }
+    /* always keep one free sector to collect into */
+    while (allow_gc && (ftl->free_sectors < 2)) {
+        uint32_t victim = _greedy_victim(ftl);
+        if (victim == SECTOR_NONE) {
+            return -ENOSPC;
+        }
+        int res = _collect(ftl, victim);
+        if (res < 0) {
+            return res;
+        }
+        if ((ftl->active != SECTOR_NONE) &&
+            (ftl->sectors[ftl->active].used < _slots(ftl))) {
+            return 0;
+        }
+    }
+    return _open(ftl);
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+    mtd_dev_t *parent = ftl->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* one page per sector is used for the header */
+    assert(parent->pages_per_sector >= 2);
+    assert(HDR_SIZE + (parent->pages_per_sector - 1) * sizeof(uint32_t)
+           <= parent->page_size);
+    assert(parent->sector_count > CONFIG_MTD_FTL_RESERVED_SECTORS);
+
+    uint32_t pages = (parent->sector_count - CONFIG_MTD_FTL_RESERVED_SECTORS)
+                   * (parent->pages_per_sector - 1);
+    if (pages > ftl->map_size) {
+        pages = ftl->map_size;
+    }
+    mtd->page_size = parent->page_size;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->sector_count = pages / parent->pages_per_sector;
+    assert(_logical_pages(ftl) <= ENTRY_LPN_MASK + 1);
+
+    for (uint32_t i = 0; i < _logical_pages(ftl); i++) {
+        ftl->map[i] = MAP_CLEAN;
+    }
+    memset(&ftl->stats, 0, sizeof(ftl->stats));
+    ftl->active = SECTOR_NONE;
+    ftl->free_sectors = 0;
+    ftl->seq = 1;
+
+    /* read all sector headers */
+    uint64_t erase_sum = 0;
+    uint32_t erase_known = 0;
+    for (uint32_t i = 0; i < parent->sector_count; i++) {
+        mtd_ftl_sector_t *s = &ftl->sectors[i];
+        uint32_t hdr[HDR_WORDS];
+        res = mtd_read_page(parent, hdr, i * parent->pages_per_sector, 0,
+                            HDR_SIZE);
+        if (res < 0) {
+            return res;
+        }
+        memset(s, 0, sizeof(*s));
+        if ((hdr[HDR_MAGIC] == MTD_FTL_MAGIC) && (hdr[HDR_SEQ] != 0) &&
+            (hdr[HDR_SEQ] != UINT32_MAX)) {
+            s->seq = hdr[HDR_SEQ];
+            s->erase_count = hdr[HDR_ERASE_COUNT];
+            /* never append to a sector written before the reset, its next
+             * slot may have been torn */
+            s->used = _slots(ftl);
+            erase_sum += s->erase_count;
+            erase_known++;
+            if (s->seq >= ftl->seq) {
+                ftl->seq = s->seq + 1;
+            }
+        }
+        else {
+            /* free or torn, will be erased before use */
+            ftl->free_sectors++;
+        }
+    }
+
+    /* erase counters of free sectors are lost, assume the average */
+    uint32_t erase_avg = erase_known ? erase_sum / erase_known : 0;
+    for (uint32_t i = 0; i < parent->sector_count; i++) {
+        if (ftl->sectors[i].seq == 0) {
+            ftl->sectors[i].erase_count = erase_avg;
+        }
+    }
+
+    /* replay the sectors in the order they were written */
+    uint32_t last = 0;
+    for (;;) {
+        uint32_t next = SECTOR_NONE;
+        for (uint32_t i = 0; i < parent->sector_count; i++) {
+            uint32_t seq = ftl->sectors[i].seq;
+            if ((seq > last) &&
+                ((next == SECTOR_NONE) || (seq < ftl->sectors[next].seq))) {
+                next = i;
+            }
+        }
+        if (next == SECTOR_NONE) {
+            break;
+        }
+        last = ftl->sectors[next].seq;
+
+        uint8_t *meta = _meta_buf(ftl);
+        res = mtd_read_page(parent, meta, next * parent->pages_per_sector, 0,
+                            parent->page_size);
+        if (res < 0) {
+            return res;
+        }
+        for (uint32_t slot = 0; slot < _slots(ftl); slot++) {
+            uint32_t entry = _entry(meta, slot);
+            uint32_t lpn = entry & ENTRY_LPN_MASK;
+            if ((entry == ENTRY_FREE) || (lpn >= _logical_pages(ftl))) {
+                continue;
+            }
+            uint32_t loc = _phys_page(ftl, next, slot);
+            ftl->map[lpn] = (entry & ENTRY_TRIM) ? (loc | MAP_TRIM) : loc;
+        }
+    }
+
+    for (uint32_t lpn = 0; lpn < _logical_pages(ftl); lpn++) {
+        if (ftl->map[lpn] != MAP_CLEAN) {
+            ftl->sectors[_sector_of(ftl, ftl->map[lpn])].valid++;
+        }
+    }
+
+    DEBUG("mtd_ftl: %" PRIu32 " logical sectors, %" PRIu32 " free sectors\n",
+          mtd->sector_count, ftl->free_sectors);
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+
+    if (page >= _logical_pages(ftl)) {
+        return -EOVERFLOW;
+    }
+    if (count > mtd->page_size - offset) {
+        count = mtd->page_size - offset;
+    }
+
+    mutex_lock(&ftl->lock);
+    int res = count;
+    uint32_t loc = ftl->map[page];
+    if ((loc == MAP_CLEAN) || (loc & MAP_TRIM)) {
+        memset(dest, 0xff, count);
+    }
+    else {
+        int err = mtd_read_page(ftl->parent, dest, loc, offset, count);
+        if (err < 0) {
+            res = err;
+        }
+    }
+    mutex_unlock(&ftl->lock);
+    return res;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+
+    if (page >= _logical_pages(ftl)) {
+        return -EOVERFLOW;
+    }
+    if (count > mtd->page_size - offset) {
+        count = mtd->page_size - offset;
+    }
+
+    mutex_lock(&ftl->lock);
+    int res = _ensure_slot(ftl, true);
+    if (res < 0) {
+        goto out;
+    }
+
+    const void *data = src;
+    if (count < mtd->page_size) {
+        /* merge partial writes with the current page contents */
+        uint8_t *buf = _page_buf(ftl);
+        uint32_t loc = ftl->map[page];
+        if ((loc == MAP_CLEAN) || (loc & MAP_TRIM)) {
+            memset(buf, 0xff, mtd->page_size);
+        }
+        else {
+            res = mtd_read_page(ftl->parent, buf, loc, 0, mtd->page_size);
+            if (res < 0) {
+                goto out;
+            }
+        }
+        memcpy(buf + offset, src, count);
+        data = buf;
+    }
+
+    res = _append(ftl, page, data);
+    if (res == 0) {
+        ftl->stats.host_writes++;
+        res = count;
+    }
+
+out:
+    mutex_unlock(&ftl->lock);
+    return res;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+    int res = 0;
+
+    if (sector + count > mtd->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&ftl->lock);
+    uint32_t end = (sector + count) * mtd->pages_per_sector;
+    for (uint32_t lpn = sector * mtd->pages_per_sector; lpn < end; lpn++) {
+        uint32_t loc = ftl->map[lpn];
+        if ((loc == MAP_CLEAN) || (loc & MAP_TRIM)) {
+            continue;
+        }
+        res = _ensure_slot(ftl, true);
+        if (res == 0) {
+            res = _append(ftl, lpn, NULL);
+        }
+        if (res < 0) {
+            break;
+        }
+    }
+    mutex_unlock(&ftl->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+
+    return mtd_power(ftl->parent, power);
+}
+
+int mtd_ftl_gc(mtd_ftl_t *ftl, unsigned budget)
+{
+    int done = 0;
+
+    mutex_lock(&ftl->lock);
+    while ((unsigned)done < budget) {
+        uint32_t victim = _wear_victim(ftl);
+        if ((victim == SECTOR_NONE) &&
+            (ftl->free_sectors < CONFIG_MTD_FTL_GC_FREE_TARGET)) {
+            victim = _greedy_victim(ftl);
+        }
+        if (victim == SECTOR_NONE) {
+            break;
+        }
+        int res = _collect(ftl, victim);
+        if (res < 0) {
+            done = res;
+            break;
+        }
+        done++;
+    }
+    mutex_unlock(&ftl->lock);
+    return done;
+}
+
+void mtd_ftl_erase_histogram(mtd_ftl_t *ftl, uint32_t *hist, unsigned numof,
+                             uint32_t *min, uint32_t *max)
+{
+    uint32_t lo = UINT32_MAX;
+    uint32_t hi = 0;
+
+    mutex_lock(&ftl->lock);
+    for (uint32_t i = 0; i < ftl->parent->sector_count; i++) {
+        uint32_t ec = ftl->sectors[i].erase_count;
+        lo = (ec < lo) ? ec : lo;
+        hi = (ec > hi) ? ec : hi;
+    }
+    memset(hist, 0, numof * sizeof(*hist));
+    for (uint32_t i = 0; i < ftl->parent->sector_count; i++) {
+        uint64_t pos = ftl->sectors[i].erase_count - lo;
+        hist[(pos * numof) / ((uint64_t)hi - lo + 1)]++;
+    }
+    mutex_unlock(&ftl->lock);
+
+    if (min) {
+        *min = lo;
+    }
+    if (max) {
+        *max = hi;
+    }
+}
+
+uint32_t mtd_ftl_write_amplification(const mtd_ftl_t *ftl)
+{
+    if (ftl->stats.host_writes == 0) {
+        return 0;
+    }
+    return ((uint64_t)ftl->stats.flash_writes * 100) / ftl->stats.host_writes;
+}
+
+const mtd_desc_t mtd_ftl_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
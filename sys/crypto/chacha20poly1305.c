@@ -19,6 +19,8 @@
  * @}
  */
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
@@ -43,111 +45,211 @@ static const uint32_t constant[] = {0x61707865,
 /* Padding to add to the poly1305 authentication tag */
 static const uint8_t padding[15] = {0};
 
-/* Single round */
-static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
-{
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
-}
+#define ROTL32(x, n)  (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) \
+    do { \
+        a += b; d ^= a; d = ROTL32(d, 16); \
+        c += d; b ^= c; b = ROTL32(b, 12); \
+        a += b; d ^= a; d = ROTL32(d, 8);  \
+        c += d; b ^= c; b = ROTL32(b, 7);  \
+    } while (0)
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                         const uint8_t *nonce, uint32_t blk)
+/* Set up the input block, with the block counter set to zero */
+static void _init_input(uint32_t *input, const uint8_t *key,
+                        const uint8_t *nonce)
 {
     for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+        input[i] = constant[i];
     }
     for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+        input[i + 4] = unaligned_get_u32(key + 4 * i);
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
+    input[12] = 0;
+    input[13] = unaligned_get_u32(nonce);
+    input[14] = unaligned_get_u32(nonce + 4);
+    input[15] = unaligned_get_u32(nonce + 8);
 }
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
+/* Generate the key stream block for the input block and increment the block
+ * counter. The working state is kept in locals so that the compiler can keep
+ * as much of it in registers as the target allows. */
+static void _keystream(uint32_t *input, uint32_t *out)
 {
-    /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
-
-    /* perform rounds */
-    for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
-        _r(a, b, d, 16);
-        _r(c, d, b, 12);
-        _r(a, b, d, 8);
-        _r(c, d, b, 7);
+    uint32_t x0 = input[0], x1 = input[1], x2 = input[2], x3 = input[3];
+    uint32_t x4 = input[4], x5 = input[5], x6 = input[6], x7 = input[7];
+    uint32_t x8 = input[8], x9 = input[9], x10 = input[10], x11 = input[11];
+    uint32_t x12 = input[12], x13 = input[13], x14 = input[14], x15 = input[15];
+
+    for (unsigned i = 0; i < 10; i++) {
+        /* column round */
+        QUARTERROUND(x0, x4, x8, x12);
+        QUARTERROUND(x1, x5, x9, x13);
+        QUARTERROUND(x2, x6, x10, x14);
+        QUARTERROUND(x3, x7, x11, x15);
+        /* diagonal round */
+        QUARTERROUND(x0, x5, x10, x15);
+        QUARTERROUND(x1, x6, x11, x12);
+        QUARTERROUND(x2, x7, x8, x13);
+        QUARTERROUND(x3, x4, x9, x14);
     }
-    /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
+
+    out[0] = x0 + input[0];
+    out[1] = x1 + input[1];
+    out[2] = x2 + input[2];
+    out[3] = x3 + input[3];
+    out[4] = x4 + input[4];
+    out[5] = x5 + input[5];
+    out[6] = x6 + input[6];
+    out[7] = x7 + input[7];
+    out[8] = x8 + input[8];
+    out[9] = x9 + input[9];
+    out[10] = x10 + input[10];
+    out[11] = x11 + input[11];
+    out[12] = x12 + input[12];
+    out[13] = x13 + input[13];
+    out[14] = x14 + input[14];
+    out[15] = x15 + input[15];
+
+    input[12]++;
 }
 
-static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                    const uint8_t *nonce, const uint8_t *in, uint8_t *out, size_t len)
+/* XOR @p len bytes of @p in with the key stream, generating new key stream
+ * blocks as needed */
+static void _xcrypt(chacha20poly1305_stream_ctx_t *ctx, const uint8_t *in,
+                    uint8_t *out, size_t len)
 {
-    /* Number of full 64 byte blocks */
-    const size_t num_blocks = len >> 6;
-    size_t pos = 0;
-    /* xcrypt full blocks */
-    for (size_t i = 0; i < num_blocks; i++, pos += 64) {
-        _keystream(ctx, key, nonce, i+1);
-        for (size_t j = 0; j < 64; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+    const uint8_t *stream = (const uint8_t *)ctx->stream;
+
+    while (len) {
+        if (ctx->stream_pos == CHACHA20POLY1305_BLOCK_BYTES) {
+            _keystream(ctx->input, ctx->stream);
+            ctx->stream_pos = 0;
         }
-    }
-    /* xcrypt remaining bytes */
-    if (len - pos) {
-        _keystream(ctx, key, nonce, num_blocks+1);
-        for (size_t j = 0; j < len - pos; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+        size_t n = CHACHA20POLY1305_BLOCK_BYTES - ctx->stream_pos;
+        if (n > len) {
+            n = len;
+        }
+        for (size_t i = 0; i < n; i++) {
+            out[i] = in[i] ^ stream[ctx->stream_pos + i];
         }
+        ctx->stream_pos += n;
+        in += n;
+        out += n;
+        len -= n;
     }
 }
 
-static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
+static void _poly1305_pad(poly1305_ctx_t *pctx, uint64_t len)
 {
-    poly1305_update(pctx, data, len);
     const size_t padlen = (16 - len) & 0xF;
     poly1305_update(pctx, padding, padlen);
 }
 
-/* Generate a poly1305 tag */
-static void _poly1305_gentag(uint8_t *mac, const uint8_t *key, const uint8_t *nonce,
-                             const uint8_t *cipher, size_t cipherlen,
-                             const uint8_t *aad, size_t aadlen)
+/* Pad the additional data once the first message byte is processed */
+static void _finish_aad(chacha20poly1305_stream_ctx_t *ctx)
 {
-    chacha20poly1305_ctx_t ctx;
-    /* generate one time key */
-    _keystream(&ctx, key, nonce, 0);
-    poly1305_init(&ctx.poly, (uint8_t*)ctx.state);
-    /* Add aad */
-    _poly1305_padded(&ctx.poly, aad, aadlen);
-    /* Add ciphertext */
-    _poly1305_padded(&ctx.poly, cipher, cipherlen);
-    /* Add aad length */
-    const uint64_t lengths[2] = {aadlen, cipherlen};
-    poly1305_update(&ctx.poly, (uint8_t*)lengths, sizeof(lengths));
-    poly1305_finish(&ctx.poly, mac);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
+    if (!ctx->aad_done) {
+        _poly1305_pad(&ctx->poly, ctx->aadlen);
+        ctx->aad_done = true;
+    }
+}
+
+/* Process the message in chunks that are still in cache when they are
+ * passed on to the MAC */
+#define CHUNK_BYTES     CHACHA20POLY1305_BLOCK_BYTES
+
+void chacha20poly1305_init(chacha20poly1305_stream_ctx_t *ctx,
+                           const uint8_t *key, const uint8_t *nonce)
+{
+    _init_input(ctx->input, key, nonce);
+    /* block 0 holds the one time key for poly1305 */
+    _keystream(ctx->input, ctx->stream);
+    poly1305_init(&ctx->poly, (const uint8_t *)ctx->stream);
+    ctx->stream_pos = CHACHA20POLY1305_BLOCK_BYTES;
+    ctx->aadlen = 0;
+    ctx->msglen = 0;
+    ctx->aad_done = false;
+}
+
+void chacha20poly1305_update_aad(chacha20poly1305_stream_ctx_t *ctx,
+                                 const uint8_t *aad, size_t len)
+{
+    assert(!ctx->aad_done);
+    poly1305_update(&ctx->poly, aad, len);
+    ctx->aadlen += len;
+}
+
+void chacha20poly1305_encrypt_update(chacha20poly1305_stream_ctx_t *ctx,
+                                     const uint8_t *msg, uint8_t *cipher,
+                                     size_t len)
+{
+    _finish_aad(ctx);
+    ctx->msglen += len;
+    while (len) {
+        size_t n = len < CHUNK_BYTES ? len : CHUNK_BYTES;
+        _xcrypt(ctx, msg, cipher, n);
+        poly1305_update(&ctx->poly, cipher, n);
+        msg += n;
+        cipher += n;
+        len -= n;
+    }
+}
+
+void chacha20poly1305_decrypt_update(chacha20poly1305_stream_ctx_t *ctx,
+                                     const uint8_t *cipher, uint8_t *msg,
+                                     size_t len)
+{
+    _finish_aad(ctx);
+    ctx->msglen += len;
+    while (len) {
+        size_t n = len < CHUNK_BYTES ? len : CHUNK_BYTES;
+        poly1305_update(&ctx->poly, cipher, n);
+        _xcrypt(ctx, cipher, msg, n);
+        msg += n;
+        cipher += n;
+        len -= n;
+    }
+}
+
+static void _gentag(chacha20poly1305_stream_ctx_t *ctx, uint8_t *tag)
+{
+    _finish_aad(ctx);
+    _poly1305_pad(&ctx->poly, ctx->msglen);
+    const uint64_t lengths[2] = { ctx->aadlen, ctx->msglen };
+    poly1305_update(&ctx->poly, (const uint8_t *)lengths, sizeof(lengths));
+    poly1305_finish(&ctx->poly, tag);
+}
+
+void chacha20poly1305_encrypt_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *tag)
+{
+    _gentag(ctx, tag);
+    crypto_secure_wipe(ctx, sizeof(*ctx));
+}
+
+int chacha20poly1305_decrypt_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                    const uint8_t *tag)
+{
+    uint8_t mac[CHACHA20POLY1305_TAG_BYTES];
+
+    _gentag(ctx, mac);
+    crypto_secure_wipe(ctx, sizeof(*ctx));
+    int res = crypto_equals(tag, mac, CHACHA20POLY1305_TAG_BYTES);
+    crypto_secure_wipe(mac, sizeof(mac));
+    return res;
 }
 
 void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
                               size_t msglen, const uint8_t *aad, size_t aadlen,
                               const uint8_t *key, const uint8_t *nonce)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, msg, cipher, msglen);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
-    /* Generate tag */
-    _poly1305_gentag(&cipher[msglen], key, nonce,
-                    cipher, msglen, aad, aadlen);
-    /* Wipe structures */
+    chacha20poly1305_stream_ctx_t ctx;
+
+    chacha20poly1305_init(&ctx, key, nonce);
+    chacha20poly1305_update_aad(&ctx, aad, aadlen);
+    chacha20poly1305_encrypt_update(&ctx, msg, cipher, msglen);
+    chacha20poly1305_encrypt_finish(&ctx, &cipher[msglen]);
 }
 
 int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
@@ -155,15 +257,27 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              const uint8_t *aad, size_t aadlen,
                              const uint8_t *key, const uint8_t *nonce)
 {
+    chacha20poly1305_stream_ctx_t ctx;
+    uint8_t mac[CHACHA20POLY1305_TAG_BYTES];
+
     *msglen = cipherlen - CHACHA20POLY1305_TAG_BYTES;
-    uint8_t mac[16];
-    _poly1305_gentag(mac, key, nonce, cipher,
-                     cipherlen - CHACHA20POLY1305_TAG_BYTES, aad, aadlen);
-    if (crypto_equals(cipher+*msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
+
+    /* The tag is verified before anything is written to msg, so that msg
+     * stays untouched if the ciphertext is not authentic */
+    chacha20poly1305_init(&ctx, key, nonce);
+    chacha20poly1305_update_aad(&ctx, aad, aadlen);
+    _finish_aad(&ctx);
+    poly1305_update(&ctx.poly, cipher, *msglen);
+    ctx.msglen = *msglen;
+    _gentag(&ctx, mac);
+    if (crypto_equals(cipher + *msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
+        crypto_secure_wipe(&ctx, sizeof(ctx));
         return 0;
     }
-    chacha20poly1305_ctx_t ctx;
-    /* Number of full blocks */
-    _xcrypt(&ctx, key, nonce, cipher, msg, *msglen);
+    /* key stream starts at block 1 */
+    ctx.input[12] = 1;
+    ctx.stream_pos = CHACHA20POLY1305_BLOCK_BYTES;
+    _xcrypt(&ctx, cipher, msg, *msglen);
+    crypto_secure_wipe(&ctx, sizeof(ctx));
     return 1;
 }
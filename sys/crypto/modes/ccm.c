@@ -19,10 +19,10 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include "debug.h"
 #include "crypto/helper.h"
-#include "crypto/modes/ctr.h"
 #include "crypto/modes/ccm.h"
 
 static inline int min(int a, int b)
@@ -35,145 +35,268 @@ static inline int min(int a, int b)
     }
 }
 
-static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
-                               const uint8_t *input, size_t length, uint8_t *mac)
+/* Check if 'value' can be stored in 'num_bytes' */
+static inline int _fits_in_nbytes(size_t value, uint8_t num_bytes)
 {
-    uint8_t block_size, mac_enc[16] = { 0 };
-    uint32_t offset;
+    /* Not allowed to shift more or equal than left operand width
+     * So we shift by maximum num bits of size_t -1 and compare to 1
+     */
+    unsigned shift = (8 * min(sizeof(size_t), num_bytes)) - 1;
+
+    return (value >> shift) <= 1;
+}
 
-    block_size = cipher_get_block_size(cipher);
-    memmove(mac, iv, 16);
-    offset = 0;
+/* Absorb additional data into the CBC-MAC */
+static int _absorb(cipher_ccm_ctx_t *ctx, const uint8_t *data, size_t len)
+{
+    uint8_t *mac = ctx->blocks;
 
-    /* no input message */
-    if(length == 0) {
-        return 0;
+    while (len) {
+        if (ctx->mac_pos == CCM_BLOCK_SIZE) {
+            if (cipher_encrypt(ctx->cipher, mac, mac) != 1) {
+                return CIPHER_ERR_ENC_FAILED;
+            }
+            ctx->mac_pos = 0;
+        }
+        uint8_t n = CCM_BLOCK_SIZE - ctx->mac_pos;
+        if (len < n) {
+            n = len;
+        }
+        for (uint8_t i = 0; i < n; i++) {
+            mac[ctx->mac_pos++] ^= *data++;
+        }
+        len -= n;
     }
 
-    do {
-        uint8_t block_size_input = (length - offset > block_size) ?
-                                   block_size : length - offset;
+    return 0;
+}
 
-        /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (int i = 0; i < block_size_input; ++i) {
-            mac[i] ^= input[offset + i];
-        }
+/* Generate the key stream block for the counter in ctx->ctr. If data is
+ * pending in the CBC-MAC block, encrypt it in the same call. */
+static int _next_blocks(cipher_ccm_ctx_t *ctx)
+{
+    uint8_t *stream = &ctx->blocks[CCM_BLOCK_SIZE];
+    int res;
 
-        if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
-            return CIPHER_ERR_ENC_FAILED;
-        }
+    memcpy(stream, ctx->ctr, CCM_BLOCK_SIZE);
+    if (ctx->mac_pos) {
+        res = cipher_encrypt_blocks(ctx->cipher, ctx->blocks, ctx->blocks, 2);
+    }
+    else {
+        res = cipher_encrypt(ctx->cipher, stream, stream);
+    }
+    if (res != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+
+    crypto_block_inc_ctr(ctx->ctr, ctx->length_encoding);
+    ctx->mac_pos = 0;
+    ctx->stream_pos = 0;
+    return 0;
+}
+
+static int _crypt(cipher_ccm_ctx_t *ctx, const uint8_t *input, size_t len,
+                  uint8_t *output, bool decrypt)
+{
+    uint8_t *mac = ctx->blocks;
+    uint8_t *stream = &ctx->blocks[CCM_BLOCK_SIZE];
+
+    if (ctx->auth_data_left || len > ctx->input_left) {
+        return CIPHER_ERR_INVALID_LENGTH;
+    }
+    ctx->input_left -= len;
 
-        memcpy(mac, mac_enc, block_size);
-        offset += block_size_input;
-    } while (offset < length);
+    while (len) {
+        if (ctx->stream_pos == CCM_BLOCK_SIZE) {
+            int res = _next_blocks(ctx);
+            if (res < 0) {
+                return res;
+            }
+        }
+        /* payload blocks start with a fresh CBC-MAC and key stream block,
+         * so ctx->mac_pos == ctx->stream_pos from here on */
+        uint8_t n = CCM_BLOCK_SIZE - ctx->stream_pos;
+        if (len < n) {
+            n = len;
+        }
+        for (uint8_t i = 0; i < n; i++) {
+            uint8_t in = input[i];
+            uint8_t out = in ^ stream[ctx->stream_pos++];
+            mac[ctx->mac_pos++] ^= decrypt ? out : in;
+            output[i] = out;
+        }
+        input += n;
+        output += n;
+        len -= n;
+    }
 
-    return offset;
+    return 0;
 }
 
+/* Compute the authentication value into the first mac_length bytes of
+ * ctx->blocks */
+static int _finish(cipher_ccm_ctx_t *ctx)
+{
+    uint8_t *stream = &ctx->blocks[CCM_BLOCK_SIZE];
+
+    if (ctx->auth_data_left || ctx->input_left) {
+        return CIPHER_ERR_INVALID_LENGTH;
+    }
+
+    /* counter A_0 */
+    memset(&ctx->ctr[CCM_BLOCK_SIZE - ctx->length_encoding], 0,
+           ctx->length_encoding);
+    int res = _next_blocks(ctx);
+    if (res < 0) {
+        return res;
+    }
+
+    for (uint8_t i = 0; i < ctx->mac_length; i++) {
+        ctx->blocks[i] ^= stream[i];
+    }
 
-static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint8_t M,
-                             uint8_t L, const uint8_t *nonce, uint8_t nonce_len,
-                             size_t plaintext_len, uint8_t X1[16])
+    return 0;
+}
+
+int cipher_ccm_init(cipher_ccm_ctx_t *ctx, const cipher_t *cipher,
+                    uint8_t mac_length, uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len,
+                    uint32_t auth_data_len, size_t input_len)
 {
-    uint8_t M_, L_;
+    uint8_t *B0 = ctx->blocks;
 
-    /* ensure everything is set to zero */
-    memset(X1, 0, 16);
+    if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
+        return CCM_ERR_INVALID_MAC_LENGTH;
+    }
+
+    if (length_encoding < 2 || length_encoding > 8 ||
+        !_fits_in_nbytes(input_len, length_encoding)) {
+        return CCM_ERR_INVALID_LENGTH_ENCODING;
+    }
+
+    /* If 0 < l(a) < (2^16 - 2^8), then the length field is encoded as two
+     * octets. (RFC3610 page 2)
+     */
+    if (auth_data_len > 0xFEFF) {
+        DEBUG("UNSUPPORTED Adata length: %" PRIu32 "\n", auth_data_len);
+        return -1;
+    }
+
+    assert(cipher_get_block_size(cipher) == CCM_BLOCK_SIZE);
+    ctx->cipher = cipher;
+    ctx->mac_length = mac_length;
+    ctx->length_encoding = length_encoding;
+    ctx->auth_data_left = auth_data_len;
+    ctx->input_left = input_len;
 
     /* set flags in B[0] - bit format:
             7        6     5..3  2..0
         Reserved   Adata    M_    L_    */
-    M_ = (M - 2) / 2;
-    L_ = L - 1;
-    X1[0] = 64 * (auth_data_len > 0) + 8 * M_ + L_;
+    memset(B0, 0, CCM_BLOCK_SIZE);
+    B0[0] = 64 * (auth_data_len > 0) + 8 * ((mac_length - 2) / 2) +
+            (length_encoding - 1);
 
     /* copy nonce to B[1..15-L] */
-    memcpy(&X1[1], nonce, min(nonce_len, 15 - L));
+    memcpy(&B0[1], nonce, min(nonce_len, 15 - length_encoding));
 
-    /* write plaintext_len to B[15..16-L] (reverse) */
-    for (uint8_t i = 15; i > 16 - L - 1; --i) {
-        X1[i] = plaintext_len & 0xff;
-        plaintext_len >>= 8;
+    /* write input_len to B[15..16-L] (reverse) */
+    for (uint8_t i = 15; i > 15 - length_encoding; --i) {
+        B0[i] = input_len & 0xff;
+        input_len >>= 8;
     }
 
-    /* if there is still data, plaintext_len was too big */
-    if (plaintext_len > 0) {
-        return CIPHER_ERR_INVALID_LENGTH;
-    }
+    /* B0 is encrypted with the next block of CBC-MAC input */
+    ctx->mac_pos = CCM_BLOCK_SIZE;
 
-    if (cipher_encrypt(cipher, X1, X1) != 1) {
-        return CIPHER_ERR_ENC_FAILED;
+    /* counter blocks A_i share flags and nonce, payload starts with A_1 */
+    memset(ctx->ctr, 0, CCM_BLOCK_SIZE);
+    ctx->ctr[0] = length_encoding - 1;
+    memcpy(&ctx->ctr[1], nonce, min(nonce_len, 15 - length_encoding));
+    crypto_block_inc_ctr(ctx->ctr, length_encoding);
+    ctx->stream_pos = CCM_BLOCK_SIZE;
+
+    if (auth_data_len > 0) {
+        uint8_t len_encoded[2] = { auth_data_len >> 8, auth_data_len & 0xff };
+        return _absorb(ctx, len_encoded, sizeof(len_encoded));
     }
+
     return 0;
 }
 
-static int ccm_compute_adata_mac(const cipher_t *cipher, const uint8_t *auth_data,
-                                 uint32_t auth_data_len, uint8_t X1[16])
+int cipher_ccm_update_adata(cipher_ccm_ctx_t *ctx, const uint8_t *auth_data,
+                            size_t len)
 {
-    if (auth_data_len > 0) {
-        int len;
+    if (len > ctx->auth_data_left) {
+        return CIPHER_ERR_INVALID_LENGTH;
+    }
+    ctx->auth_data_left -= len;
 
-        /* Create a block with the encoded length. Block length is always 16 */
-        uint8_t auth_data_encoded[CCM_BLOCK_SIZE], len_encoding = 0;
+    return _absorb(ctx, auth_data, len);
+}
 
-        /* If 0 < l(a) < (2^16 - 2^8), then the length field is encoded as two
-         * octets. (RFC3610 page 2)
-         */
-        if (auth_data_len <= 0xFEFF) {
-            /* length (0x0001 ... 0xFEFF)  */
-            len_encoding = 2;
+int cipher_ccm_encrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output)
+{
+    return _crypt(ctx, input, len, output, false);
+}
 
-            auth_data_encoded[1] = auth_data_len & 0xFF;
-            auth_data_encoded[0] = (auth_data_len >> 8) & 0xFF;
-        }
-        else {
-            DEBUG("UNSUPPORTED Adata length: %" PRIu32 "\n", auth_data_len);
-            return -1;
-        }
+int cipher_ccm_decrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output)
+{
+    return _crypt(ctx, input, len, output, true);
+}
 
-        uint8_t auth_data_len_in_encoded =
-            (auth_data_len >=
-             (uint32_t)CCM_BLOCK_SIZE -
-             len_encoding) ? ((uint32_t)CCM_BLOCK_SIZE -
-                              len_encoding) :
-            auth_data_len;
-        memcpy(auth_data_encoded + len_encoding, auth_data,
-               auth_data_len_in_encoded);
-        /* Calculate the MAC over the first block of AAD + heading length encoding */
-        len = ccm_compute_cbc_mac(cipher, X1, auth_data_encoded,
-                                  auth_data_len_in_encoded + len_encoding, X1);
-
-        if (len < 0) {
-            return -1;
+int cipher_ccm_encrypt_iol(cipher_ccm_ctx_t *ctx, iolist_t *iol)
+{
+    for (; iol; iol = iol->iol_next) {
+        int res = _crypt(ctx, iol->iol_base, iol->iol_len, iol->iol_base,
+                         false);
+        if (res < 0) {
+            return res;
         }
+    }
 
-        /* Calculate the MAC for the remainder of the AAD (if there is one) */
-        if (auth_data_len_in_encoded < auth_data_len) {
-            len = ccm_compute_cbc_mac(cipher, X1,
-                                      auth_data + auth_data_len_in_encoded,
-                                      auth_data_len - auth_data_len_in_encoded,
-                                      X1);
-            if (len < 0) {
-                return -1;
-            }
+    return 0;
+}
+
+int cipher_ccm_decrypt_iol(cipher_ccm_ctx_t *ctx, iolist_t *iol)
+{
+    for (; iol; iol = iol->iol_next) {
+        int res = _crypt(ctx, iol->iol_base, iol->iol_len, iol->iol_base,
+                         true);
+        if (res < 0) {
+            return res;
         }
     }
 
     return 0;
 }
 
-
-/* Check if 'value' can be stored in 'num_bytes' */
-static inline int _fits_in_nbytes(size_t value, uint8_t num_bytes)
+int cipher_ccm_encrypt_finish(cipher_ccm_ctx_t *ctx, uint8_t *mac)
 {
-    /* Not allowed to shift more or equal than left operand width
-     * So we shift by maximum num bits of size_t -1 and compare to 1
-     */
-    unsigned shift = (8 * min(sizeof(size_t), num_bytes)) - 1;
+    int res = _finish(ctx);
 
-    return (value >> shift) <= 1;
+    if (res < 0) {
+        return res;
+    }
+    memcpy(mac, ctx->blocks, ctx->mac_length);
+
+    return 0;
 }
 
+int cipher_ccm_decrypt_finish(cipher_ccm_ctx_t *ctx, const uint8_t *mac)
+{
+    int res = _finish(ctx);
+
+    if (res < 0) {
+        return res;
+    }
+    if (!crypto_equals(mac, ctx->blocks, ctx->mac_length)) {
+        return CCM_ERR_INVALID_CBC_MAC;
+    }
+
+    return 0;
+}
 
 int cipher_encrypt_ccm(const cipher_t *cipher,
                        const uint8_t *auth_data, uint32_t auth_data_len,
@@ -182,65 +305,33 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
                        const uint8_t *input, size_t input_len,
                        uint8_t *output)
 {
-    int len = -1;
-    uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            stream_block[16] = { 0 }, zero_block[16] = { 0 }, block_size;
+    cipher_ccm_ctx_t ctx;
+    int res;
 
-    if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
-        return CCM_ERR_INVALID_MAC_LENGTH;
+    res = cipher_ccm_init(&ctx, cipher, mac_length, length_encoding,
+                          nonce, nonce_len, auth_data_len, input_len);
+    if (res < 0) {
+        return res;
     }
 
-    if (length_encoding < 2 || length_encoding > 8 ||
-        !_fits_in_nbytes(input_len, length_encoding)) {
-        return CCM_ERR_INVALID_LENGTH_ENCODING;
+    res = cipher_ccm_update_adata(&ctx, auth_data, auth_data_len);
+    if (res < 0) {
+        return res;
     }
 
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
-    block_size = cipher_get_block_size(cipher);
-    assert(block_size == CCM_BLOCK_SIZE);
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, input_len, mac_iv) < 0) {
-        return CCM_ERR_INVALID_DATA_LENGTH;
+    res = cipher_ccm_encrypt_update(&ctx, input, input_len, output);
+    if (res < 0) {
+        return res;
     }
 
-    /* MAC calculation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
-    if (len < 0) {
-        return len;
+    res = cipher_ccm_encrypt_finish(&ctx, output + input_len);
+    if (res < 0) {
+        return res;
     }
 
-    len = ccm_compute_cbc_mac(cipher, mac_iv, input, input_len, mac);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
-    memcpy(&nonce_counter[1], nonce,
-           min(nonce_len, (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size,
-                             zero_block, block_size, stream_block);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Encrypt message in counter mode  */
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             input_len, output);
-    if (len < 0) {
-        return len;
-    }
-
-    /* auth value: mac ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        output[len + i] = mac[i] ^ stream_block[i];
-    }
-
-    return len + mac_length;
+    return input_len + mac_length;
 }
 
-
 int cipher_decrypt_ccm(const cipher_t *cipher,
                        const uint8_t *auth_data, uint32_t auth_data_len,
                        uint8_t mac_length, uint8_t length_encoding,
@@ -248,12 +339,9 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
                        const uint8_t *input, size_t input_len,
                        uint8_t *plain)
 {
-    int len = -1;
-    uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            mac_recv[16] = { 0 }, stream_block[16] = { 0 },
-            zero_block[16] = { 0 },
-            block_size;
+    cipher_ccm_ctx_t ctx;
     size_t plain_len;
+    int res;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
@@ -264,50 +352,30 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
-    block_size = cipher_get_block_size(cipher);
-    assert(block_size == CCM_BLOCK_SIZE);
-    memcpy(&nonce_counter[1], nonce, min(nonce_len,
-                                         (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
-    if (len < 0) {
-        return len;
+    if (input_len < mac_length) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
     }
-
-    /* Decrypt message in counter mode */
     plain_len = input_len - mac_length;
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             plain_len, plain);
-    if (len < 0) {
-        return len;
-    }
 
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, plain_len, mac_iv) < 0) {
-        return CCM_ERR_INVALID_DATA_LENGTH;
+    res = cipher_ccm_init(&ctx, cipher, mac_length, length_encoding,
+                          nonce, nonce_len, auth_data_len, plain_len);
+    if (res < 0) {
+        return res;
     }
 
-    /* MAC calculation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
-    if (len < 0) {
-        return len;
-    }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, plain, plain_len, mac);
-    if (len < 0) {
-        return len;
+    res = cipher_ccm_update_adata(&ctx, auth_data, auth_data_len);
+    if (res < 0) {
+        return res;
     }
 
-    /* mac = input[plain_len...plain_len+mac_length] ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        mac_recv[i] = input[len + i] ^ stream_block[i];
+    res = cipher_ccm_decrypt_update(&ctx, input, plain_len, plain);
+    if (res < 0) {
+        return res;
     }
 
-    if (!crypto_equals(mac_recv, mac, mac_length)) {
-        return CCM_ERR_INVALID_CBC_MAC;
+    res = cipher_ccm_decrypt_finish(&ctx, input + plain_len);
+    if (res < 0) {
+        return res;
     }
 
     return plain_len;
@@ -18,35 +18,87 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
-int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
-                       uint8_t nonce_len, const uint8_t *input, size_t length,
-                       uint8_t *output)
+/* number of key stream blocks generated with a single cipher call */
+#define CTR_BATCH_BLOCKS    (4U)
+
+void cipher_ctr_init(cipher_ctr_ctx_t *ctx, const cipher_t *cipher,
+                     const uint8_t nonce_counter[16], uint8_t nonce_len)
 {
+    ctx->cipher = cipher;
+    memcpy(ctx->nonce_counter, nonce_counter, sizeof(ctx->nonce_counter));
+    ctx->nonce_len = nonce_len;
+    ctx->stream_pos = cipher_get_block_size(cipher);
+}
+
+int cipher_ctr_update(cipher_ctr_ctx_t *ctx, const uint8_t *input,
+                      size_t length, uint8_t *output)
+{
+    uint8_t block_size = cipher_get_block_size(ctx->cipher);
+    uint8_t ctr_len = block_size - ctx->nonce_len;
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
 
-    block_size = cipher_get_block_size(cipher);
-    do {
-        uint8_t block_size_input;
+    /* use up key stream left over from the previous chunk */
+    while (ctx->stream_pos < block_size && offset < length) {
+        output[offset] = input[offset] ^ ctx->stream_block[ctx->stream_pos++];
+        offset++;
+    }
+
+    /* full blocks, key stream is generated in batches */
+    while (length - offset >= block_size) {
+        uint8_t stream[CTR_BATCH_BLOCKS * CIPHER_MAX_BLOCK_SIZE];
+        size_t nblocks = (length - offset) / block_size;
 
-        if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        if (nblocks > CTR_BATCH_BLOCKS) {
+            nblocks = CTR_BATCH_BLOCKS;
+        }
+        for (unsigned i = 0; i < nblocks; i++) {
+            memcpy(&stream[i * block_size], ctx->nonce_counter, block_size);
+            crypto_block_inc_ctr(ctx->nonce_counter, ctr_len);
+        }
+        if (cipher_encrypt_blocks(ctx->cipher, stream, stream, nblocks) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
+        for (unsigned i = 0; i < nblocks * block_size; i++) {
+            output[offset + i] = input[offset + i] ^ stream[i];
+        }
+        offset += nblocks * block_size;
+    }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
+    /* partial block, the rest of the key stream is kept for the next chunk */
+    if (offset < length) {
+        if (cipher_encrypt(ctx->cipher, ctx->nonce_counter,
+                           ctx->stream_block) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+        crypto_block_inc_ctr(ctx->nonce_counter, ctr_len);
+        ctx->stream_pos = 0;
+        while (offset < length) {
+            output[offset] = input[offset] ^
+                             ctx->stream_block[ctx->stream_pos++];
+            offset++;
         }
+    }
+
+    return 0;
+}
+
+int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
+                       uint8_t nonce_len, const uint8_t *input, size_t length,
+                       uint8_t *output)
+{
+    cipher_ctr_ctx_t ctx;
+    int res;
 
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    } while (offset < length);
+    cipher_ctr_init(&ctx, cipher, nonce_counter, nonce_len);
+    res = cipher_ctr_update(&ctx, input, length, output);
+    memcpy(nonce_counter, ctx.nonce_counter, 16);
 
-    return offset;
+    return (res < 0) ? res : (int)length;
 }
 
 int cipher_decrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
@@ -103,13 +103,29 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
+    /* complete a partially filled block first */
+    for (; len && ctx->c_idx; data++, len--) {
+        _take_input(ctx, *data);
         if (ctx->c_idx == 16) {
             poly1305_block(ctx, 1);
             _clear_c(ctx);
         }
     }
+    /* full blocks are loaded directly */
+    for (; len >= POLY1305_BLOCK_SIZE; data += POLY1305_BLOCK_SIZE,
+                                       len -= POLY1305_BLOCK_SIZE) {
+        ctx->c[0] = u8to32(data);
+        ctx->c[1] = u8to32(data + 4);
+        ctx->c[2] = u8to32(data + 8);
+        ctx->c[3] = u8to32(data + 12);
+        poly1305_block(ctx, 1);
+    }
+    if (ctx->c_idx == 0) {
+        _clear_c(ctx);
+    }
+    for (; len; data++, len--) {
+        _take_input(ctx, *data);
+    }
 }
 
 void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
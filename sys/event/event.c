@@ -33,13 +33,85 @@
 #include "xtimer.h"
 #endif
 
+/* The event list is a clist extended by event_t::list_prev, so it is still
+ * a valid clist to iterate over, but events can be removed in O(1). All
+ * helpers must be called with IRQs disabled. */
+static inline event_t *_event(clist_node_t *node)
+{
+    return container_of(node, event_t, list_node);
+}
+
+static void _push(clist_node_t *list, event_t *event)
+{
+    clist_node_t *node = &event->list_node;
+    clist_node_t *tail = list->next;
+
+    if (tail == NULL) {
+        node->next = node;
+        event->list_prev = node;
+    }
+    else {
+        node->next = tail->next;
+        event->list_prev = tail;
+        _event(tail->next)->list_prev = node;
+        tail->next = node;
+    }
+    list->next = node;
+}
+
+static event_t *_pop(clist_node_t *list)
+{
+    clist_node_t *tail = list->next;
+
+    if (tail == NULL) {
+        return NULL;
+    }
+
+    clist_node_t *head = tail->next;
+
+    if (head == tail) {
+        list->next = NULL;
+    }
+    else {
+        tail->next = head->next;
+        _event(head->next)->list_prev = tail;
+    }
+    head->next = NULL;
+    return _event(head);
+}
+
+static void _remove(clist_node_t *list, event_t *event)
+{
+    clist_node_t *node = &event->list_node;
+
+    if (node->next == NULL) {
+        /* not queued */
+        return;
+    }
+    if (node->next == node) {
+        if (list->next == node) {
+            list->next = NULL;
+        }
+    }
+    else {
+        clist_node_t *prev = event->list_prev;
+
+        prev->next = node->next;
+        _event(node->next)->list_prev = prev;
+        if (list->next == node) {
+            list->next = prev;
+        }
+    }
+    node->next = NULL;
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
 
     unsigned state = irq_disable();
     if (!event->list_node.next) {
-        clist_rpush(&queue->event_list, &event->list_node);
+        _push(&queue->event_list, event);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -55,20 +127,16 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
-    clist_remove(&queue->event_list, &event->list_node);
-    event->list_node.next = NULL;
+    _remove(&queue->event_list, event);
     irq_restore(state);
 }
 
 event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
-    event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    event_t *result = _pop(&queue->event_list);
     irq_restore(state);
 
-    if (result) {
-        result->list_node.next = NULL;
-    }
     return result;
 }
 
@@ -80,8 +148,7 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
     do {
         unsigned state = irq_disable();
         for (size_t i = 0; i < n_queues; i++) {
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
+            result = _pop(&queues[i].event_list);
             if (result) {
                 break;
             }
@@ -92,7 +159,6 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
         }
     } while (result == NULL);
 
-    result->list_node.next = NULL;
     return result;
 }
 
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Event thread pool implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "event/pool.h"
+#include "irq.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define QUEUE_AFFINE    (0U)
+#define QUEUE_SHARED    (1U)
+
+static event_pool_event_t *_next(event_pool_worker_t *worker)
+{
+    event_pool_t *pool = worker->pool;
+    unsigned idx = worker - pool->workers;
+    event_t *event = event_get(&worker->queues[QUEUE_AFFINE]);
+
+    if (event == NULL) {
+        event = event_get(&worker->queues[QUEUE_SHARED]);
+    }
+    for (unsigned i = 1; (event == NULL) && (i < pool->numof); i++) {
+        event_pool_worker_t *other = &pool->workers[(idx + i) % pool->numof];
+
+        event = event_get(&other->queues[QUEUE_SHARED]);
+        if (event) {
+            worker->stats.stolen++;
+        }
+    }
+    return (event_pool_event_t *)event;
+}
+
+static void *_worker_thread(void *arg)
+{
+    event_pool_worker_t *worker = arg;
+
+    event_queues_claim(worker->queues, ARRAY_SIZE(worker->queues));
+
+    while (1) {
+        /* mark idle before the last look at the queues, so a post in between
+         * either finds this worker idle or sets the event flag */
+        worker->busy = false;
+        event_pool_event_t *event = _next(worker);
+
+        if (event == NULL) {
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
+            continue;
+        }
+        worker->busy = true;
+
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - event->posted;
+
+        worker->stats.handled++;
+        worker->stats.latency_sum += latency;
+        if (latency > worker->stats.latency_max) {
+            worker->stats.latency_max = latency;
+        }
+        event->super.handler(&event->super);
+    }
+
+    return NULL;
+}
+
+void event_pool_init(event_pool_t *pool, char *stacks, size_t stack_size,
+                     unsigned numof, unsigned priority)
+{
+    assert((numof > 0) && (numof <= CONFIG_EVENT_POOL_WORKERS_MAX));
+
+    memset(pool, 0, sizeof(*pool));
+    pool->numof = numof;
+    for (unsigned i = 0; i < numof; i++) {
+        event_pool_worker_t *worker = &pool->workers[i];
+
+        /* claimed by the worker thread, events may be posted before it
+         * runs */
+        event_queues_init_detached(worker->queues, ARRAY_SIZE(worker->queues));
+        worker->pool = pool;
+        worker->pid = thread_create(stacks + i * stack_size, stack_size,
+                                    priority, THREAD_CREATE_STACKTEST,
+                                    _worker_thread, worker, "event_pool");
+    }
+}
+
+void event_pool_post(event_pool_t *pool, event_pool_event_t *event)
+{
+    assert(pool && event);
+
+    unsigned state = irq_disable();
+
+    if (event->super.list_node.next) {
+        /* already queued */
+        irq_restore(state);
+        return;
+    }
+
+    event_pool_worker_t *target = NULL;
+    event_pool_worker_t *idle = NULL;
+
+    for (unsigned i = 0; i < pool->numof; i++) {
+        unsigned idx = (pool->next + i) % pool->numof;
+        event_pool_worker_t *worker = &pool->workers[idx];
+
+        if ((event->affinity != EVENT_POOL_AFFINITY_ANY) &&
+            !(event->affinity & EVENT_POOL_AFFINITY(idx))) {
+            continue;
+        }
+        if (target == NULL) {
+            /* first allowed worker in turn, used if all are busy */
+            target = worker;
+        }
+        if (!worker->busy) {
+            idle = worker;
+            break;
+        }
+    }
+    assert(target != NULL);
+    if (idle) {
+        target = idle;
+    }
+    pool->next = ((target - pool->workers) + 1) % pool->numof;
+    irq_restore(state);
+
+    event->posted = ztimer_now(ZTIMER_USEC);
+
+    if (event->affinity != EVENT_POOL_AFFINITY_ANY) {
+        event_post(&target->queues[QUEUE_AFFINE], &event->super);
+        return;
+    }
+    event_post(&target->queues[QUEUE_SHARED], &event->super);
+
+    if (idle == NULL) {
+        /* wake up a worker that became idle meanwhile to steal the event */
+        for (unsigned i = 0; i < pool->numof; i++) {
+            event_pool_worker_t *worker = &pool->workers[i];
+
+            if (!worker->busy && (worker->pid > KERNEL_PID_UNDEF)) {
+                thread_flags_set(thread_get(worker->pid), THREAD_FLAG_EVENT);
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Event task implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "event/task.h"
+
+static void _handler(event_t *event)
+{
+    event_task_t *task = container_of(event, event_task_t, super);
+
+    if (task->run == NULL) {
+        /* woken up after it finished */
+        return;
+    }
+    if (task->run(task) == EVENT_TASK_DONE) {
+        event_task_clear_timeout(task);
+        /* done may restart the task */
+        task->run = NULL;
+        if (task->done) {
+            task->done(task);
+        }
+    }
+}
+
+static void _timeout_cb(void *arg)
+{
+    event_task_t *task = arg;
+
+    task->timed_out = true;
+    event_task_wake(task);
+}
+
+void event_task_start(event_task_t *task, event_queue_t *queue,
+                      event_task_run_t run, event_task_done_t done)
+{
+    assert(task && queue && run);
+    /* restarting a running task would lose its waits and timer */
+    assert(task->run == NULL);
+
+    if (task->super.list_node.next) {
+        /* woken up after it finished, drop the wake-up before the event is
+         * reused */
+        event_cancel(task->queue, &task->super);
+    }
+    task->super.handler = _handler;
+    task->queue = queue;
+    task->run = run;
+    task->done = done;
+    task->clock = NULL;
+    task->timer.callback = _timeout_cb;
+    task->timer.arg = task;
+    task->timed_out = false;
+    task->lc = 0;
+    event_post(queue, &task->super);
+}
+
+void event_task_set_timeout(event_task_t *task, ztimer_clock_t *clock,
+                            uint32_t duration)
+{
+    event_task_clear_timeout(task);
+    task->clock = clock;
+    ztimer_set(clock, &task->timer, duration);
+}
+
+void event_task_clear_timeout(event_task_t *task)
+{
+    if (task->clock) {
+        ztimer_remove(task->clock, &task->timer);
+        task->clock = NULL;
+    }
+    task->timed_out = false;
+}
@@ -85,6 +85,26 @@ void *sha256(const void *data, size_t len, void *digest)
     return digest;
 }
 
+void sha256_update_multi(sha256_context_t *const ctx[], const void *const data[],
+                         size_t len, unsigned num)
+{
+    for (unsigned i = 0; i < num; i++) {
+        sha2xx_update(ctx[i], data[i], len);
+    }
+}
+
+void sha256_multi(const void *const data[], size_t len, void *const digest[],
+                  unsigned num)
+{
+    sha256_context_t c;
+
+    for (unsigned i = 0; i < num; i++) {
+        sha256_init(&c);
+        sha2xx_update(&c, data[i], len);
+        sha256_final(&c, digest[i]);
+    }
+}
+
 
 void hmac_sha256_init(hmac_context_t *ctx, const void *key, size_t key_length)
 {
@@ -117,14 +137,16 @@ void hmac_sha256_init(hmac_context_t *ctx, const void *key, size_t key_length)
      * tmp = hash(i_key_pad CONCAT message)
      */
     sha256_init(&ctx->c_in);
-    sha2xx_update(&ctx->c_in, i_key_pad, SHA256_INTERNAL_BLOCK_SIZE);
 
     /*
      * Initiate calculation of the outer hash
      * result = hash(o_key_pad CONCAT tmp)
      */
     sha256_init(&ctx->c_out);
-    sha2xx_update(&ctx->c_out, o_key_pad, SHA256_INTERNAL_BLOCK_SIZE);
+
+    sha256_context_t *const c[] = { &ctx->c_in, &ctx->c_out };
+    const void *const pads[] = { i_key_pad, o_key_pad };
+    sha256_update_multi(c, pads, SHA256_INTERNAL_BLOCK_SIZE, 2);
 
 }
 
@@ -50,6 +50,7 @@
 #include <assert.h>
 
 #include "hashes/sha2xx_common.h"
+#include "kernel_defines.h"
 
 
 #ifdef __BIG_ENDIAN__
@@ -97,42 +98,80 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+/* One round, the roles of the working variables rotate from round to round
+ * instead of the variables themselves */
+#define RND(a, b, c, d, e, f, g, h, k, w) \
+    do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + (k) + (w); \
+        uint32_t t1 = S0(a) + Maj(a, b, c); \
+        d += t0; \
+        h = t0 + t1; \
+    } while (0)
+
+/* Message schedule word j of the first 16 rounds */
+#define W_IN(W, j)      (W[j])
+
+/* Message schedule word j of later rounds, computed in place over a window of
+ * the last 16 words */
+#define W_NEXT(W, j)    (W[(j) & 15] += s1(W[((j) + 14) & 15]) + \
+                                        W[((j) + 9) & 15] + \
+                                        s0(W[((j) + 1) & 15]))
+
+/* 16 rounds, i is the number of the first round */
+#define RND16(i, W, WX) \
+    do { \
+        RND(a, b, c, d, e, f, g, h, K[(i) + 0], WX(W, 0)); \
+        RND(h, a, b, c, d, e, f, g, K[(i) + 1], WX(W, 1)); \
+        RND(g, h, a, b, c, d, e, f, K[(i) + 2], WX(W, 2)); \
+        RND(f, g, h, a, b, c, d, e, K[(i) + 3], WX(W, 3)); \
+        RND(e, f, g, h, a, b, c, d, K[(i) + 4], WX(W, 4)); \
+        RND(d, e, f, g, h, a, b, c, K[(i) + 5], WX(W, 5)); \
+        RND(c, d, e, f, g, h, a, b, K[(i) + 6], WX(W, 6)); \
+        RND(b, c, d, e, f, g, h, a, K[(i) + 7], WX(W, 7)); \
+        RND(a, b, c, d, e, f, g, h, K[(i) + 8], WX(W, 8)); \
+        RND(h, a, b, c, d, e, f, g, K[(i) + 9], WX(W, 9)); \
+        RND(g, h, a, b, c, d, e, f, K[(i) + 10], WX(W, 10)); \
+        RND(f, g, h, a, b, c, d, e, K[(i) + 11], WX(W, 11)); \
+        RND(e, f, g, h, a, b, c, d, K[(i) + 12], WX(W, 12)); \
+        RND(d, e, f, g, h, a, b, c, K[(i) + 13], WX(W, 13)); \
+        RND(c, d, e, f, g, h, a, b, K[(i) + 14], WX(W, 14)); \
+        RND(b, c, d, e, f, g, h, a, K[(i) + 15], WX(W, 15)); \
+    } while (0)
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
 static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
 {
-    uint32_t W[64];
-    uint32_t S[8];
-
-    /* 1. Prepare message schedule W. */
-    be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
-    }
-
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
+    uint32_t W[16];
 
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
+    /* 1. Initialize working variables. */
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
-
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
-    }
-
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
+    /* 2. Mix, expanding the message schedule on the fly. */
+    be32dec_vect(W, block, 64);
+    RND16(0, W, W_IN);
+#if IS_ACTIVE(CONFIG_HASHES_SHA2XX_UNROLL)
+    RND16(16, W, W_NEXT);
+    RND16(32, W, W_NEXT);
+    RND16(48, W, W_NEXT);
+#else
+    for (unsigned i = 16; i < 64; i += 16) {
+        RND16(i, W, W_NEXT);
     }
+#endif
+
+    /* 3. Mix local working variables into global state */
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
 }
 
 static unsigned char PAD[64] = {
@@ -22,6 +22,10 @@
  *              does (and is thus also for more memory efficient). Its caveat
  *              however is that it is slower by about factor 8 than this version.
  *
+ *              The throughput can be increased further by processing several
+ *              bytes per step with additional look-up tables of 512 bytes each
+ *              ("slicing-by-N"), see @ref CONFIG_CRC16_CCITT_SLICES.
+ *
  * @{
  * @file
  * @author      Ludwig Knüpfer <ludwig.knuepfer@fu-berlin.de>
@@ -37,6 +41,23 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup sys_checksum_crc16_ccitt_conf CRC16-CCITT compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of bytes processed per step
+ *
+ * Must be 1, 4 or 8. Each step beyond the first byte needs another look-up
+ * table of 512 bytes in ROM, i.e. slicing-by-4 uses 2 KiB and slicing-by-8
+ * 4 KiB of tables instead of 512 bytes.
+ */
+#ifndef CONFIG_CRC16_CCITT_SLICES
+#define CONFIG_CRC16_CCITT_SLICES   1
+#endif
+/** @} */
+
 /**
  * @brief           Update CRC16-CCITT
  *
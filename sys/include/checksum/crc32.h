@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_checksum_crc32 CRC-32
+ * @ingroup     sys_checksum
+ * @brief       CRC-32 checksum algorithms
+ *
+ * This module provides two flavors of CRC-32:
+ *
+ * - CRC-32 as used by IEEE 802.3 (Ethernet), zlib and PNG, with the
+ *   polynomial 0x04c11db7
+ * - CRC-32C (Castagnoli) as used by iSCSI, SCTP and ext4, with the
+ *   polynomial 0x1edc6f41, which has better error detection properties
+ *
+ * Both use reflected input and output, a start value of `0xffffffff` and an
+ * inverted result. The inversion is handled internally, so a checksum over
+ * data that is available in several parts is calculated by passing the
+ * result of the previous call to the update function:
+ *
+ * ```
+ * uint32_t crc = crc32_ieee_calc(hdr, sizeof(hdr));
+ * crc = crc32_ieee_update(crc, payload, payload_len);
+ * ```
+ *
+ * The implementation is table driven. Processing several bytes per step
+ * ("slicing-by-N") trades ROM for speed, see @ref CONFIG_CRC32_SLICES.
+ * If the compiler targets an x86 CPU with SSE4.2, CRC-32C is calculated with
+ * the `crc32` instruction instead.
+ *
+ * @{
+ * @file
+ */
+
+#ifndef CHECKSUM_CRC32_H
+#define CHECKSUM_CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_checksum_crc32_conf CRC-32 compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of bytes processed per step
+ *
+ * Must be 1, 4 or 8. Every polynomial in use needs one look-up table of
+ * 1 KiB in ROM per byte processed per step.
+ */
+#ifndef CONFIG_CRC32_SLICES
+#define CONFIG_CRC32_SLICES     1
+#endif
+/** @} */
+
+/**
+ * @brief           Update CRC-32 (IEEE 802.3)
+ *
+ * @param[in]  crc  Checksum of the preceding data, as returned by
+ *                  crc32_ieee_calc() or crc32_ieee_update(), 0 to start
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the preceding data and the memory area
+ */
+uint32_t crc32_ieee_update(uint32_t crc, const void *buf, size_t len);
+
+/**
+ * @brief           Calculate CRC-32 (IEEE 802.3)
+ *
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the specified memory area
+ */
+static inline uint32_t crc32_ieee_calc(const void *buf, size_t len)
+{
+    return crc32_ieee_update(0, buf, len);
+}
+
+/**
+ * @brief           Update CRC-32C (Castagnoli)
+ *
+ * @param[in]  crc  Checksum of the preceding data, as returned by
+ *                  crc32c_calc() or crc32c_update(), 0 to start
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the preceding data and the memory area
+ */
+uint32_t crc32c_update(uint32_t crc, const void *buf, size_t len);
+
+/**
+ * @brief           Calculate CRC-32C (Castagnoli)
+ *
+ * @param[in]  buf  Start of the memory area to checksum
+ * @param[in]  len  Number of bytes to checksum
+ *
+ * @return          Checksum of the specified memory area
+ */
+static inline uint32_t crc32c_calc(const void *buf, size_t len)
+{
+    return crc32c_update(0, buf, len);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_CRC32_H */
+/** @} */
@@ -106,6 +106,26 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   encrypts @p nblocks consecutive blocks of plaintext in ECB mode
+ *
+ * Unlike calling @ref aes_encrypt for each block, the key schedule is
+ * computed only once.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       input         a pointer to @p nblocks blocks of plaintext
+ * @param       output        a pointer to the place where the ciphertext will
+ *                            be stored, may be equal to @p input
+ * @param       nblocks       number of blocks to encrypt
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t nblocks);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
@@ -17,6 +17,24 @@
  * Nonces must be unique per message for a single key. They are allowed to be
  * predictable, e.g. a message counter and are allowed to be visible during
  * transmission.
+ *
+ * Besides the one shot functions, an incremental interface is provided to
+ * process messages that are not available in a single buffer, e.g. when they
+ * are received in fragments:
+ *
+ * ```
+ * chacha20poly1305_stream_ctx_t ctx;
+ *
+ * chacha20poly1305_init(&ctx, key, nonce);
+ * chacha20poly1305_update_aad(&ctx, aad, aadlen);
+ * chacha20poly1305_encrypt_update(&ctx, msg, cipher, len1);
+ * chacha20poly1305_encrypt_update(&ctx, msg + len1, cipher + len1, len2);
+ * chacha20poly1305_encrypt_finish(&ctx, tag);
+ * ```
+ *
+ * Key stream generation and the MAC are done in a single pass over the
+ * message, so that each chunk is still in cache (or registers) when it is
+ * authenticated.
  * @{
  *
  * @file
@@ -28,6 +46,9 @@
 #ifndef CRYPTO_CHACHA20POLY1305_H
 #define CRYPTO_CHACHA20POLY1305_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "crypto/poly1305.h"
 
 #ifdef __cplusplus
@@ -37,6 +58,7 @@ extern "C" {
 #define CHACHA20POLY1305_KEY_BYTES      (32U)   /**< Key length in bytes */
 #define CHACHA20POLY1305_NONCE_BYTES    (12U)   /**< Nonce length in bytes */
 #define CHACHA20POLY1305_TAG_BYTES      (16U)   /**< Tag length in bytes */
+#define CHACHA20POLY1305_BLOCK_BYTES    (64U)   /**< Key stream block length in bytes */
 
 /**
  * @brief Chacha20poly1305 state struct
@@ -50,6 +72,19 @@ typedef union {
     poly1305_ctx_t poly;    /**< Poly1305 state for the MAC */
 } chacha20poly1305_ctx_t;
 
+/**
+ * @brief Chacha20poly1305 context for incremental processing
+ */
+typedef struct {
+    poly1305_ctx_t poly;    /**< Poly1305 state for the MAC */
+    uint32_t input[16];     /**< Chacha20 input block, including the counter */
+    uint32_t stream[16];    /**< Current key stream block */
+    uint64_t aadlen;        /**< Length of the additional data */
+    uint64_t msglen;        /**< Length of the message */
+    uint8_t stream_pos;     /**< Position of the next unused key stream byte */
+    bool aad_done;          /**< Additional data is complete */
+} chacha20poly1305_stream_ctx_t;
+
 /**
  * @brief Encrypt a plaintext to ciphertext and append a tag to protect the
  * ciphertext and additional data.
@@ -96,6 +131,88 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              const uint8_t *aad, size_t aadlen,
                              const uint8_t *key, const uint8_t *nonce);
 
+/**
+ * @brief Start the incremental encryption or decryption of a message
+ *
+ * @param[out]  ctx         context to initialize
+ * @param[in]   key         key to use, must be CHACHA20POLY1305_KEY_BYTES long
+ * @param[in]   nonce       Nonce to use. Must be CHACHA20POLY1305_NONCE_BYTES
+ *                          long
+ */
+void chacha20poly1305_init(chacha20poly1305_stream_ctx_t *ctx,
+                           const uint8_t *key, const uint8_t *nonce);
+
+/**
+ * @brief Add additional authenticated data
+ *
+ * May be called multiple times, but not after the first call to
+ * @ref chacha20poly1305_encrypt_update or
+ * @ref chacha20poly1305_decrypt_update.
+ *
+ * @param[inout] ctx        context
+ * @param[in]    aad        additional authenticated data
+ * @param[in]    len        length of @p aad
+ */
+void chacha20poly1305_update_aad(chacha20poly1305_stream_ctx_t *ctx,
+                                 const uint8_t *aad, size_t len);
+
+/**
+ * @brief Encrypt the next part of a message
+ *
+ * It is allowed to have cipher == msg.
+ *
+ * @param[inout] ctx        context
+ * @param[in]    msg        plaintext
+ * @param[out]   cipher     ciphertext, same length as @p msg
+ * @param[in]    len        length of @p msg
+ */
+void chacha20poly1305_encrypt_update(chacha20poly1305_stream_ctx_t *ctx,
+                                     const uint8_t *msg, uint8_t *cipher,
+                                     size_t len);
+
+/**
+ * @brief Finish the encryption and compute the tag
+ *
+ * The context is wiped afterwards.
+ *
+ * @param[inout] ctx        context
+ * @param[out]   tag        authentication tag, CHACHA20POLY1305_TAG_BYTES long
+ */
+void chacha20poly1305_encrypt_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *tag);
+
+/**
+ * @brief Decrypt the next part of a message
+ *
+ * It is allowed to have cipher == msg.
+ *
+ * @warning The plaintext must not be used before
+ *          @ref chacha20poly1305_decrypt_finish confirmed that the message
+ *          is authentic.
+ *
+ * @param[inout] ctx        context
+ * @param[in]    cipher     ciphertext, without the tag
+ * @param[out]   msg        plaintext, same length as @p cipher
+ * @param[in]    len        length of @p cipher
+ */
+void chacha20poly1305_decrypt_update(chacha20poly1305_stream_ctx_t *ctx,
+                                     const uint8_t *cipher, uint8_t *msg,
+                                     size_t len);
+
+/**
+ * @brief Finish the decryption and verify the tag
+ *
+ * The context is wiped afterwards.
+ *
+ * @param[inout] ctx        context
+ * @param[in]    tag        received tag, CHACHA20POLY1305_TAG_BYTES long
+ *
+ * @return  1 if the message is authentic
+ * @return  0 if the tag does not match
+ */
+int chacha20poly1305_decrypt_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                    const uint8_t *tag);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -91,6 +92,16 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief the multi-block encrypt function, may be NULL
+     *
+     * Encrypts @p nblocks independent blocks (ECB). Implementations can
+     * use this to set up the key or a hardware engine only once per call
+     * and to pipeline blocks. If NULL, encrypt is called per block.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t nblocks);
 } cipher_interface_t;
 
 
@@ -147,6 +158,29 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
 
+/**
+ * @brief Encrypt multiple consecutive blocks of BLOCK_SIZE length
+ *
+ * Every block is encrypted on its own, as in ECB mode. This is the building
+ * block for modes that need several independent block encryptions at once,
+ * e.g. to generate CTR key stream. Ciphers backed by a hardware engine
+ * should implement @ref cipher_interface_t::encrypt_blocks to handle all
+ * blocks with a single request.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p nblocks blocks of input data to encrypt
+ * @param output     pointer to allocated memory for encrypted data. It has to
+ *                   be of size @p nblocks * BLOCK_SIZE and may be equal to
+ *                   @p input
+ * @param nblocks    number of blocks to encrypt
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t nblocks);
+
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
@@ -21,6 +21,7 @@
 #define CRYPTO_MODES_CCM_H
 
 #include "crypto/ciphers.h"
+#include "iolist.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +48,157 @@ extern "C" {
  */
 #define CCM_MAC_MAX_LEN                     16
 
+/**
+ * @brief Context for incremental CCM operations
+ *
+ * CCM needs to know the length of the additional data and of the payload
+ * up front, but both may be passed in chunks of any size. The CBC-MAC of
+ * each payload block is computed together with the key stream of the next
+ * block by a single call to @ref cipher_encrypt_blocks.
+ */
+typedef struct {
+    const cipher_t *cipher;             /**< cipher to use */
+    uint8_t blocks[2 * CCM_BLOCK_SIZE]; /**< CBC-MAC state followed by the
+                                             current key stream block */
+    uint8_t ctr[CCM_BLOCK_SIZE];        /**< next counter block */
+    size_t input_left;                  /**< payload bytes still expected */
+    uint16_t auth_data_left;            /**< additional data bytes still
+                                             expected */
+    uint8_t mac_pos;                    /**< bytes absorbed into the current
+                                             CBC-MAC block */
+    uint8_t stream_pos;                 /**< used bytes of the key stream */
+    uint8_t mac_length;                 /**< length of the MAC */
+    uint8_t length_encoding;            /**< length of the counter field */
+} cipher_ccm_ctx_t;
+
+/**
+ * @brief Start an incremental CCM operation
+ *
+ * @param ctx              Context to initialize
+ * @param cipher           Already initialized cipher struct, has to be valid
+ *                         until the operation is complete
+ * @param mac_length       length of the MAC (between 4 and 16 - only even
+ *                         values)
+ * @param length_encoding  maximal supported length of plaintext
+ *                         (2^(8*length_enc)).
+ * @param nonce            Nounce for ctr mode encryption
+ * @param nonce_len        Length of the nonce in octets
+ *                         (maximum: 15-length_encoding)
+ * @param auth_data_len    Total length of additional data, max (2^16 - 2^8)
+ * @param input_len        Total length of the plaintext, without the MAC
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_init(cipher_ccm_ctx_t *ctx, const cipher_t *cipher,
+                    uint8_t mac_length, uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len,
+                    uint32_t auth_data_len, size_t input_len);
+
+/**
+ * @brief Add additional data to authenticate
+ *
+ * All additional data has to be added before the payload.
+ *
+ * @param ctx              Context of the operation
+ * @param auth_data        Additional data
+ * @param len              Length of @p auth_data
+ *
+ * @return                 0 on success
+ * @return                 CIPHER_ERR_INVALID_LENGTH if more additional data
+ *                         is added than announced to @ref cipher_ccm_init
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_update_adata(cipher_ccm_ctx_t *ctx, const uint8_t *auth_data,
+                            size_t len);
+
+/**
+ * @brief Encrypt the next chunk of plaintext
+ *
+ * @param ctx              Context of the operation
+ * @param input            Plaintext
+ * @param len              Length of @p input
+ * @param output           Memory for @p len bytes of ciphertext, may be equal
+ *                         to @p input
+ *
+ * @return                 0 on success
+ * @return                 CIPHER_ERR_INVALID_LENGTH if additional data is
+ *                         missing or more payload is passed than announced
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_encrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output);
+
+/**
+ * @brief Decrypt the next chunk of ciphertext
+ *
+ * The decrypted data must not be used before @ref cipher_ccm_decrypt_finish
+ * succeeded.
+ *
+ * @param ctx              Context of the operation
+ * @param input            Ciphertext, without the MAC
+ * @param len              Length of @p input
+ * @param output           Memory for @p len bytes of plaintext, may be equal
+ *                         to @p input
+ *
+ * @return                 0 on success
+ * @return                 CIPHER_ERR_INVALID_LENGTH if additional data is
+ *                         missing or more payload is passed than announced
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_decrypt_update(cipher_ccm_ctx_t *ctx, const uint8_t *input,
+                              size_t len, uint8_t *output);
+
+/**
+ * @brief Encrypt all buffers of an iolist in place
+ *
+ * @param ctx              Context of the operation
+ * @param iol              Plaintext to encrypt
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_encrypt_iol(cipher_ccm_ctx_t *ctx, iolist_t *iol);
+
+/**
+ * @brief Decrypt all buffers of an iolist in place
+ *
+ * @param ctx              Context of the operation
+ * @param iol              Ciphertext to decrypt, without the MAC
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_decrypt_iol(cipher_ccm_ctx_t *ctx, iolist_t *iol);
+
+/**
+ * @brief Complete an incremental encryption
+ *
+ * @param ctx              Context of the operation
+ * @param mac              Memory for the MAC of length
+ *                         cipher_ccm_ctx_t::mac_length
+ *
+ * @return                 0 on success
+ * @return                 CIPHER_ERR_INVALID_LENGTH if less data than
+ *                         announced was passed
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_encrypt_finish(cipher_ccm_ctx_t *ctx, uint8_t *mac);
+
+/**
+ * @brief Complete an incremental decryption and verify the MAC
+ *
+ * @param ctx              Context of the operation
+ * @param mac              Received MAC of length cipher_ccm_ctx_t::mac_length
+ *
+ * @return                 0 if the MAC is valid
+ * @return                 CCM_ERR_INVALID_CBC_MAC if the MAC is invalid
+ * @return                 CIPHER_ERR_INVALID_LENGTH if less data than
+ *                         announced was passed
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_decrypt_finish(cipher_ccm_ctx_t *ctx, const uint8_t *mac);
+
 /**
  * @brief Encrypt and authenticate data of arbitrary length in ccm mode.
  *
@@ -26,6 +26,49 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Context for incremental counter mode operations
+ */
+typedef struct {
+    const cipher_t *cipher;                         /**< cipher to use */
+    uint8_t nonce_counter[CIPHER_MAX_BLOCK_SIZE];   /**< next counter block */
+    uint8_t stream_block[CIPHER_MAX_BLOCK_SIZE];    /**< current key stream */
+    uint8_t nonce_len;                              /**< length of the nonce */
+    uint8_t stream_pos;                             /**< used bytes of
+                                                         @p stream_block */
+} cipher_ctr_ctx_t;
+
+/**
+ * @brief Start an incremental counter mode operation
+ *
+ * @param ctx           Context to initialize
+ * @param cipher        Already initialized cipher struct, has to be valid
+ *                      until the operation is complete
+ * @param nonce_counter Nonce and initial counter value, see
+ *                      @ref cipher_encrypt_ctr
+ * @param nonce_len     Length of the nonce in octets
+ */
+void cipher_ctr_init(cipher_ctr_ctx_t *ctx, const cipher_t *cipher,
+                     const uint8_t nonce_counter[16], uint8_t nonce_len);
+
+/**
+ * @brief Encrypt or decrypt the next chunk of data in counter mode
+ *
+ * Chunks may be of any length. Full blocks of key stream are generated
+ * several at once with @ref cipher_encrypt_blocks.
+ *
+ * @param ctx           Context of the operation
+ * @param input         pointer to input data
+ * @param length        length of the input data
+ * @param output        pointer to allocated memory of size @p length for the
+ *                      output data, may be equal to @p input
+ *
+ * @return              0 on success
+ * @return              A negative error code if something went wrong
+ */
+int cipher_ctr_update(cipher_ctr_ctx_t *ctx, const uint8_t *input,
+                      size_t length, uint8_t *output);
+
 /**
  * @brief Encrypt data of arbitrary length in counter mode.
  *
@@ -147,6 +147,14 @@ typedef void (*event_handler_t)(event_t *);
 struct event {
     clist_node_t list_node;     /**< event queue list entry             */
     event_handler_t handler;    /**< pointer to event handler function  */
+    /**
+     * @brief   Previous entry in the event queue list
+     *
+     * Only valid while the event is queued. Together with
+     * event_t::list_node it makes the list doubly linked, so an event can
+     * be canceled in O(1).
+     */
+    clist_node_t *list_prev;
 };
 
 /**
@@ -265,9 +273,10 @@ void event_post(event_queue_t *queue, event_t *event);
 /**
  * @brief   Cancel a queued event
  *
- * This will remove a queued event from an event queue.
+ * This will remove a queued event from an event queue in O(1). Canceling an
+ * event that is not queued has no effect.
  *
- * @note    Due to the underlying list implementation, this will run in O(n).
+ * @pre     @p event is not queued in any other queue than @p queue
  *
  * @param[in]   queue   event queue to remove event from
  * @param[in]   event   event to remove from queue
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides a pool of event handler threads
+ *
+ * An event queue is handled by a single thread, so a long running handler
+ * delays all events queued after it. An @ref event_pool_t runs a number of
+ * worker threads instead. Every worker has its own queue:
+ *
+ * - Events are posted to the queue of an idle worker, if there is one, and
+ *   to the queues of the busy workers in turn otherwise.
+ * - A worker that runs out of events takes (steals) the oldest event of
+ *   another worker's queue before waiting for new events.
+ *
+ * The affinity of an event (@ref event_pool_event_t::affinity) restricts
+ * the workers it may run on. An event with an affinity is posted to a
+ * worker of that set and is never stolen, so e.g. handlers sharing state
+ * without locking can be pinned to the same worker.
+ *
+ * For each worker the number of handled and stolen events and the time
+ * from posting an event to running its handler is accounted in
+ * @ref event_pool_stats_t.
+ *
+ * @note    On a single core handlers only run in parallel if the workers
+ *          can preempt each other, e.g. by using `sched_round_robin` with
+ *          workers of the same priority or by blocking handlers.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static char stacks[3][THREAD_STACKSIZE_DEFAULT];
+ * static event_pool_t pool;
+ * static event_pool_event_t event = EVENT_POOL_EVENT_INIT(handler, 0);
+ *
+ * [...]
+ * event_pool_init(&pool, stacks[0], sizeof(stacks[0]), 3,
+ *                 THREAD_PRIORITY_MAIN - 1);
+ * event_pool_post(&pool, &event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event thread pool API
+ */
+
+#ifndef EVENT_POOL_H
+#define EVENT_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of workers of an @ref event_pool_t
+ */
+#ifndef CONFIG_EVENT_POOL_WORKERS_MAX
+#define CONFIG_EVENT_POOL_WORKERS_MAX   (4U)
+#endif
+
+/**
+ * @brief   Affinity of an event that may run on any worker
+ */
+#define EVENT_POOL_AFFINITY_ANY         (0U)
+
+/**
+ * @brief   Affinity of an event that may only run on worker @p n
+ */
+#define EVENT_POOL_AFFINITY(n)          (1U << (n))
+
+/**
+ * @brief   Event to be handled by an @ref event_pool_t
+ */
+typedef struct {
+    event_t super;          /**< event_t structure that gets extended */
+    uint32_t posted;        /**< time in us the event was posted at,
+                                 set by @ref event_pool_post() */
+    /**
+     * @brief   Bit mask of the workers the event may run on, or
+     *          @ref EVENT_POOL_AFFINITY_ANY
+     */
+    uint8_t affinity;
+} event_pool_event_t;
+
+/**
+ * @brief   Statistics of a worker of an @ref event_pool_t
+ */
+typedef struct {
+    uint32_t handled;       /**< events handled by the worker */
+    uint32_t stolen;        /**< events taken from the queue of another worker */
+    uint32_t latency_max;   /**< maximum time in us from post to handling */
+    uint64_t latency_sum;   /**< sum of the times in us from post to handling */
+} event_pool_stats_t;
+
+/**
+ * @brief   Event thread pool forward declaration
+ */
+typedef struct event_pool event_pool_t;
+
+/**
+ * @brief   A worker of an @ref event_pool_t
+ */
+typedef struct {
+    /**
+     * @brief   Queue of the worker
+     *
+     * Events with affinity are queued at index 0, events other workers may
+     * steal at index 1.
+     */
+    event_queue_t queues[2];
+    event_pool_t *pool;             /**< pool the worker belongs to */
+    kernel_pid_t pid;               /**< PID of the worker thread */
+    volatile bool busy;             /**< worker is handling events */
+    event_pool_stats_t stats;       /**< statistics of the worker */
+} event_pool_worker_t;
+
+/**
+ * @brief   Event thread pool
+ */
+struct event_pool {
+    /**
+     * @brief   The workers of the pool
+     */
+    event_pool_worker_t workers[CONFIG_EVENT_POOL_WORKERS_MAX];
+    uint8_t numof;                  /**< number of workers */
+    uint8_t next;                   /**< worker to post to next when all are busy */
+};
+
+/**
+ * @brief   Event pool event static initializer
+ *
+ * @param[in]   _handler    event handler to set
+ * @param[in]   _affinity   affinity of the event
+ */
+#define EVENT_POOL_EVENT_INIT(_handler, _affinity) \
+    { \
+        .super.handler = _handler, \
+        .affinity = _affinity \
+    }
+
+/**
+ * @brief   Initialize an event pool and start its workers
+ *
+ * @pre     0 < @p numof <= @ref CONFIG_EVENT_POOL_WORKERS_MAX
+ *
+ * @param[out]  pool        event pool to initialize
+ * @param[in]   stacks      stack space of @p numof * @p stack_size bytes
+ * @param[in]   stack_size  size of the stack of a worker
+ * @param[in]   numof       number of workers
+ * @param[in]   priority    priority of the workers
+ */
+void event_pool_init(event_pool_t *pool, char *stacks, size_t stack_size,
+                     unsigned numof, unsigned priority);
+
+/**
+ * @brief   Queue an event in an event pool
+ *
+ * As with @ref event_post(), posting an event that is already queued has no
+ * effect.
+ *
+ * @param[in]   pool        event pool to queue the event in
+ * @param[in]   event       event to queue
+ */
+void event_pool_post(event_pool_t *pool, event_pool_event_t *event);
+
+/**
+ * @brief   Get the statistics of a worker of an event pool
+ *
+ * @param[in]   pool        event pool
+ * @param[in]   worker      index of the worker
+ *
+ * @return  statistics of the worker
+ */
+static inline const event_pool_stats_t *event_pool_stats(const event_pool_t *pool,
+                                                         unsigned worker)
+{
+    assert(worker < pool->numof);
+    return &pool->workers[worker].stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_POOL_H */
+/** @} */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides an event queue with priority bands
+ *
+ * An @ref event_prio_queue_t holds @ref CONFIG_EVENT_PRIO_BANDS event queues
+ * handled by one thread. Events are posted to a band and the bands are
+ * drained in priority order: an event is only taken from a band if all
+ * bands of higher priority (lower index) are empty. Within a band events are
+ * handled in FIFO order.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_prio_queue_t queue;
+ *
+ * [...]
+ * event_prio_queue_init(&queue);
+ * event_prio_post(&queue, EVENT_PRIO_BAND_LOW, &bulk_event);
+ * event_prio_post(&queue, EVENT_PRIO_BAND_HIGH, &rx_event);
+ * // rx_event is handled first
+ * event_prio_loop(&queue);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event priority queue API
+ */
+
+#ifndef EVENT_PRIO_H
+#define EVENT_PRIO_H
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of priority bands of an @ref event_prio_queue_t
+ */
+#ifndef CONFIG_EVENT_PRIO_BANDS
+#define CONFIG_EVENT_PRIO_BANDS     (3U)
+#endif
+
+/**
+ * @brief   Band of highest priority
+ */
+#define EVENT_PRIO_BAND_HIGH        (0U)
+
+/**
+ * @brief   Band of lowest priority
+ */
+#define EVENT_PRIO_BAND_LOW         (CONFIG_EVENT_PRIO_BANDS - 1)
+
+/**
+ * @brief   Event queue with priority bands
+ */
+typedef struct {
+    event_queue_t bands[CONFIG_EVENT_PRIO_BANDS];   /**< one queue per band,
+                                                         highest priority first */
+} event_prio_queue_t;
+
+/**
+ * @brief   Initialize an event priority queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   event priority queue object to initialize
+ */
+static inline void event_prio_queue_init(event_prio_queue_t *queue)
+{
+    event_queues_init(queue->bands, CONFIG_EVENT_PRIO_BANDS);
+}
+
+/**
+ * @brief   Initialize an event priority queue not binding it to a thread
+ *
+ * @param[out]  queue   event priority queue object to initialize
+ */
+static inline void event_prio_queue_init_detached(event_prio_queue_t *queue)
+{
+    event_queues_init_detached(queue->bands, CONFIG_EVENT_PRIO_BANDS);
+}
+
+/**
+ * @brief   Bind an event priority queue to the calling thread
+ *
+ * @pre     @p queue has been initialized detached and is not yet bound to
+ *          a thread
+ *
+ * @param[out]  queue   event priority queue object to bind to a thread
+ */
+static inline void event_prio_queue_claim(event_prio_queue_t *queue)
+{
+    event_queues_claim(queue->bands, CONFIG_EVENT_PRIO_BANDS);
+}
+
+/**
+ * @brief   Queue an event in a band
+ *
+ * @see     event_post
+ *
+ * @param[in]   queue   event priority queue to queue event in
+ * @param[in]   band    band to queue the event in, 0 is the highest priority
+ * @param[in]   event   event to queue
+ */
+static inline void event_prio_post(event_prio_queue_t *queue, unsigned band,
+                                   event_t *event)
+{
+    assert(band < CONFIG_EVENT_PRIO_BANDS);
+    event_post(&queue->bands[band], event);
+}
+
+/**
+ * @brief   Cancel an event queued in a band
+ *
+ * @see     event_cancel
+ *
+ * @param[in]   queue   event priority queue to remove event from
+ * @param[in]   band    band the event was queued in
+ * @param[in]   event   event to remove
+ */
+static inline void event_prio_cancel(event_prio_queue_t *queue, unsigned band,
+                                     event_t *event)
+{
+    assert(band < CONFIG_EVENT_PRIO_BANDS);
+    event_cancel(&queue->bands[band], event);
+}
+
+/**
+ * @brief   Get the next event of highest priority, non-blocking
+ *
+ * @param[in]   queue   event priority queue to get event from
+ *
+ * @returns     pointer to next event
+ * @returns     NULL if no event available
+ */
+static inline event_t *event_prio_get(event_prio_queue_t *queue)
+{
+    for (unsigned i = 0; i < CONFIG_EVENT_PRIO_BANDS; i++) {
+        event_t *event = event_get(&queue->bands[i]);
+        if (event) {
+            return event;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief   Get the next event of highest priority, blocking
+ *
+ * @warning There can only be a single waiter on a queue!
+ *
+ * @param[in]   queue   event priority queue to get event from
+ *
+ * @returns     pointer to next event
+ */
+static inline event_t *event_prio_wait(event_prio_queue_t *queue)
+{
+    return event_wait_multi(queue->bands, CONFIG_EVENT_PRIO_BANDS);
+}
+
+/**
+ * @brief   Simple event loop for an event priority queue
+ *
+ * @param[in]   queue   event priority queue to handle the events of
+ */
+static inline void event_prio_loop(event_prio_queue_t *queue)
+{
+    event_loop_multi(queue->bands, CONFIG_EVENT_PRIO_BANDS);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_PRIO_H */
+/** @} */
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Stackless tasks run by an event queue
+ *
+ * A protocol implementation waiting for sockets and timers usually runs in
+ * a thread of its own, costing a stack per protocol. An @ref event_task_t
+ * is a function that can wait without blocking its thread instead: it
+ * returns at every wait and is resumed at the same point by the event
+ * queue it runs on, once woken up by @ref event_task_wake() (e.g. from a
+ * @ref net_sock_async callback) or a timeout. Many tasks can share a single
+ * event thread, each only costing the size of its @ref event_task_t.
+ *
+ * As in protothreads, the position to resume at is stored in
+ * event_task_t::lc and the task body is a `switch` statement over it,
+ * hidden in the `EVENT_TASK_*` macros. This implies:
+ *
+ * - Local variables are not preserved across waits. Keep state in a struct
+ *   extending @ref event_task_t.
+ * - The macros must not be used within a `switch` statement of the task
+ *   body and at most one of them may be used per line.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static int blink(event_task_t *task)
+ * {
+ *     EVENT_TASK_BEGIN(task);
+ *     while (1) {
+ *         LED0_TOGGLE;
+ *         EVENT_TASK_SLEEP(task, ZTIMER_MSEC, 500);
+ *     }
+ *     EVENT_TASK_END(task);
+ * }
+ *
+ * [...]
+ * static event_task_t task;
+ * event_task_start(&task, EVENT_PRIO_MEDIUM, blink, NULL);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event task API
+ */
+
+#ifndef EVENT_TASK_H
+#define EVENT_TASK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Return value of a task waiting to be resumed
+ */
+#define EVENT_TASK_WAITING      (0)
+
+/**
+ * @brief   Return value of a finished task
+ */
+#define EVENT_TASK_DONE         (1)
+
+/**
+ * @brief   Event task forward declaration
+ */
+typedef struct event_task event_task_t;
+
+/**
+ * @brief   Body of an event task
+ *
+ * @param[in]   task    the task
+ *
+ * @return  @ref EVENT_TASK_WAITING or @ref EVENT_TASK_DONE, as returned by
+ *          the `EVENT_TASK_*` macros
+ */
+typedef int (*event_task_run_t)(event_task_t *task);
+
+/**
+ * @brief   Called when an event task finished
+ *
+ * @param[in]   task    the task
+ */
+typedef void (*event_task_done_t)(event_task_t *task);
+
+/**
+ * @brief   Event task structure
+ */
+struct event_task {
+    event_t super;              /**< event resuming the task */
+    event_queue_t *queue;       /**< queue the task runs on */
+    event_task_run_t run;       /**< body of the task */
+    event_task_done_t done;     /**< called when the task finished, may be NULL */
+    ztimer_clock_t *clock;      /**< clock of event_task_t::timer */
+    ztimer_t timer;             /**< timer for timeouts */
+    volatile bool timed_out;    /**< the timeout expired */
+    uint16_t lc;                /**< line to resume the task at, 0 to start */
+};
+
+/**
+ * @brief   Start an event task
+ *
+ * The body is run the first time once @p queue handles the task's event.
+ *
+ * @pre     @p task is zero-initialized or has finished, e.g. it may be
+ *          restarted from its `done` callback
+ *
+ * @param[in,out]  task    task to start
+ * @param[in]      queue   event queue to run the task on
+ * @param[in]      run     body of the task
+ * @param[in]      done    called when the task finished, may be NULL
+ */
+void event_task_start(event_task_t *task, event_queue_t *queue,
+                      event_task_run_t run, event_task_done_t done);
+
+/**
+ * @brief   Resume a waiting event task
+ *
+ * The task re-evaluates the condition it waits for. Waking a task that is
+ * not waiting has no effect.
+ *
+ * @note    It is safe to call this function from IRQ context.
+ *
+ * @param[in]   task    task to resume
+ */
+static inline void event_task_wake(event_task_t *task)
+{
+    event_post(task->queue, &task->super);
+}
+
+/**
+ * @brief   Set the timeout of an event task
+ *
+ * When @p duration passed, event_task_t::timed_out is set and the task is
+ * woken up. A previously set timeout is replaced.
+ *
+ * @param[in]   task        the task
+ * @param[in]   clock       clock to use for the timeout
+ * @param[in]   duration    timeout in ticks of @p clock
+ */
+void event_task_set_timeout(event_task_t *task, ztimer_clock_t *clock,
+                            uint32_t duration);
+
+/**
+ * @brief   Remove the timeout of an event task
+ *
+ * @param[in]   task        the task
+ */
+void event_task_clear_timeout(event_task_t *task);
+
+/**
+ * @brief   Check if the timeout of an event task expired
+ *
+ * @param[in]   task        the task
+ *
+ * @return  true, if the timeout set with @ref event_task_set_timeout expired
+ */
+static inline bool event_task_timed_out(const event_task_t *task)
+{
+    return task->timed_out;
+}
+
+/**
+ * @brief   Start the body of an event task
+ *
+ * @param[in]   task    the task
+ */
+#define EVENT_TASK_BEGIN(task)  switch ((task)->lc) { case 0:
+
+/**
+ * @brief   End the body of an event task
+ *
+ * @param[in]   task    the task
+ */
+#define EVENT_TASK_END(task)    } (task)->lc = 0; return EVENT_TASK_DONE
+
+/**
+ * @brief   Wait until a condition is true
+ *
+ * The condition is evaluated right away and every time the task is woken
+ * up.
+ *
+ * @param[in]   task    the task
+ * @param[in]   cond    condition to wait for
+ */
+#define EVENT_TASK_WAIT_UNTIL(task, cond) \
+    do { \
+        (task)->lc = __LINE__; \
+        if (0) { case __LINE__: ; } \
+        if (!(cond)) { \
+            return EVENT_TASK_WAITING; \
+        } \
+    } while (0)
+
+/**
+ * @brief   Let other events of the queue be handled before continuing
+ *
+ * @param[in]   task    the task
+ */
+#define EVENT_TASK_YIELD(task) \
+    do { \
+        (task)->lc = __LINE__; \
+        event_task_wake(task); \
+        return EVENT_TASK_WAITING; \
+        case __LINE__: ; \
+    } while (0)
+
+/**
+ * @brief   Wait for a duration
+ *
+ * @param[in]   task        the task
+ * @param[in]   clock       clock to use
+ * @param[in]   duration    time to wait in ticks of @p clock
+ */
+#define EVENT_TASK_SLEEP(task, clock, duration) \
+    do { \
+        event_task_set_timeout(task, clock, duration); \
+        EVENT_TASK_WAIT_UNTIL(task, event_task_timed_out(task)); \
+    } while (0)
+
+/**
+ * @brief   Finish the task
+ *
+ * @param[in]   task    the task
+ */
+#define EVENT_TASK_EXIT(task) \
+    do { \
+        (task)->lc = 0; \
+        return EVENT_TASK_DONE; \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_TASK_H */
+/** @} */
@@ -94,6 +94,26 @@ static inline uint32_t frac_scale(const frac_t *frac, uint32_t x)
     return scaled;
 }
 
+/**
+ * @brief   Scale a 64 bit integer by a 32/32 rational number
+ *
+ * @param[in]   frac  scaling fraction
+ * @param[in]   x     unscaled integer
+ *
+ * @return      (x * frac) % 2**64, avoiding truncation
+ */
+static inline uint64_t frac_scale64(const frac_t *frac, uint64_t x)
+{
+    uint64_t hi = (x >> 32) * frac->frac;
+    uint64_t lo = (x & UINT32_MAX) * frac->frac;
+
+    /* (hi * 2**32 + lo) >> shift without a 96 bit intermediate */
+    if (frac->shift <= 32) {
+        return (hi << (32 - frac->shift)) + (lo >> frac->shift);
+    }
+    return (hi + (lo >> 32)) >> (frac->shift - 32);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -135,6 +135,34 @@ static inline void sha256_final(sha256_context_t *ctx, void *digest)
  */
 void *sha256(const void *data, size_t len, void *digest);
 
+/**
+ * @brief Add bytes into several independent hashes
+ *
+ * Equivalent to calling @ref sha256_update() for each of the @p num
+ * contexts with its own buffer, e.g. for the inner and outer hash of a HMAC.
+ * Grouping the updates allows implementations that hash multiple buffers at
+ * once to do so, the portable implementation hashes them one after the other.
+ *
+ * @param ctx       array of @p num sha256_context_t handles to use
+ * @param[in] data  array of @p num input buffers, one per context
+ * @param[in] len   length of each buffer in @p data
+ * @param[in] num   number of contexts
+ */
+void sha256_update_multi(sha256_context_t *const ctx[], const void *const data[],
+                         size_t len, unsigned num);
+
+/**
+ * @brief Hash several independent buffers of the same length
+ *
+ * @param[in]  data     array of @p num input buffers
+ * @param[in]  len      length of each buffer in @p data
+ * @param[out] digest   array of @p num buffers for the results, each of
+ *                      length SHA256_DIGEST_LENGTH
+ * @param[in]  num      number of buffers
+ */
+void sha256_multi(const void *const data[], size_t len, void *const digest[],
+                  unsigned num);
+
 /**
  * @brief hmac_sha256_init HMAC SHA-256 calculation. Initiate calculation of a HMAC
  * @param[in] ctx hmac_context_t handle to use
@@ -57,6 +57,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Fully unroll the rounds of the SHA-224/SHA-256 compression function
+ *
+ * By default, the compression function runs a loop over blocks of 16 unrolled
+ * rounds. Unrolling all 64 rounds removes the loop at about three times the
+ * code size of the compression function.
+ */
+#ifdef DOXYGEN
+#define CONFIG_HASHES_SHA2XX_UNROLL
+#endif
+
 /**
  * @brief    Structure to hold the SHA-2XX context.
  */
@@ -62,6 +62,9 @@
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq/type.h"
 #endif
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+#include "net/gnrc/netif/ieee802154_indirect/type.h"
+#endif
 #include "net/l2util.h"
 #include "net/ndp.h"
 #include "net/netdev.h"
@@ -183,6 +186,14 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT) || defined(DOXYGEN)
+    /**
+     * @brief   Indirect transmission component
+     *
+     * @note    Only available with @ref net_gnrc_netif_ieee802154_indirect.
+     */
+    gnrc_netif_ieee802154_indirect_t ieee802154_indirect;
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
@@ -294,6 +305,30 @@ struct gnrc_netif_ops {
      * @param[in] msg   Message to be handled.
      */
     void (*msg_handler)(gnrc_netif_t *netif, msg_t *msg);
+
+    /**
+     * @brief   Coalesces two packets to the same destination into one frame
+     *
+     * Called by @ref net_gnrc_netif_pktq for consecutive packets in the send
+     * queue with the same link-layer destination, if the link layer has a
+     * framing to carry several packets in one frame. Leave NULL if this is
+     * not the case.
+     *
+     * @pre `netif != NULL && pkt != NULL && next != NULL`
+     *
+     * @param[in] netif The network interface.
+     * @param[in] pkt   A packet to send, starting with a
+     *                  @ref net_gnrc_netif_hdr.
+     * @param[in] next  The packet queued after @p pkt, starting with a
+     *                  @ref net_gnrc_netif_hdr with the same destination.
+     *
+     * @return  The packet carrying both @p pkt and @p next. Ownership of both
+     *          is passed to it.
+     * @return  NULL, if @p next does not fit into the frame of @p pkt. Both
+     *          are left untouched.
+     */
+    gnrc_pktsnip_t *(*aggregate)(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                                 gnrc_pktsnip_t *next);
 };
 
 /**
@@ -78,6 +78,43 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Drop packets that duplicate a packet already in the send queue
+ *
+ * A packet is a duplicate, if it has the same link-layer destination and the
+ * same payload as a queued packet, e.g. a retransmission of an upper layer
+ * that was issued while the original was still waiting for the device.
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_DEDUP
+#define CONFIG_GNRC_NETIF_PKTQ_DEDUP          0
+#endif
+
+/**
+ * @brief       Number of flows packets of the bulk class are hashed to with
+ *              `gnrc_netif_pktq_fq`
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS       (4U)
+#endif
+
+/**
+ * @brief       Maximum number of packets of a single flow in the send queue
+ *              of a network interface with `gnrc_netif_pktq_fq`
+ *
+ * Keeps a bulk transfer from taking all entries of the pool of size
+ * @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE, so there are entries left for
+ * control traffic.
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT  (CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE / 2)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
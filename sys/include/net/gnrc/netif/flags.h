@@ -139,6 +139,15 @@ enum {
  * @brief   Network interface is configured in raw mode
  */
 #define GNRC_NETIF_FLAGS_RAWMODE                   (0x00010000U)
+
+/**
+ * @brief   Network interface leaves upper layer checksums of outgoing packets
+ *          to the device
+ *
+ * Set from @ref NETOPT_CHECKSUM_OFFLOAD of the device when module
+ * `gnrc_netif_csum_offload` is used.
+ */
+#define GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD           (0x00020000U)
 /** @} */
 
 #ifdef __cplusplus
@@ -112,6 +112,16 @@ extern "C" {
  *          can be used to check for presence of a valid timestamp.
  */
 #define GNRC_NETIF_HDR_FLAGS_TIMESTAMP  (0x08)
+
+/**
+ * @brief   Upper layer checksum already verified
+ *
+ * @details If module `gnrc_netif_csum_offload` is used and the network device
+ *          verified the checksum of the UDP, TCP or ICMPv6 payload of a
+ *          received frame, this flag is set and the protocol skips its own
+ *          verification.
+ */
+#define GNRC_NETIF_HDR_FLAGS_CSUM_VALID (0x04)
 /**
  * @}
  */
@@ -416,6 +426,21 @@ void gnrc_netif_hdr_print(gnrc_netif_hdr_t *hdr);
  */
 uint8_t gnrc_netif_hdr_get_flag(gnrc_pktsnip_t* pkt);
 
+/**
+ * @brief   Check if the network device already verified the upper layer
+ *          checksum of a received packet
+ *
+ * @param[in]   pkt     received gnrc packet
+ *
+ * @return  true, if @ref GNRC_NETIF_HDR_FLAGS_CSUM_VALID is set for @p pkt
+ * @return  false, otherwise or if module `gnrc_netif_csum_offload` is not used
+ */
+static inline bool gnrc_netif_hdr_csum_valid(gnrc_pktsnip_t *pkt)
+{
+    return IS_USED(MODULE_GNRC_NETIF_CSUM_OFFLOAD) &&
+           (gnrc_netif_hdr_get_flag(pkt) & GNRC_NETIF_HDR_FLAGS_CSUM_VALID);
+}
+
 /**
  * @brief   Extract the destination address out of a gnrc packet
  *
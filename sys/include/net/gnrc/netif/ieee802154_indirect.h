@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_ieee802154_indirect Indirect transmission for IEEE 802.15.4
+ * @ingroup     net_gnrc_netif
+ * @brief       Holds packets for sleepy children until they poll for them
+ *
+ * A battery powered IEEE 802.15.4 node can not keep its radio on to wait
+ * for frames. Instead it switches the radio off and polls its coordinator
+ * from time to time with a data request MAC command. The coordinator holds
+ * the packets for the node in the meantime (indirect transmission).
+ *
+ * ## Coordinator
+ *
+ * Packets to a child registered with
+ * @ref gnrc_netif_ieee802154_indirect_add() are not sent, but held in a
+ * queue per child. As long as any packet is held, the interface sets the
+ * frame pending bit in ACKs to data requests (@ref NETOPT_ACK_PENDING), so
+ * the radio can do so in time. On a data request the oldest packet for the
+ * child is sent, with the frame pending bit set if more packets are held.
+ * If the child has no packets (as the ACK can not tell the children apart),
+ * an empty data frame is sent instead, so the child can switch its radio off
+ * right away. Packets not polled for within
+ * @ref CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_TIMEOUT_MS are dropped.
+ *
+ * ## Child
+ *
+ * After @ref gnrc_netif_ieee802154_indirect_set_parent() the coordinator is
+ * polled once and the radio is switched off. A poll, either requested by
+ * @ref gnrc_netif_ieee802154_indirect_poll() or every
+ * @ref CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_POLL_PERIOD_MS, switches it on
+ * and sends a data request. If the ACK signals no pending data, the radio
+ * is switched off again right away. Otherwise it stays on until a frame
+ * without the frame pending bit arrives from the coordinator, polling again
+ * for every frame with it set, or for at most
+ * @ref CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MS.
+ *
+ * The time the radio is on for polling is accounted in
+ * gnrc_netif_ieee802154_indirect_stats_t::radio_on_ms.
+ *
+ * @note    Frames the child sends on its own are not covered by the
+ *          radio on time.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += gnrc_netif_ieee802154_indirect
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netif_ieee802154_indirect definitions
+ */
+#ifndef NET_GNRC_NETIF_IEEE802154_INDIRECT_H
+#define NET_GNRC_NETIF_IEEE802154_INDIRECT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154_indirect/type.h"
+#include "net/gnrc/pkt.h"
+#include "net/netdev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Registers a sleepy child with a coordinator
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] addr      Link-layer address the child polls with
+ * @param[in] addr_len  Length of @p addr
+ *
+ * @return  0 on success or if the child is already registered
+ * @return  -EINVAL, if @p addr_len is not a valid IEEE 802.15.4 address length
+ * @return  -ENOMEM, if there is no space left for the child
+ */
+int gnrc_netif_ieee802154_indirect_add(gnrc_netif_t *netif,
+                                       const uint8_t *addr, size_t addr_len);
+
+/**
+ * @brief   Removes a sleepy child from a coordinator
+ *
+ * Packets held for the child are dropped.
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] addr      Link-layer address of the child
+ * @param[in] addr_len  Length of @p addr
+ */
+void gnrc_netif_ieee802154_indirect_remove(gnrc_netif_t *netif,
+                                           const uint8_t *addr,
+                                           size_t addr_len);
+
+/**
+ * @brief   Gets the number of packets held for a sleepy child
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] addr      Link-layer address of the child
+ * @param[in] addr_len  Length of @p addr
+ *
+ * @return  Number of packets held for the child
+ * @return  -ENOENT, if the child is not registered
+ */
+int gnrc_netif_ieee802154_indirect_pending(gnrc_netif_t *netif,
+                                           const uint8_t *addr,
+                                           size_t addr_len);
+
+/**
+ * @brief   Makes the interface a sleepy child of a coordinator
+ *
+ * The coordinator is polled right away, after which the radio is switched
+ * off. If @ref CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_POLL_PERIOD_MS is not 0,
+ * periodic polling starts.
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] addr      Link-layer address of the coordinator, NULL to stop
+ *                      polling and to leave the radio on
+ * @param[in] addr_len  Length of @p addr
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p addr_len is not a valid IEEE 802.15.4 address length
+ * @return  -EBUSY, if the interface's message queue is full
+ */
+int gnrc_netif_ieee802154_indirect_set_parent(gnrc_netif_t *netif,
+                                              const uint8_t *addr,
+                                              size_t addr_len);
+
+/**
+ * @brief   Polls the coordinator for pending data
+ *
+ * The data request is sent asynchronously by the interface's thread.
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ *
+ * @return  0 on success
+ * @return  -ENOTCONN, if no coordinator is set
+ * @return  -EBUSY, if the interface's message queue is full
+ */
+int gnrc_netif_ieee802154_indirect_poll(gnrc_netif_t *netif);
+
+/**
+ * @brief   Initializes indirect transmission of an interface
+ *
+ * @internal
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ */
+void gnrc_netif_ieee802154_indirect_init(gnrc_netif_t *netif);
+
+/**
+ * @brief   Holds a packet, if it is destined to a sleepy child
+ *
+ * @internal
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] pkt       Packet to send, starting with a @ref gnrc_netif_hdr_t
+ *
+ * @return  1, if the packet is not destined to a sleepy child and is to be
+ *          sent right away
+ * @return  0, if the packet is held. It must not be released.
+ * @return  -ENOBUFS, if the queue of the child is full
+ */
+int gnrc_netif_ieee802154_indirect_put(gnrc_netif_t *netif,
+                                       gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Handles a data request of a sleepy child
+ *
+ * @internal
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] src       Link-layer address of the child
+ * @param[in] src_len   Length of @p src
+ *
+ * @return  Packet to send to the child, may have no payload
+ * @return  NULL, if nothing is to be sent
+ */
+gnrc_pktsnip_t *gnrc_netif_ieee802154_indirect_get(gnrc_netif_t *netif,
+                                                   const uint8_t *src,
+                                                   size_t src_len);
+
+/**
+ * @brief   Handles a received data frame in the child role
+ *
+ * @internal
+ *
+ * @param[in] netif         An IEEE 802.15.4 network interface
+ * @param[in] hdr           Header of the received frame
+ * @param[in] payload_len   Length of the payload of the frame
+ *
+ * @return  true, if the frame is to be dropped
+ */
+bool gnrc_netif_ieee802154_indirect_recv(gnrc_netif_t *netif,
+                                         const gnrc_netif_hdr_t *hdr,
+                                         size_t payload_len);
+
+/**
+ * @brief   Handles a transmission event of the network device
+ *
+ * @internal
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] event     The event
+ */
+void gnrc_netif_ieee802154_indirect_event(gnrc_netif_t *netif,
+                                          netdev_event_t event);
+
+/**
+ * @brief   Handles the timer messages of indirect transmission
+ *
+ * @internal
+ *
+ * @param[in] netif     An IEEE 802.15.4 network interface
+ * @param[in] msg       The message
+ */
+void gnrc_netif_ieee802154_indirect_msg_handler(gnrc_netif_t *netif,
+                                                msg_t *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_IEEE802154_INDIRECT_H */
+/** @} */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  net_gnrc_netif_ieee802154_indirect
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netif_ieee802154_indirect type definitions
+ *
+ * Contained in its own file, so the type can be included in
+ * @ref gnrc_netif_t while the functions in
+ * net/gnrc/netif/ieee802154_indirect.h can use @ref gnrc_netif_t as
+ * operating type.
+ */
+#ifndef NET_GNRC_NETIF_IEEE802154_INDIRECT_TYPE_H
+#define NET_GNRC_NETIF_IEEE802154_INDIRECT_TYPE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "msg.h"
+#include "net/gnrc/pkt.h"
+#include "net/ieee802154.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_netif_ieee802154_indirect_conf Indirect transmission compile configurations
+ * @ingroup  net_gnrc_netif_conf
+ * @{
+ */
+/**
+ * @brief   Maximum number of sleepy children per interface
+ */
+#ifndef CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_CHILDREN
+#define CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_CHILDREN      (4U)
+#endif
+
+/**
+ * @brief   Maximum number of packets held for a single child
+ */
+#ifndef CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_QUEUE_SIZE
+#define CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_QUEUE_SIZE    (4U)
+#endif
+
+/**
+ * @brief   Time in milliseconds a packet is held for a child before it is
+ *          dropped
+ *
+ * The default corresponds to macTransactionPersistenceTime of the
+ * 2.4 GHz O-QPSK PHY.
+ */
+#ifndef CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_TIMEOUT_MS
+#define CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_TIMEOUT_MS    (7680U)
+#endif
+
+/**
+ * @brief   Time in milliseconds a child keeps its radio on for data after
+ *          the coordinator signaled pending data
+ *
+ * The default corresponds to macMaxFrameTotalWaitTime of the 2.4 GHz
+ * O-QPSK PHY.
+ */
+#ifndef CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MS
+#define CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MS       (20U)
+#endif
+
+/**
+ * @brief   Period in milliseconds a child polls its coordinator with
+ *
+ * Set to 0 to only poll on request by
+ * @ref gnrc_netif_ieee802154_indirect_poll().
+ */
+#ifndef CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_POLL_PERIOD_MS
+#define CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_POLL_PERIOD_MS (0U)
+#endif
+/** @} */
+
+/**
+ * @brief   A packet held for a sleepy child
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;        /**< the packet */
+    uint32_t expires;           /**< time in ms at which the packet is dropped */
+} gnrc_netif_ieee802154_indirect_entry_t;
+
+/**
+ * @brief   Pending packets of a sleepy child
+ */
+typedef struct {
+    /**
+     * @brief   Link-layer address of the child
+     */
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t addr_len;           /**< length of gnrc_netif_ieee802154_indirect_child_t::addr, 0 if unused */
+    uint8_t head;               /**< index of the oldest packet */
+    uint8_t num;                /**< number of packets */
+    /**
+     * @brief   Packets held for the child, in order of arrival
+     */
+    gnrc_netif_ieee802154_indirect_entry_t queue[CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_QUEUE_SIZE];
+} gnrc_netif_ieee802154_indirect_child_t;
+
+/**
+ * @brief   State of the polling of a sleepy child
+ */
+typedef enum {
+    GNRC_NETIF_IEEE802154_INDIRECT_AWAKE,       /**< radio is on, no polling */
+    GNRC_NETIF_IEEE802154_INDIRECT_SLEEPING,    /**< radio is off */
+    GNRC_NETIF_IEEE802154_INDIRECT_POLLING,     /**< data request is sent */
+    GNRC_NETIF_IEEE802154_INDIRECT_WAITING,     /**< data is pending */
+} gnrc_netif_ieee802154_indirect_state_t;
+
+/**
+ * @brief   Statistics of indirect transmission
+ */
+typedef struct {
+    uint32_t queued;            /**< packets held for a child */
+    uint32_t delivered;         /**< held packets sent on a data request */
+    uint32_t expired;           /**< held packets dropped on timeout */
+    uint32_t dropped;           /**< packets dropped on a full queue */
+    uint32_t polls;             /**< data requests sent */
+    uint32_t polls_pending;     /**< data requests acknowledged with pending data */
+    uint32_t radio_on_ms;       /**< time in ms the radio was on for polling */
+} gnrc_netif_ieee802154_indirect_stats_t;
+
+/**
+ * @brief   Indirect transmission component of @ref gnrc_netif_t
+ */
+typedef struct {
+    /**
+     * @brief   Sleepy children of the interface (coordinator role)
+     */
+    gnrc_netif_ieee802154_indirect_child_t children[CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_CHILDREN];
+    ztimer_t expire_timer;      /**< timer to drop held packets */
+    msg_t expire_msg;           /**< message for gnrc_netif_ieee802154_indirect_t::expire_timer */
+    /**
+     * @brief   Link-layer address of the coordinator (child role)
+     */
+    uint8_t parent[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t parent_len;         /**< length of gnrc_netif_ieee802154_indirect_t::parent, 0 if unset */
+    bool ack_pending;           /**< frame pending bit of ACKs is set */
+    uint8_t state;              /**< @ref gnrc_netif_ieee802154_indirect_state_t */
+    ztimer_t poll_timer;        /**< timer to end waiting for data or to poll */
+    msg_t poll_msg;             /**< message for gnrc_netif_ieee802154_indirect_t::poll_timer */
+    uint32_t wait_until;        /**< time in ms until data is waited for */
+    uint32_t radio_on;          /**< time in ms the radio was switched on */
+    gnrc_netif_ieee802154_indirect_stats_t stats;   /**< statistics */
+} gnrc_netif_ieee802154_indirect_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_IEEE802154_INDIRECT_TYPE_H */
+/** @} */
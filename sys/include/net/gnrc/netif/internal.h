@@ -45,6 +45,24 @@ extern "C" {
  */
 #define NETDEV_MSG_TYPE_EVENT           (0x1234)
 
+/**
+ * @brief   Message type to drop expired packets of
+ *          @ref net_gnrc_netif_ieee802154_indirect
+ */
+#define GNRC_NETIF_IEEE802154_INDIRECT_EXPIRE_MSG   (0x1235)
+
+/**
+ * @brief   Message type to poll the coordinator with
+ *          @ref net_gnrc_netif_ieee802154_indirect
+ */
+#define GNRC_NETIF_IEEE802154_INDIRECT_POLL_MSG     (0x1236)
+
+/**
+ * @brief   Message type to stop waiting for data with
+ *          @ref net_gnrc_netif_ieee802154_indirect
+ */
+#define GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MSG     (0x1237)
+
 /**
  * @brief   Acquires exclusive access to the interface
  *
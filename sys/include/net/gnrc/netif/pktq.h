@@ -34,15 +34,29 @@ extern "C" {
 /**
  * @brief   Puts a packet into the packet send queue of a network interface
  *
+ * With `gnrc_netif_pktq_fq`, the packet is not appended to the queue but
+ * scheduled by its traffic class: Packets of
+ * @ref GNRC_NETIF_PKTQ_FQ_CONTROL are put behind all other control packets,
+ * but before any other packet. All other packets are hashed into
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS flows by link-layer destination and,
+ * for IPv6, by traffic class, flow label and next header. The flows share
+ * the link by the number of bytes sent (start-time fair queueing).
+ *
  * @pre `netif != NULL`
  * @pre `pkt != NULL`
  *
  * @param[in] netif A network interface. May not be NULL.
  * @param[in] pkt   A packet. May not be NULL.
  *
+ * With @ref CONFIG_GNRC_NETIF_PKTQ_DEDUP, @p pkt is released instead, if it
+ * duplicates a packet in the queue. A @p pkt already in the queue itself is
+ * never released, but queued again.
+ *
  * @return  0 on success
  * @return  -1 when the pool of available gnrc_pktqueue_t entries (of size
- *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted
+ *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted or, with
+ *          `gnrc_netif_pktq_fq`, the flow of @p pkt already has
+ *          @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT packets queued
  */
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 
@@ -63,26 +77,34 @@ unsigned gnrc_netif_pktq_usage(void);
  * @return  A packet on success
  * @return  NULL when the queue is empty
  */
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ) || defined(DOXYGEN)
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif);
+#else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) || defined(DOXYGEN) */
 static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
-    assert(netif != NULL);
-
-    gnrc_pktsnip_t *pkt = NULL;
-    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(
-        &netif->send_queue.queue
-    );
-
-    if (entry != NULL) {
-        pkt = entry->pkt;
-        entry->pkt = NULL;
-    }
-    return pkt;
-#else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
     return NULL;
-#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 }
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) || defined(DOXYGEN) */
+
+/**
+ * @brief   Coalesces packets at the head of the packet send queue of a network
+ *          interface into a packet got from it
+ *
+ * Packets are coalesced as long as the head of the queue has the same
+ * link-layer destination as @p pkt and gnrc_netif_ops_t::aggregate of
+ * @p netif accepts it.
+ *
+ * @pre `netif != NULL`
+ * @pre `pkt != NULL`
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ * @param[in] pkt   A packet got by @ref gnrc_netif_pktq_get(). May not be NULL.
+ *
+ * @return  The packet to send. @p pkt if nothing was coalesced.
+ */
+gnrc_pktsnip_t *gnrc_netif_pktq_coalesce(gnrc_netif_t *netif,
+                                         gnrc_pktsnip_t *pkt);
 
 /**
  * @brief   Schedule a dequeue notification to network interface
@@ -23,18 +23,72 @@
 #ifndef NET_GNRC_NETIF_PKTQ_TYPE_H
 #define NET_GNRC_NETIF_PKTQ_TYPE_H
 
+#include "net/gnrc/netif/conf.h"
 #include "net/gnrc/pktqueue.h"
+#include "net/netstats.h"
 #include "xtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Traffic classes of `gnrc_netif_pktq_fq`
+ */
+typedef enum {
+    /**
+     * @brief   ICMPv6 and network control (DSCP CS6 and CS7), sent before any
+     *          other packet
+     */
+    GNRC_NETIF_PKTQ_FQ_CONTROL = 0,
+    /**
+     * @brief   Any other packet, shared fairly between flows
+     */
+    GNRC_NETIF_PKTQ_FQ_BULK,
+    GNRC_NETIF_PKTQ_FQ_CLASS_NUMOF,     /**< number of classes */
+} gnrc_netif_pktq_fq_class_t;
+
+/**
+ * @brief   Sojourn time statistics of a traffic class
+ */
+typedef struct {
+    uint32_t packets;           /**< packets taken from the queue */
+    uint32_t sojourn_max;       /**< maximum time in µs a packet was queued */
+    uint64_t sojourn_sum;       /**< sum of times in µs packets were queued */
+} gnrc_netif_pktq_fq_stats_t;
+
+/**
+ * @brief   Fair queueing state of a packet queue
+ */
+typedef struct {
+    /**
+     * @brief   Virtual time of the queue, the start tag of the last packet
+     *          taken from it
+     */
+    uint32_t vtime;
+    /**
+     * @brief   Finish tags of the flows of the bulk class
+     */
+    uint32_t finish[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    /**
+     * @brief   Number of queued packets of the flows of the bulk class
+     */
+    uint8_t num[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    /**
+     * @brief   Sojourn time statistics per traffic class
+     */
+    gnrc_netif_pktq_fq_stats_t stats[GNRC_NETIF_PKTQ_FQ_CLASS_NUMOF];
+} gnrc_netif_pktq_fq_t;
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
     gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+    netstats_queue_t stats;     /**< statistics of the queue */
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || defined(DOXYGEN)
+    gnrc_netif_pktq_fq_t fq;    /**< fair queueing state of the queue */
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
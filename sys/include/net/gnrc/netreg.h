@@ -377,6 +377,20 @@ gnrc_netreg_entry_t *gnrc_netreg_getnext(gnrc_netreg_entry_t *entry);
 
 int gnrc_netreg_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr);
 
+/**
+ * @brief   Clears the checksum field of a header, so the network device
+ *          computes the checksum.
+ *
+ * @see     @ref NETOPT_CSUM_OFFLOAD_TX
+ *
+ * @param[in] hdr           The header the checksum should be cleared for.
+ *
+ * @return  0, on success.
+ * @return  -ENOENT, if @ref net_gnrc_netreg does not know the checksum field
+ *          for gnrc_pktsnip_t::type of @p hdr.
+ */
+int gnrc_netreg_clear_csum(gnrc_pktsnip_t *hdr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -85,6 +85,17 @@ extern "C" {
 #define IEEE802154_FCF_SRC_ADDR_LONG        (0xc0)  /**< source address length is 8 */
 /** @} */
 
+/**
+ * @brief IEEE 802.15.4 MAC command frame identifiers
+ * @{
+ */
+#define IEEE802154_CMD_ASSOC_REQ            (0x01)  /**< association request */
+#define IEEE802154_CMD_ASSOC_RESP           (0x02)  /**< association response */
+#define IEEE802154_CMD_DISASSOC_NOTIFY      (0x03)  /**< disassociation notification */
+#define IEEE802154_CMD_DATA_REQ             (0x04)  /**< data request */
+#define IEEE802154_CMD_BEACON_REQ           (0x07)  /**< beacon request */
+/** @} */
+
 /**
  * @brief   Channel ranges
  * @{
@@ -19,6 +19,12 @@
  * - Handling CSMA-CA and retransmissions.
  * - Maintaining part of the MAC Information Base, e.g IEEE 802.15.4 addresses,
  *   channel settings, CSMA-CA params, etc.
+ * - Optionally queueing frames that are sent while a transmission is ongoing
+ *   (see @ref CONFIG_IEEE802154_SUBMAC_TXQ_SIZE). Queued frames are sent
+ *   back to back: the next frame is loaded into the radio as soon as the
+ *   previous transmission finished, without a round trip through the upper
+ *   layer. This benefits bursts of frames such as the fragments of a 6LoWPAN
+ *   datagram.
  *
  * @{
  *
@@ -38,6 +44,16 @@ extern "C" {
 
 #define IEEE802154_SUBMAC_MAX_RETRANSMISSIONS (4U)  /**< maximum number of frame retransmissions */
 
+/**
+ * @brief Number of frames the SubMAC queues while a transmission is ongoing
+ *
+ * Each queue slot uses @ref IEEE802154_FRAME_LEN_MAX bytes of RAM. With 0,
+ * @ref ieee802154_send fails with -EBUSY while the SubMAC is transmitting.
+ */
+#ifndef CONFIG_IEEE802154_SUBMAC_TXQ_SIZE
+#define CONFIG_IEEE802154_SUBMAC_TXQ_SIZE   (0U)
+#endif
+
 /**
  * @brief IEEE 802.15.4 SubMAC forward declaration
  */
@@ -100,6 +116,27 @@ typedef struct {
                     ieee802154_tx_info_t *info);
 } ieee802154_submac_cb_t;
 
+/**
+ * @brief IEEE 802.15.4 SubMAC transmission statistics
+ */
+typedef struct {
+    uint32_t tx_frames;         /**< frames passed to the radio */
+    uint32_t tx_queued;         /**< frames queued while the SubMAC was busy */
+    uint32_t tx_back_to_back;   /**< queued frames started right after the
+                                     previous transmission */
+    uint32_t tx_queue_full;     /**< frames rejected because the queue was full */
+} ieee802154_submac_stats_t;
+
+#if CONFIG_IEEE802154_SUBMAC_TXQ_SIZE || defined(DOXYGEN)
+/**
+ * @brief Frame waiting in the SubMAC transmission queue
+ */
+typedef struct {
+    uint8_t len;                            /**< length of the PSDU (without FCS) */
+    uint8_t psdu[IEEE802154_FRAME_LEN_MAX]; /**< the PSDU */
+} ieee802154_submac_txq_frame_t;
+#endif
+
 /**
  * @brief IEEE 802.15.4 SubMAC descriptor
  */
@@ -121,6 +158,15 @@ struct ieee802154_submac {
     int8_t tx_pow;                      /**< Transmission power (in dBm) */
     ieee802154_submac_state_t state;    /**< State of the SubMAC */
     ieee802154_phy_mode_t phy_mode;     /**< IEEE 802.15.4 PHY mode */
+    ieee802154_submac_stats_t stats;    /**< transmission statistics */
+#if CONFIG_IEEE802154_SUBMAC_TXQ_SIZE || defined(DOXYGEN)
+    /**
+     * @brief frames waiting for the ongoing transmission to finish
+     */
+    ieee802154_submac_txq_frame_t txq[CONFIG_IEEE802154_SUBMAC_TXQ_SIZE];
+    uint8_t txq_head;                   /**< index of the oldest queued frame */
+    uint8_t txq_num;                    /**< number of queued frames */
+#endif
 };
 
 /**
@@ -153,10 +199,19 @@ int ieee802154_set_state(ieee802154_submac_t *submac, ieee802154_submac_state_t
  * retransmissions (if ACK Request bit is set).  When the transmission finishes
  * an @ref ieee802154_submac_cb_t::tx_done event is issued.
  *
+ * If a transmission is ongoing and @ref CONFIG_IEEE802154_SUBMAC_TXQ_SIZE is
+ * not 0, the frame is copied into the transmission queue and sent as soon as
+ * the frames before it are done. Every frame gets its own
+ * @ref ieee802154_submac_cb_t::tx_done event, in the order of the calls to
+ * this function.
+ *
  * @param[in] submac pointer to the SubMAC descriptor
  * @param[in] iolist pointer to the PSDU frame (without FCS)
  *
  * @return 0 on success
+ * @return -ENETDOWN if the SubMAC is off
+ * @return -EBUSY if a transmission is ongoing and the queue is full
+ * @return -EMSGSIZE if the frame needs to be queued, but is too long
  * @return negative errno on error
  */
 int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist);
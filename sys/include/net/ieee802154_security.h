@@ -124,6 +124,17 @@ struct ieee802154_sec_dev {
  */
 #define IEEE802154_SEC_BLOCK_SIZE               (16U)
 
+/**
+ * @brief   Maximum number of counter blocks passed to
+ *          @ref ieee802154_radio_cipher_ops_t::ecb at once
+ *
+ * Larger values let hardware engines process more of the payload per
+ * request, at the cost of two blocks of stack each.
+ */
+#ifndef IEEE802154_SEC_CTR_BLOCKS
+#define IEEE802154_SEC_CTR_BLOCKS               (4U)
+#endif
+
 /**
  * @brief   Maximum length of the security auxiliary header in bytes
  */
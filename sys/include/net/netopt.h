@@ -799,6 +799,28 @@ typedef enum {
      * @brief   (array of byte arrays) Leave an link layer multicast group
      */
     NETOPT_L2_GROUP_LEAVE,
+
+    /**
+     * @brief   (@ref netopt_csum_offload_t) offload upper layer checksums
+     *          to the device
+     *
+     * Covers the checksums of UDP, TCP and ICMPv6 carried in IPv6. Setting
+     * the option enables the given offloads as far as the device supports
+     * them, getting it returns the offloads currently enabled. Offloading is
+     * disabled by default.
+     *
+     * If @ref NETOPT_CSUM_OFFLOAD_TX is set, the network stack leaves the
+     * checksum field of packets it originates zero. The device computes the
+     * checksum, including the IPv6 pseudo header, for every unfragmented
+     * packet with a zero checksum field and leaves all other packets, e.g.
+     * forwarded ones, untouched.
+     *
+     * If @ref NETOPT_CSUM_OFFLOAD_RX is set, the device reports received
+     * frames with a verified checksum in the `rx_info` argument of its `recv`
+     * function, e.g. @ref NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID.
+     */
+    NETOPT_CHECKSUM_OFFLOAD,
+
     /**
      * @brief   maximum number of options defined here.
      *
@@ -849,6 +871,17 @@ typedef enum {
     NETOPT_RF_TESTMODE_CTX_PRBS9,   /**< PRBS9 continuous tx mode */
 } netopt_rf_testmode_t;
 
+/**
+ * @brief   Option parameter to be used with @ref NETOPT_CHECKSUM_OFFLOAD
+ */
+typedef enum {
+    NETOPT_CSUM_OFFLOAD_NONE = 0x0,     /**< no checksum offloading */
+    NETOPT_CSUM_OFFLOAD_TX = 0x1,       /**< device completes checksums of
+                                         *   outgoing packets */
+    NETOPT_CSUM_OFFLOAD_RX = 0x2,       /**< device verifies checksums of
+                                         *   incoming packets */
+} netopt_csum_offload_t;
+
 /**
  * @brief   Get a string ptr corresponding to opt, for debugging
  *
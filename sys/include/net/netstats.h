@@ -50,6 +50,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_QUEUE      (0x04)
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
@@ -69,6 +70,20 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief       Send queue statistics struct
+ */
+typedef struct {
+    uint32_t queued;            /**< packets put into the send queue */
+    uint32_t dropped;           /**< packets dropped on a full send queue */
+    uint32_t deduplicated;      /**< packets dropped as duplicate of a
+                                     queued packet */
+    uint32_t coalesced;         /**< packets merged into the frame of a
+                                     preceding packet */
+    uint16_t depth;             /**< packets currently in the send queue */
+    uint16_t depth_max;         /**< maximum of netstats_queue_t::depth */
+} netstats_queue_t;
+
 /**
  * @brief       Stats per peer struct
  */
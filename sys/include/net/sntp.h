@@ -30,6 +30,10 @@
 #include "net/sock/udp.h"
 #include "xtimer.h"
 
+#if IS_USED(MODULE_SNTP_ASYNC) || defined(DOXYGEN)
+#include "event/task.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -45,6 +49,59 @@ extern "C" {
  */
 int sntp_sync(sock_udp_ep_t *server, uint32_t timeout);
 
+#if IS_USED(MODULE_SNTP_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief   SNTP synchronization task forward declaration
+ */
+typedef struct sntp_task sntp_task_t;
+
+/**
+ * @brief   Called when an asynchronous synchronization finished
+ *
+ * @param[in] task      The task
+ * @param[in] result    0 on success, negative number on error as returned
+ *                      by @ref sntp_sync()
+ */
+typedef void (*sntp_task_cb_t)(sntp_task_t *task, int result);
+
+/**
+ * @brief   State of an asynchronous synchronization
+ *
+ * @note    Only available with module `sntp_async`.
+ */
+struct sntp_task {
+    event_task_t task;          /**< the event task */
+    sock_udp_t sock;            /**< sock to the time server */
+    sock_udp_ep_t server;       /**< the time server */
+    ntp_packet_t packet;        /**< request and response */
+    uint32_t timeout;           /**< timeout in microseconds */
+    sntp_task_cb_t cb;          /**< called when finished */
+    int result;                 /**< result of the synchronization */
+};
+
+/**
+ * @brief   Synchronize with time server without blocking
+ *
+ * Unlike @ref sntp_sync() no thread is blocked while waiting for the
+ * response: the synchronization runs as an @ref event_task_t on @p queue,
+ * so the thread handling @p queue can be shared with other protocols.
+ *
+ * @note    Only available with module `sntp_async`.
+ *
+ * @pre     @p task is not used by a synchronization that is still running
+ *
+ * @param[out] task     State of the synchronization, must stay valid until
+ *                      @p cb is called
+ * @param[in] queue     Event queue to run the synchronization on
+ * @param[in] server    The time server
+ * @param[in] timeout   Timeout for the server response in microseconds
+ * @param[in] cb        Called with the result once finished
+ */
+void sntp_sync_async(sntp_task_t *task, event_queue_t *queue,
+                     const sock_udp_ep_t *server, uint32_t timeout,
+                     sntp_task_cb_t cb);
+#endif
+
 /**
  * @brief Get real time offset from system time as returned by @ref xtimer_now64()
  *
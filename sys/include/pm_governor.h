@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_pm_governor Tickless idle governor
+ * @ingroup     sys_pm_layered
+ * @brief       Selects the deepest power mode that wakes up in time for the
+ *              next timer
+ *
+ * Without this module @ref pm_set_lowest() enters the lowest power mode not
+ * blocked. It does not know about the next timer, so a mode that takes long
+ * to wake up from may be entered right before a timer expires, and a clock
+ * blocking a mode for a timer far in the future keeps the CPU in light sleep.
+ *
+ * With this module @ref pm_set_lowest() instead
+ *
+ * 1. looks up the time until the next timer of @ref ZTIMER_USEC,
+ *    @ref ZTIMER_MSEC and @ref ZTIMER_SEC expires
+ * 2. suspends @ref ZTIMER_USEC, if it blocks a mode that @ref ZTIMER_MSEC
+ *    does not (e.g. as it is backed by an RTT) and the next microsecond
+ *    timer is far enough away: a millisecond timer wakes the CPU up in time
+ *    for the microsecond timer and the time passed is accounted for with
+ *    @ref ztimer_advance() on wakeup. This is only done if
+ *    @ref CONFIG_PM_GOVERNOR_SUSPEND_USEC is enabled, see the warning below.
+ * 3. enters the deepest mode not blocked whose wakeup latency and minimum
+ *    residency fit into the time until the next timer, or idles if none does
+ *
+ * The wakeup latency and minimum residency of each mode are set by
+ * @ref PM_GOVERNOR_MODES or at run time by @ref pm_governor_set_mode().
+ *
+ * @warning With @ref CONFIG_PM_GOVERNOR_SUSPEND_USEC, @ref ZTIMER_USEC does
+ *          not count while suspended on CPUs that stop its timer in the
+ *          entered mode. Its timers still fire in time (at most a
+ *          millisecond late), but its ztimer_now() and ztimer_now64() lag
+ *          behind real time by the time spent suspended, and the lag adds
+ *          up with every suspension. Everything measuring time with
+ *          @ref ZTIMER_USEC is affected, e.g. xtimer_now_usec64() and the
+ *          offset computed by @ref net_sntp. Only enable it if nothing
+ *          relies on @ref ZTIMER_USEC for timestamps.
+ *
+ * The number of times each mode was entered and the time spent in it is
+ * kept in @ref pm_governor_stats_t and printed by the `pm stats` shell
+ * command.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += pm_governor
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Tickless idle governor definitions
+ */
+
+#ifndef PM_GOVERNOR_H
+#define PM_GOVERNOR_H
+
+#include <stdint.h>
+
+#include "pm_layered.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_pm_governor_conf Tickless idle governor compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Default wakeup latency of a power mode in microseconds
+ */
+#ifndef CONFIG_PM_GOVERNOR_LATENCY_US
+#define CONFIG_PM_GOVERNOR_LATENCY_US       (0U)
+#endif
+
+/**
+ * @brief   Default minimum residency of a power mode in microseconds
+ */
+#ifndef CONFIG_PM_GOVERNOR_RESIDENCY_US
+#define CONFIG_PM_GOVERNOR_RESIDENCY_US     (0U)
+#endif
+
+/**
+ * @brief   Suspend @ref ZTIMER_USEC while sleeping, if it blocks a mode that
+ *          @ref ZTIMER_MSEC does not
+ *
+ * Off by default, as ztimer_now() of @ref ZTIMER_USEC then lags behind
+ * real time.
+ */
+#ifdef DOXYGEN
+#define CONFIG_PM_GOVERNOR_SUSPEND_USEC
+#endif
+
+/**
+ * @brief   Minimum time in milliseconds @ref ZTIMER_USEC is suspended for
+ */
+#ifndef CONFIG_PM_GOVERNOR_SUSPEND_MIN_MS
+#define CONFIG_PM_GOVERNOR_SUSPEND_MIN_MS   (2U)
+#endif
+/** @} */
+
+/**
+ * @brief   Parameters of a power mode
+ */
+typedef struct {
+    uint32_t latency_us;    /**< time to wake up from the mode */
+    uint32_t residency_us;  /**< minimum time in the mode to be worth it */
+} pm_governor_mode_t;
+
+/**
+ * @brief   Parameters of all power modes, lowest mode first
+ *
+ * To be defined by the CPU or board in periph_cpu.h or periph_conf.h.
+ */
+#ifndef PM_GOVERNOR_MODES
+#define PM_GOVERNOR_MODES   { [0 ... PM_NUM_MODES - 1] = { \
+                                  .latency_us = CONFIG_PM_GOVERNOR_LATENCY_US, \
+                                  .residency_us = CONFIG_PM_GOVERNOR_RESIDENCY_US \
+                              } }
+#endif
+
+/**
+ * @brief   The idle mode, entered if no power mode fits
+ */
+#define PM_GOVERNOR_IDLE    (PM_NUM_MODES)
+
+/**
+ * @brief   Statistics of the governor
+ */
+typedef struct {
+    /**
+     * @brief   Times a mode was entered, @ref PM_GOVERNOR_IDLE last
+     */
+    uint32_t entries[PM_NUM_MODES + 1];
+    /**
+     * @brief   Time in microseconds spent in a mode, @ref PM_GOVERNOR_IDLE
+     *          last
+     */
+    uint64_t residency_us[PM_NUM_MODES + 1];
+    uint32_t limited;       /**< times a lighter mode was entered for a timer */
+    uint32_t suspended;     /**< times @ref ZTIMER_USEC was suspended */
+} pm_governor_stats_t;
+
+/**
+ * @brief   Sets the parameters of a power mode
+ *
+ * @param[in] mode      a power mode
+ * @param[in] params    wakeup latency and minimum residency of @p mode
+ */
+void pm_governor_set_mode(unsigned mode, const pm_governor_mode_t *params);
+
+/**
+ * @brief   Gets the time until the next timer of any clock expires
+ *
+ * @return  the time in microseconds, UINT32_MAX if no timer is set
+ */
+uint32_t pm_governor_next_deadline_us(void);
+
+/**
+ * @brief   Selects the mode to enter
+ *
+ * @param[in] lowest    lowest mode not blocked
+ *
+ * @return  deepest mode not lower than @p lowest that wakes up in time for
+ *          the next timer
+ * @return  @ref PM_GOVERNOR_IDLE, if no mode does
+ */
+unsigned pm_governor_select(unsigned lowest);
+
+/**
+ * @brief   Gets the statistics
+ *
+ * @param[out] stats    the statistics
+ */
+void pm_governor_get_stats(pm_governor_stats_t *stats);
+
+/**
+ * @brief   Resets the statistics
+ */
+void pm_governor_reset_stats(void);
+
+/**
+ * @brief   Enters the deepest safe mode
+ *
+ * @internal    Called by @ref pm_set_lowest()
+ */
+void pm_governor_set_lowest(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PM_GOVERNOR_H */
+/** @} */
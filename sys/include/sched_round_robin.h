@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_round_robin Round robin scheduling
+ * @ingroup     sys
+ * @brief       Time slicing of threads of equal priority
+ *
+ * The RIOT scheduler only switches between threads of the same priority if
+ * the running thread blocks or yields. A compute bound thread starves all
+ * other threads of its priority. With this module the running thread is
+ * moved to the end of the runqueue of its priority once it ran for
+ * @ref CONFIG_SCHED_ROUND_ROBIN_SLICE_US without interruption, if other
+ * threads of that priority are ready to run.
+ *
+ * Only the priorities set in @ref CONFIG_SCHED_ROUND_ROBIN_PRIO_MASK are
+ * sliced. If @ref schedstatistics is used as well, the number of time
+ * slices that expired for a thread is counted in schedstat_t::slices.
+ *
+ * ```
+ * USEMODULE += sched_round_robin
+ * ```
+ *
+ * @note    If auto_init is disabled, `sched_round_robin_init()` needs to be
+ *          called (after `init_schedstatistics()`, if used).
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling
+ */
+
+#ifndef SCHED_ROUND_ROBIN_H
+#define SCHED_ROUND_ROBIN_H
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Length of a time slice in microseconds
+ */
+#ifndef CONFIG_SCHED_ROUND_ROBIN_SLICE_US
+#define CONFIG_SCHED_ROUND_ROBIN_SLICE_US       (10000U)
+#endif
+
+/**
+ * @brief   Bit mask of the priorities to slice
+ *
+ * Bit n set enables time slicing for priority n. Defaults to all but the
+ * lowest priority, which is used by the idle thread.
+ */
+#ifndef CONFIG_SCHED_ROUND_ROBIN_PRIO_MASK
+#define CONFIG_SCHED_ROUND_ROBIN_PRIO_MASK      ((1UL << (SCHED_PRIO_LEVELS - 1)) - 1)
+#endif
+
+/**
+ * @brief   Registers the round robin scheduler callback
+ */
+void sched_round_robin_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_ROUND_ROBIN_H */
+/** @} */
@@ -30,6 +30,7 @@
 #define SCHEDSTATISTICS_H
 
 #include <stdint.h>
+#include "sched.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -43,6 +44,10 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+#if defined(MODULE_SCHED_ROUND_ROBIN) || defined(DOXYGEN)
+    unsigned int slices;     /**< How often the time slice of this thread
+                                  expired with @ref sys_sched_round_robin */
+#endif
 } schedstat_t;
 
 /**
@@ -56,6 +61,19 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ * @brief   Updates the statistics on a context switch
+ *
+ * @internal
+ *
+ * Registered by @ref init_schedstatistics. Modules replacing the scheduler
+ * callback call it from their own one.
+ *
+ * @param[in] active_thread     The thread that was running
+ * @param[in] next_thread       The thread that is to run
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
 #ifdef __cplusplus
 }
 #endif
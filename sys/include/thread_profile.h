@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_thread_profile Thread profiling
+ * @ingroup     sys
+ * @brief       Cycle accurate per thread CPU time and latency accounting
+ *
+ * Unlike @ref sys_schedstatistics this module measures in the finest time
+ * base available:
+ *
+ * - the DWT cycle counter on Cortex-M3 and up
+ * - `clock_gettime(CLOCK_MONOTONIC)` in nanoseconds on native
+ * - @ref ZTIMER_USEC everywhere else
+ *
+ * See @ref THREAD_PROFILE_TICKS_PER_SEC for the resolution of a tick.
+ *
+ * For every thread it records
+ *
+ * - the time the thread ran
+ * - the number of times the thread was scheduled
+ * - a histogram of its wakeup latency, i.e. the time from it being put on
+ *   the run queue by @ref sched_set_status() to it actually running
+ *
+ * When the pseudomodule `thread_profile_irq` is used, the time spent with
+ * interrupts disabled via @ref irq_disable() is recorded in a histogram
+ * as well, together with the location of the longest critical section. This
+ * hooks into every critical section and is only supported on Cortex-M and
+ * native.
+ *
+ * Histograms have logarithmic buckets: bucket `i` counts durations of
+ * `[2^i, 2^(i + 1))` ticks, the first bucket also counts 0 and the last one
+ * everything longer.
+ *
+ * The data is printed with the `tprof` shell command or exported with
+ * @ref thread_profile_dump() in the binary format described in
+ * @ref thread_profile_dump_hdr_t.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += thread_profile
+ * USEMODULE += thread_profile_irq
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Thread profiling definitions
+ */
+
+#ifndef THREAD_PROFILE_H
+#define THREAD_PROFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_thread_profile_conf Thread profiling compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of buckets of a histogram
+ */
+#ifndef CONFIG_THREAD_PROFILE_HIST_BUCKETS
+#define CONFIG_THREAD_PROFILE_HIST_BUCKETS  (16U)
+#endif
+/** @} */
+
+#if defined(CPU_CORE_CORTEX_M3) || defined(CPU_CORE_CORTEX_M4) || \
+    defined(CPU_CORE_CORTEX_M4F) || defined(CPU_CORE_CORTEX_M7) || \
+    defined(CPU_CORE_CORTEX_M33) || defined(DOXYGEN)
+/**
+ * @brief   Ticks are counted by the DWT cycle counter
+ */
+#define THREAD_PROFILE_DWT                  (1)
+#endif
+
+/**
+ * @brief   Ticks per second
+ */
+#if defined(THREAD_PROFILE_DWT) || defined(DOXYGEN)
+#define THREAD_PROFILE_TICKS_PER_SEC        (CLOCK_CORECLOCK)
+#elif defined(CPU_NATIVE)
+#define THREAD_PROFILE_TICKS_PER_SEC        (1000000000LU)
+#else
+#define THREAD_PROFILE_TICKS_PER_SEC        (1000000LU)
+#endif
+
+/**
+ * @brief   A point in time in ticks
+ *
+ * 64 bit on native, as nanoseconds wrap after about 4 seconds. Elsewhere a
+ * single measured duration must stay below 2^32 ticks.
+ */
+#if defined(CPU_NATIVE)
+typedef uint64_t thread_profile_ticks_t;
+#else
+typedef uint32_t thread_profile_ticks_t;
+#endif
+
+/**
+ * @brief   A histogram of durations
+ */
+typedef struct {
+    uint32_t buckets[CONFIG_THREAD_PROFILE_HIST_BUCKETS];   /**< counts per bucket */
+    uint32_t max;                   /**< longest duration in ticks */
+} thread_profile_hist_t;
+
+/**
+ * @brief   Profile of a thread
+ */
+typedef struct {
+    uint64_t runtime;               /**< ticks the thread ran */
+    uint32_t schedules;             /**< times the thread was scheduled */
+    thread_profile_hist_t latency;  /**< wakeup latency histogram */
+    thread_profile_ticks_t laststart;   /**< time the thread was last scheduled */
+    thread_profile_ticks_t woken;   /**< time the thread was last woken up */
+    bool pending;                   /**< thread was woken and did not run yet */
+} thread_profile_t;
+
+/**
+ * @brief   Profile of critical sections
+ */
+typedef struct {
+    thread_profile_hist_t hist;     /**< duration histogram */
+    const void *longest;            /**< location of the longest section */
+    kernel_pid_t longest_pid;       /**< thread running the longest section */
+    thread_profile_ticks_t start;   /**< time interrupts were disabled */
+    bool off;                       /**< interrupts are disabled */
+} thread_profile_irq_t;
+
+/**
+ * @brief   Magic number of a dump, "TPRF" in little endian
+ */
+#define THREAD_PROFILE_DUMP_MAGIC           (0x46525054LU)
+
+/**
+ * @brief   Version of the dump format
+ */
+#define THREAD_PROFILE_DUMP_VERSION         (1U)
+
+/**
+ * @brief   Header of a dump
+ *
+ * All fields of a dump are little endian. The header is followed by
+ * thread_profile_dump_hdr_t::records records of a thread, each made of
+ *
+ * | field        | size                          |
+ * |--------------|-------------------------------|
+ * | pid          | 2                             |
+ * | reserved     | 2                             |
+ * | schedules    | 4                             |
+ * | runtime      | 8                             |
+ * | latency max  | 4                             |
+ * | latency      | 4 * thread_profile_dump_hdr_t::buckets |
+ *
+ * PID 0 stands for the time no thread ran, if there is no idle thread. The
+ * records are followed by the critical section profile, made of
+ *
+ * | field        | size                          |
+ * |--------------|-------------------------------|
+ * | longest pid  | 2                             |
+ * | reserved     | 2                             |
+ * | longest at   | 8                             |
+ * | max          | 4                             |
+ * | histogram    | 4 * thread_profile_dump_hdr_t::buckets |
+ */
+typedef struct {
+    uint32_t magic;                 /**< @ref THREAD_PROFILE_DUMP_MAGIC */
+    uint8_t version;                /**< @ref THREAD_PROFILE_DUMP_VERSION */
+    uint8_t buckets;                /**< buckets per histogram */
+    uint16_t records;               /**< number of thread records */
+    uint32_t ticks_per_sec;         /**< @ref THREAD_PROFILE_TICKS_PER_SEC */
+} thread_profile_dump_hdr_t;
+
+/**
+ * @brief   Size of the record of a thread in a dump
+ */
+#define THREAD_PROFILE_DUMP_RECORD_SIZE     (20U + (4U * CONFIG_THREAD_PROFILE_HIST_BUCKETS))
+
+/**
+ * @brief   Size of the critical section profile in a dump
+ */
+#define THREAD_PROFILE_DUMP_IRQ_SIZE        (16U + (4U * CONFIG_THREAD_PROFILE_HIST_BUCKETS))
+
+/**
+ * @brief   Maximum size of a dump
+ */
+#define THREAD_PROFILE_DUMP_SIZE_MAX        (sizeof(thread_profile_dump_hdr_t) + \
+                                             ((KERNEL_PID_LAST + 1) * \
+                                              THREAD_PROFILE_DUMP_RECORD_SIZE) + \
+                                             THREAD_PROFILE_DUMP_IRQ_SIZE)
+
+/**
+ * @brief   Initializes the profiling
+ *
+ * @note    Called by @ref sys_auto_init
+ */
+void thread_profile_init(void);
+
+/**
+ * @brief   Gets the current time
+ *
+ * @return  the current time in ticks
+ */
+thread_profile_ticks_t thread_profile_now(void);
+
+/**
+ * @brief   Gets the profile of a thread
+ *
+ * @param[in] pid   a thread, KERNEL_PID_UNDEF for the time no thread ran
+ *
+ * @return  the profile of @p pid
+ */
+const thread_profile_t *thread_profile_get(kernel_pid_t pid);
+
+/**
+ * @brief   Gets the profile of critical sections
+ *
+ * @return  the profile, all zero without `thread_profile_irq`
+ */
+const thread_profile_irq_t *thread_profile_irq_get(void);
+
+/**
+ * @brief   Resets all profiles
+ */
+void thread_profile_reset(void);
+
+/**
+ * @brief   Converts ticks to microseconds
+ *
+ * @param[in] ticks     a duration in ticks
+ *
+ * @return  @p ticks in microseconds
+ */
+uint64_t thread_profile_ticks_to_us(uint64_t ticks);
+
+/**
+ * @brief   Writes all profiles in the binary dump format
+ *
+ * @param[out] buf  buffer for the dump, NULL to get the size of the dump
+ * @param[in] len   size of @p buf
+ *
+ * @return  size of the dump
+ * @return  -ENOBUFS, if @p buf is too small
+ */
+ssize_t thread_profile_dump(void *buf, size_t len);
+
+/**
+ * @brief   Prints all profiles
+ */
+void thread_profile_print(void);
+
+/**
+ * @brief   Records a thread being put on the run queue
+ *
+ * @internal    Called by @ref sched_set_status()
+ *
+ * @param[in] pid   the thread
+ */
+void thread_profile_wakeup(kernel_pid_t pid);
+
+/**
+ * @brief   Records a context switch
+ *
+ * @internal    Called by the scheduler with the same semantics as the
+ *              callback of @ref sched_register_cb()
+ *
+ * @param[in] active    thread being descheduled or KERNEL_PID_UNDEF
+ * @param[in] next      thread being scheduled or KERNEL_PID_UNDEF
+ */
+void thread_profile_sched(kernel_pid_t active, kernel_pid_t next);
+
+/**
+ * @brief   Records interrupts being disabled
+ *
+ * @internal    Called by @ref irq_disable(), if interrupts were enabled
+ *
+ * @param[in] where     caller of @ref irq_disable(), NULL for the caller of
+ *                      this function
+ */
+void thread_profile_irq_off(const void *where);
+
+/**
+ * @brief   Records interrupts being enabled again
+ *
+ * @internal    Called by @ref irq_enable() and @ref irq_restore() with
+ *              interrupts still disabled
+ */
+void thread_profile_irq_on(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREAD_PROFILE_H */
+/** @} */
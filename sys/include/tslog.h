@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_tslog   Time-series log
+ * @ingroup     sys
+ * @brief       Append-only log of time stamped records stored on an MTD
+ *
+ * This module stores time stamped records, e.g. @ref phydat_t readings
+ * of sensors found in @ref sys_saul_reg, in a ring of sectors of an MTD
+ * device without the overhead of a file system.
+ *
+ * ## Layout
+ *
+ * Each sector starts with a header holding a magic number, a sequence
+ * number and the time stamp of the newest record at the time the sector was
+ * started. It is followed by records, each made up of a header (time stamp,
+ * payload length and a CRC-16-CCITT over both and the payload) and the
+ * payload, padded to a multiple of four bytes. Records do not cross sector
+ * boundaries. When the log is full, the oldest sector is erased.
+ *
+ * Records may be of fixed size or vary in length. Time stamps are chosen by
+ * the user, but must not decrease. This allows to locate a point in time with
+ * a binary search over the sector headers, followed by a scan of a single
+ * sector.
+ *
+ * ## Power loss
+ *
+ * The payload of a record is written before its header, so a record becomes
+ * valid only when it is complete. Likewise, the magic number of a sector
+ * header is written last. @ref tslog_init scans the newest sector for the end
+ * of the log. If it finds a record with a bad CRC or stray data after the
+ * last valid record, the rest of that sector is skipped, so that nothing is
+ * programmed on top of a torn write. @ref tslog_read skips the rest of a
+ * sector on a bad CRC as well.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += tslog
+ * ```
+ *
+ * ```
+ * static tslog_t log;
+ *
+ * tslog_init(&log, MTD_0, 0, 16);
+ *
+ * phydat_t data;
+ * saul_reg_read(dev, &data);
+ * tslog_append(&log, ztimer_now(ZTIMER_SEC), &data, sizeof(data));
+ *
+ * tslog_pos_t pos;
+ * uint32_t time;
+ * tslog_seek(&log, &pos, start);
+ * while (tslog_read(&log, &pos, &time, &data, sizeof(data)) >= 0 && time < end) {
+ *     ...
+ * }
+ * ```
+ *
+ * @note    Positions obtained by @ref tslog_seek become invalid once the
+ *          sector they point to is reused for new records.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Time-series log interface
+ */
+
+#ifndef TSLOG_H
+#define TSLOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the header at the start of every sector
+ */
+#define TSLOG_SECTOR_HDR_SIZE   (12U)
+
+/**
+ * @brief   Size of the header of every record
+ */
+#define TSLOG_RECORD_HDR_SIZE   (8U)
+
+/**
+ * @brief   Bytes used on flash by a record with @p len bytes of payload
+ */
+#define TSLOG_RECORD_SIZE(len)  (TSLOG_RECORD_HDR_SIZE + (((len) + 3U) & ~3U))
+
+/**
+ * @brief   Time-series log descriptor
+ */
+typedef struct {
+    mtd_dev_t *mtd;             /**< backing MTD device */
+    uint32_t first_sector;      /**< first sector of the log */
+    uint32_t sector_numof;      /**< number of sectors of the log */
+    uint32_t tail;              /**< index of the oldest sector in use */
+    uint32_t head;              /**< index of the sector written to */
+    uint32_t head_offset;       /**< offset of the next record in @p head */
+    uint32_t seq;               /**< sequence number of @p head */
+    uint32_t last_time;         /**< time stamp of the newest record */
+    mutex_t lock;               /**< guards the descriptor */
+} tslog_t;
+
+/**
+ * @brief   Position of a record in the log
+ */
+typedef struct {
+    uint32_t sector;            /**< index of the sector */
+    uint32_t offset;            /**< offset of the record header */
+} tslog_pos_t;
+
+/**
+ * @brief   Open the log, recovering from power loss if needed
+ *
+ * Sectors that do not belong to the log are erased on first use, so a
+ * new log needs no formatting.
+ *
+ * @param[out] log          log descriptor
+ * @param[in]  mtd          initialized MTD device
+ * @param[in]  first_sector first sector of @p mtd to use
+ * @param[in]  sector_numof number of sectors to use, at least 2
+ *
+ * @return 0 on success
+ * @return < 0 value on error
+ */
+int tslog_init(tslog_t *log, mtd_dev_t *mtd, uint32_t first_sector,
+               uint32_t sector_numof);
+
+/**
+ * @brief   Append a record
+ *
+ * @param[in] log       log descriptor
+ * @param[in] time      time stamp, not lower than that of the last record,
+ *                      UINT32_MAX is reserved
+ * @param[in] data      payload
+ * @param[in] len       payload length
+ *
+ * @return 0 on success
+ * @return -EINVAL if @p time is lower than the time of the last record or
+ *         UINT32_MAX
+ * @return -EMSGSIZE if the record does not fit into a sector
+ * @return < 0 value on MTD error
+ */
+int tslog_append(tslog_t *log, uint32_t time, const void *data, size_t len);
+
+/**
+ * @brief   Find the first record with a time stamp of at least @p time
+ *
+ * @param[in]  log      log descriptor
+ * @param[out] pos      position of the record
+ * @param[in]  time     time stamp to look for, 0 for the oldest record
+ *
+ * @return 0 on success
+ * @return -ENOENT if there is no such record
+ * @return < 0 value on MTD error
+ */
+int tslog_seek(tslog_t *log, tslog_pos_t *pos, uint32_t time);
+
+/**
+ * @brief   Read the record at @p pos and advance @p pos to the next one
+ *
+ * Corrupted records are skipped along with the rest of their sector.
+ *
+ * @param[in]    log    log descriptor
+ * @param[inout] pos    position of the record
+ * @param[out]   time   time stamp of the record, may be NULL
+ * @param[out]   data   buffer for the payload, may be NULL
+ * @param[in]    len    size of @p data, longer payloads are truncated
+ *
+ * @return payload length of the record
+ * @return -ENOENT at the end of the log
+ * @return < 0 value on MTD error
+ */
+int tslog_read(tslog_t *log, tslog_pos_t *pos, uint32_t *time,
+               void *data, size_t len);
+
+/**
+ * @brief   Remove all records
+ *
+ * @param[in] log       log descriptor
+ *
+ * @return 0 on success
+ * @return < 0 value on MTD error
+ */
+int tslog_clear(tslog_t *log);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TSLOG_H */
+/** @} */
@@ -14,6 +14,29 @@
  *
  * @attention   Buffer size must be a power of two!
  *
+ * All functions taking a @ref tsrb_t are safe to call from any number of
+ * threads and interrupts, as they run with interrupts disabled. Blocks of
+ * bytes are copied with at most two calls to `memcpy()`, one up to the end
+ * of the buffer and one from its start.
+ *
+ * ## Zero-copy access
+ *
+ * A single producer can write into the buffer directly: @ref tsrb_reserve()
+ * returns the free space up to the end of the buffer and @ref tsrb_commit()
+ * makes the bytes written there available for reading. Likewise a single
+ * consumer gets the bytes up to the end of the buffer by @ref tsrb_peek() and
+ * frees them by @ref tsrb_consume(). E.g. a DMA transfer can be started
+ * on the reserved or peeked memory this way.
+ *
+ * ## Multiple producers
+ *
+ * @ref tsrb_mp_t is a ringbuffer many threads and interrupts add bytes to by
+ * @ref tsrb_mp_add() without disabling interrupts while copying: space is
+ * reserved by an atomic compare and swap, so a long copy does not delay
+ * interrupts. The bytes become readable when no producer is writing anymore.
+ * The single consumer uses the functions for @ref tsrb_t on
+ * tsrb_mp_t::rb.
+ *
  * @file
  * @brief       Thread-safe ringbuffer interface definition
  *
@@ -27,6 +50,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+#include "c11_atomics_compat.hpp"
+#else
+#include <stdatomic.h>
+#endif
+
 #include "irq.h"
 
 #ifdef __cplusplus
@@ -165,6 +194,95 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get contiguous free space in ringbuffer to write to
+ *
+ * The space stays free until @ref tsrb_commit() is called. Only a single
+ * producer may use this function, not together with @ref tsrb_add() or
+ * @ref tsrb_add_one().
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the free space
+ * @return      nr of bytes free at @p data, up to the end of the buffer
+ */
+unsigned tsrb_reserve(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Make bytes written to reserved space available for reading
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written, at most as returned by
+ *                  @ref tsrb_reserve()
+ */
+void tsrb_commit(tsrb_t *rb, unsigned n);
+
+/**
+ * @brief       Get contiguous bytes in ringbuffer to read from
+ *
+ * The bytes stay in the ringbuffer until @ref tsrb_consume() is called. Only
+ * a single consumer may use this function, not together with
+ * @ref tsrb_get(), @ref tsrb_get_one() or @ref tsrb_drop().
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the bytes
+ * @return      nr of bytes available at @p data, up to the end of the buffer
+ */
+unsigned tsrb_peek(const tsrb_t *rb, const uint8_t **data);
+
+/**
+ * @brief       Free bytes that were read
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes read, at most as returned by @ref tsrb_peek()
+ */
+void tsrb_consume(tsrb_t *rb, unsigned n);
+
+/**
+ * @brief     Maximum buffer size of a @ref tsrb_mp_t
+ */
+#define TSRB_MP_SIZE_MAX        (32768U)
+
+/**
+ * @brief     multi-producer thread-safe ringbuffer struct
+ */
+typedef struct {
+    tsrb_t rb;                  /**< ringbuffer, read from by the consumer */
+    /**
+     * @brief   reserved writes modulo 2^24 in the upper 24 bit and number of
+     *          producers still writing in the lower 8 bit
+     */
+    atomic_uint_least32_t state;
+} tsrb_mp_t;
+
+/**
+ * @brief Static initializer
+ */
+#define TSRB_MP_INIT(BUF) { TSRB_INIT(BUF), ATOMIC_VAR_INIT(0) }
+
+/**
+ * @brief        Initialize a multi-producer tsrb.
+ * @param[out]   rb        Datum to initialize.
+ * @param[in]    buffer    Buffer to use by tsrb.
+ * @param[in]    bufsize   `sizeof (buffer)`, must be power of 2 and at most
+ *                         @ref TSRB_MP_SIZE_MAX
+ */
+void tsrb_mp_init(tsrb_mp_t *rb, uint8_t *buffer, unsigned bufsize);
+
+/**
+ * @brief       Add bytes to multi-producer ringbuffer
+ *
+ * Safe to call from up to 255 threads and interrupts at the same time. A
+ * producer interrupted while reserving space must resume before 2^24 bytes
+ * were added by others. Must not be mixed with adding to tsrb_mp_t::rb
+ * directly. While producers
+ * are writing, @ref tsrb_free() and @ref tsrb_full() on tsrb_mp_t::rb do
+ * not account for their reserved space.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   src buffer to read from
+ * @param[in]   n   max number of bytes to read from @p src
+ * @return      nr of bytes read from @p src
+ */
+int tsrb_mp_add(tsrb_mp_t *rb, const uint8_t *src, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -150,6 +150,30 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+/**
+ * @defgroup sys_vfs_buffered_config VFS buffered I/O configuration
+ * @ingroup config
+ * @brief   Compile-time configuration for the optional `vfs_buffered` module
+ * @{
+ */
+#ifndef CONFIG_VFS_BUFFER_SIZE
+/**
+ * @brief Size of the read-ahead/write-back buffer attached to a file
+ *
+ * Reads and writes smaller than this size are served from the buffer, larger
+ * transfers bypass it and go straight to the file system driver.
+ */
+#define CONFIG_VFS_BUFFER_SIZE (64)
+#endif
+
+#ifndef CONFIG_VFS_BUFFER_NUMOF
+/**
+ * @brief Number of buffers in the pool shared by all open files
+ */
+#define CONFIG_VFS_BUFFER_NUMOF (2)
+#endif
+/** @} */
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -739,6 +763,60 @@ ssize_t vfs_read(int fd, void *dest, size_t count);
  */
 ssize_t vfs_write(int fd, const void *src, size_t count);
 
+/**
+ * @brief Attach a read-ahead/write-back buffer to an open file
+ *
+ * Once attached, calls to @ref vfs_read and @ref vfs_write on @p fd smaller
+ * than @p size are served from a buffer taken from a pool of
+ * @ref CONFIG_VFS_BUFFER_NUMOF buffers. Pending writes are flushed to the
+ * file system driver when the buffer runs full, on @ref vfs_lseek,
+ * @ref vfs_fstat, @ref vfs_buffer_flush, @ref vfs_buffer_detach and
+ * @ref vfs_close.
+ *
+ * Every buffer in the pool occupies @ref CONFIG_VFS_BUFFER_SIZE bytes, a
+ * smaller @p size only limits how much of it is used for @p fd, e.g. to match
+ * the page size of the underlying file system.
+ *
+ * @note Only available with module `vfs_buffered`
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  size     buffer size in bytes, 0 for @ref CONFIG_VFS_BUFFER_SIZE
+ *
+ * @return 0 on success
+ * @return -EBADF if @p fd is not a valid file descriptor
+ * @return -EINVAL if @p size exceeds @ref CONFIG_VFS_BUFFER_SIZE
+ * @return -EALREADY if @p fd already has a buffer attached
+ * @return -ENOMEM if the buffer pool is exhausted
+ */
+int vfs_buffer_attach(int fd, size_t size);
+
+/**
+ * @brief Flush pending writes and detach the buffer from an open file
+ *
+ * @note Only available with module `vfs_buffered`
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ *
+ * @return 0 on success, or if no buffer was attached
+ * @return <0 on error, the buffer stays attached in this case
+ */
+int vfs_buffer_detach(int fd);
+
+/**
+ * @brief Write out any pending data buffered for an open file
+ *
+ * Read-ahead data is discarded and the position of the underlying file is
+ * rewound to the position seen by the user.
+ *
+ * @note Only available with module `vfs_buffered`
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ *
+ * @return 0 on success, or if no buffer was attached
+ * @return <0 on error
+ */
+int vfs_buffer_flush(int fd);
+
 /**
  * @brief Open a directory for reading with readdir
  *
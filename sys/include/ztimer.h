@@ -171,6 +171,21 @@
  * underflows.
  *
  *
+ * ## Timer coalescing and batching
+ *
+ * Every expiring timer costs an interrupt and possibly a wakeup from a low
+ * power mode. Timers that do not need to fire at an exact time can be set with
+ * ztimer_set_with_slack(), allowing ztimer to delay them by up to the given
+ * slack so they fire in the same interrupt as other timers.
+ *
+ * ztimer_handler() fires all timers due and only programs the underlying
+ * clock once afterwards, also if the callbacks set or remove timers on the
+ * clock, e.g. periodic timers setting themselves again.
+ *
+ * With the pseudomodule `ztimer_stats`, every clock counts its interrupts and
+ * wakeups in ztimer_clock_t::stats.
+ *
+ *
  * ## Configuration and convention
  *
  * As timer hardware and capabilities is diverse and ztimer allows configuring
@@ -318,8 +333,23 @@ typedef struct {
      * @param   clock       ztimer clock to cancel a pending alarm, if any
      */
     void (*cancel)(ztimer_clock_t *clock);
+
+    /**
+     * @brief   Get the current count of the timer as 64 bit value, optional
+     * @param   clock       ztimer clock to get the current time from
+     */
+    uint64_t (*now64)(ztimer_clock_t *clock);
 } ztimer_ops_t;
 
+/**
+ * @brief   Interrupt statistics of a clock
+ */
+typedef struct {
+    uint32_t irqs;                  /**< calls of ztimer_handler()          */
+    uint32_t wakeups;               /**< calls that fired at least a timer  */
+    uint32_t fired;                 /**< number of timers fired             */
+} ztimer_stats_t;
+
 /**
  * @brief   ztimer device structure
  */
@@ -330,6 +360,14 @@ struct ztimer_clock {
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
     uint16_t adjust_sleep;          /**< will be subtracted on every sleep(),
                                          in addition to adjust_set          */
+    uint8_t in_handler;             /**< ztimer_handler() is firing timers,
+                                         set() is deferred until it is done */
+#if !MODULE_ZTIMER_NOW64 || DOXYGEN
+    uint8_t now64_used;             /**< ztimer_now64() tracks the wraps of
+                                         ztimer_now()                       */
+    uint32_t now64_hi;              /**< wraps of ztimer_now() counted      */
+    uint32_t now64_last;            /**< ztimer_now() last observed         */
+#endif
 #if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64 || DOXYGEN
     /* values used for checkpointed intervals and 32bit extension */
     uint32_t max_value;             /**< maximum relative timer value       */
@@ -339,6 +377,9 @@ struct ztimer_clock {
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run */
 #endif
+#if MODULE_ZTIMER_STATS || DOXYGEN
+    ztimer_stats_t stats;           /**< interrupt statistics               */
+#endif
 };
 
 /**
@@ -362,6 +403,25 @@ void ztimer_handler(ztimer_clock_t *clock);
  */
 void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock that may fire late to save interrupts
+ *
+ * @p timer fires between @p val and @p val + @p slack ticks from now: together
+ * with the first timer already set in that window, or at its end if there is
+ * none, so that timers set later can join it.
+ *
+ * @note The memory pointed to by @p timer is not copied and must
+ *       remain in scope until the callback is fired or the timer
+ *       is removed via @ref ztimer_remove
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         earliest timer target (relative ticks from now)
+ * @param[in]   slack       ticks @p timer may fire after @p val
+ */
+void ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                           uint32_t val, uint32_t slack);
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -460,6 +520,31 @@ static inline ztimer_now_t ztimer_now(ztimer_clock_t *clock)
     }
 }
 
+/**
+ * @brief   Get the current time from a clock as 64 bit value
+ *
+ * Unlike the module `ztimer_now64`, which makes ztimer_now() of every clock
+ * 64 bit wide at the cost of an interrupt every half period of each clock,
+ * this only extends the clocks it is called on, and only those not based on
+ * another clock:
+ *
+ * - a clock converting another clock scales the 64 bit time of that clock
+ * - a clock with a 64 bit counter (e.g. @ref ztimer_periph_ptp_t) reads it
+ * - any other clock counts the wraps of its ztimer_now(), which ztimer
+ *   observes whenever it works on the clock anyway. While no timer is set on
+ *   the clock, it wakes up every half wrap of ztimer_now() to observe it, as
+ *   with the module `ztimer_now64`, but only for this clock.
+ *
+ * All of them take constant time. The wraps of a clock are tracked from the
+ * first call on, so only differences between the returned values are
+ * meaningful.
+ *
+ * @param[in]   clock          ztimer clock to operate on
+ *
+ * @return  Current count on @p clock
+ */
+uint64_t ztimer_now64(ztimer_clock_t *clock);
+
 /**
  * @brief Suspend the calling thread until the time (@p last_wakeup + @p period)
  *
@@ -559,6 +644,28 @@ int ztimer_mutex_lock_timeout(ztimer_clock_t *clock, mutex_t *mutex,
 int ztimer_rmutex_lock_timeout(ztimer_clock_t *clock, rmutex_t *rmutex,
                                uint32_t timeout);
 
+/**
+ * @brief   Get the time until the next timer of a clock expires
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ *
+ * @return  ticks until the first timer of @p clock expires, 0 if it is due
+ * @return  UINT32_MAX if no timer is set on @p clock
+ */
+uint32_t ztimer_until_next(ztimer_clock_t *clock);
+
+/**
+ * @brief   Accounts for time a clock did not count
+ *
+ * Moves the timers of @p clock closer to expiry by @p ticks, e.g. after its
+ * counter was stopped in a low power mode. Timers that expire by this fire
+ * right away. ztimer_now() of @p clock is not changed.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   ticks       ticks the clock missed
+ */
+void ztimer_advance(ztimer_clock_t *clock, uint32_t ticks);
+
 /**
  * @brief   Update ztimer clock head list offset
  *
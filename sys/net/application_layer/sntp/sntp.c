@@ -18,10 +18,14 @@
  * @}
  */
 
+#include <errno.h>
 #include <string.h>
 #include "net/sntp.h"
 #include "net/ntp_packet.h"
 #include "net/sock/udp.h"
+#if IS_USED(MODULE_SNTP_ASYNC)
+#include "net/sock/async.h"
+#endif
 #include "xtimer.h"
 #include "mutex.h"
 #include "byteorder.h"
@@ -34,6 +38,22 @@ static int64_t _sntp_offset = 0;
 static mutex_t _sntp_mutex = MUTEX_INIT;
 static ntp_packet_t _sntp_packet;
 
+static void _set_offset(const ntp_packet_t *packet)
+{
+    mutex_lock(&_sntp_mutex);
+    _sntp_offset = (((int64_t)byteorder_ntohl(packet->transmit.seconds)) * US_PER_SEC) +
+                   ((((int64_t)byteorder_ntohl(packet->transmit.fraction)) * 232)
+                   / 1000000) - xtimer_now_usec64();
+    mutex_unlock(&_sntp_mutex);
+}
+
+static void _init_request(ntp_packet_t *packet)
+{
+    memset(packet, 0, sizeof(*packet));
+    ntp_packet_set_vn(packet);
+    ntp_packet_set_mode(packet, NTP_MODE_CLIENT);
+}
+
 int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
 {
     int result;
@@ -45,9 +65,7 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
         DEBUG("Error creating UDP sock\n");
         return result;
     }
-    memset(&_sntp_packet, 0, sizeof(_sntp_packet));
-    ntp_packet_set_vn(&_sntp_packet);
-    ntp_packet_set_mode(&_sntp_packet, NTP_MODE_CLIENT);
+    _init_request(&_sntp_packet);
 
     if ((result = (int)sock_udp_send(&_sntp_sock,
                                      &_sntp_packet,
@@ -67,14 +85,77 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
         return result;
     }
     sock_udp_close(&_sntp_sock);
-    mutex_lock(&_sntp_mutex);
-    _sntp_offset = (((int64_t)byteorder_ntohl(_sntp_packet.transmit.seconds)) * US_PER_SEC) +
-                   ((((int64_t)byteorder_ntohl(_sntp_packet.transmit.fraction)) * 232)
-                   / 1000000) - xtimer_now_usec64();
-    mutex_unlock(&_sntp_mutex);
+    _set_offset(&_sntp_packet);
     return 0;
 }
 
+#if IS_USED(MODULE_SNTP_ASYNC)
+static void _recv_cb(sock_udp_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)sock;
+    if (type & SOCK_ASYNC_MSG_RECV) {
+        event_task_wake(arg);
+    }
+}
+
+static int _sync_task(event_task_t *event_task)
+{
+    sntp_task_t *task = container_of(event_task, sntp_task_t, task);
+
+    EVENT_TASK_BEGIN(event_task);
+    if ((task->result = sock_udp_create(&task->sock, NULL, &task->server,
+                                        0)) < 0) {
+        DEBUG("Error creating UDP sock\n");
+        EVENT_TASK_EXIT(event_task);
+    }
+    sock_udp_set_cb(&task->sock, _recv_cb, event_task);
+    _init_request(&task->packet);
+    if ((task->result = (int)sock_udp_send(&task->sock, &task->packet,
+                                           sizeof(task->packet), NULL)) < 0) {
+        DEBUG("Error sending message\n");
+        sock_udp_close(&task->sock);
+        EVENT_TASK_EXIT(event_task);
+    }
+    event_task_set_timeout(event_task, ZTIMER_USEC, task->timeout);
+    /* the thread is free for other events until the response or the
+     * timeout wakes the task up */
+    EVENT_TASK_WAIT_UNTIL(event_task,
+                          ((task->result = (int)sock_udp_recv(&task->sock,
+                                                              &task->packet,
+                                                              sizeof(task->packet),
+                                                              0, NULL)) != -EAGAIN) ||
+                          event_task_timed_out(event_task));
+    sock_udp_close(&task->sock);
+    if (task->result == -EAGAIN) {
+        task->result = -ETIMEDOUT;
+    }
+    if (task->result < 0) {
+        DEBUG("Error receiving message\n");
+        EVENT_TASK_EXIT(event_task);
+    }
+    _set_offset(&task->packet);
+    task->result = 0;
+    EVENT_TASK_END(event_task);
+}
+
+static void _sync_done(event_task_t *event_task)
+{
+    sntp_task_t *task = container_of(event_task, sntp_task_t, task);
+
+    task->cb(task, task->result);
+}
+
+void sntp_sync_async(sntp_task_t *task, event_queue_t *queue,
+                     const sock_udp_ep_t *server, uint32_t timeout,
+                     sntp_task_cb_t cb)
+{
+    task->server = *server;
+    task->timeout = timeout;
+    task->cb = cb;
+    event_task_start(&task->task, queue, _sync_task, _sync_done);
+}
+#endif
+
 int64_t sntp_get_offset(void)
 {
     int64_t result;
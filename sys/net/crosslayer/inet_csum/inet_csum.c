@@ -13,13 +13,88 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* word type that may alias the (byte) buffer */
+typedef uint32_t __attribute__((__may_alias__)) _word_t;
+
+static uint16_t _fold(uint64_t sum)
+{
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return sum;
+}
+
+static uint16_t _load16(uint8_t first, uint8_t second)
+{
+    uint16_t word;
+    const uint8_t bytes[] = { first, second };
+
+    memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+/*
+ * One's complement sum of @p buf taken as 16 bit words in host byte order.
+ * As the one's complement sum is independent of byte order (RFC 1071), this
+ * only needs to be swapped once at the end to get the sum in network byte
+ * order. Carries of the 32 bit words are collected in the upper half of a
+ * 64 bit accumulator and folded back in once, instead of after every word.
+ */
+static uint16_t _sum_host_order(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+    bool odd = ((uintptr_t)buf & 1) && len;
+
+    if (odd) {
+        /* pretend there is a zero byte in front to get aligned, this shifts
+         * every byte to the other half of its word, i.e. swaps the sum */
+        sum += _load16(0, *buf);
+        buf++;
+        len--;
+    }
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        sum += _load16(buf[0], buf[1]);
+        buf += 2;
+        len -= 2;
+    }
+
+    const _word_t *word = (const void *)buf;
+    while (len >= 4 * sizeof(*word)) {
+        sum += (uint64_t)word[0] + word[1] + word[2] + word[3];
+        word += 4;
+        len -= 4 * sizeof(*word);
+    }
+    while (len >= sizeof(*word)) {
+        sum += *word++;
+        len -= sizeof(*word);
+    }
+
+    buf = (const uint8_t *)word;
+    if (len >= 2) {
+        sum += _load16(buf[0], buf[1]);
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {
+        sum += _load16(*buf, 0);
+    }
+
+    uint16_t res = _fold(sum);
+    return odd ? byteorder_swaps(res) : res;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -42,21 +117,11 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    /* a trailing odd byte is added as top half of a 16-byte word */
+    csum += ntohs(_sum_host_order(buf, len));
+    csum = _fold(csum);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
@@ -32,6 +32,9 @@
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+#include "net/gnrc/netif/ieee802154_indirect.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT) */
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
@@ -52,6 +55,7 @@
 #include "debug.h"
 
 static void _update_l2addr_from_dev(gnrc_netif_t *netif);
+static void _update_csum_offload_from_dev(gnrc_netif_t *netif);
 static void _check_netdev_capabilities(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
@@ -183,6 +187,13 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                     *((netstats_t **)opt->data) = &netif->stats;
                     res = sizeof(&netif->stats);
                     break;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+                case NETSTATS_QUEUE:
+                    assert(opt->data_len == sizeof(netstats_queue_t *));
+                    *((netstats_queue_t **)opt->data) = &netif->send_queue.stats;
+                    res = sizeof(&netif->send_queue.stats);
+                    break;
 #endif
                 default:
                     /* take from device */
@@ -412,6 +423,9 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
                 case NETOPT_IEEE802154_PHY:
                     gnrc_netif_ipv6_init_mtu(netif);
                     break;
+                case NETOPT_CHECKSUM_OFFLOAD:
+                    _update_csum_offload_from_dev(netif);
+                    break;
                 default:
                     break;
             }
@@ -1242,6 +1256,38 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     }
 }
 
+static void _update_csum_offload_from_dev(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    netopt_csum_offload_t offload = NETOPT_CSUM_OFFLOAD_NONE;
+
+    if (!IS_USED(MODULE_GNRC_NETIF_CSUM_OFFLOAD)) {
+        return;
+    }
+    if ((dev->driver->get(dev, NETOPT_CHECKSUM_OFFLOAD, &offload,
+                          sizeof(offload)) == sizeof(offload)) &&
+        (offload & NETOPT_CSUM_OFFLOAD_TX)) {
+        netif->flags |= GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    }
+    else {
+        netif->flags &= ~GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    }
+}
+
+static void _init_csum_offload(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    /* ask for everything, the device enables what it supports */
+    netopt_csum_offload_t offload = NETOPT_CSUM_OFFLOAD_TX |
+                                    NETOPT_CSUM_OFFLOAD_RX;
+
+    if (!IS_USED(MODULE_GNRC_NETIF_CSUM_OFFLOAD)) {
+        return;
+    }
+    dev->driver->set(dev, NETOPT_CHECKSUM_OFFLOAD, &offload, sizeof(offload));
+    _update_csum_offload_from_dev(netif);
+}
+
 static void _init_from_device(gnrc_netif_t *netif)
 {
     int res;
@@ -1254,6 +1300,7 @@ static void _init_from_device(gnrc_netif_t *netif)
     netif->device_type = (uint8_t)tmp;
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
+    _init_csum_offload(netif);
 }
 
 static void _check_netdev_capabilities(netdev_t *dev)
@@ -1525,6 +1572,7 @@ static void _send_queued_pkt(gnrc_netif_t *netif)
     gnrc_pktsnip_t *pkt;
 
     if ((pkt = gnrc_netif_pktq_get(netif)) != NULL) {
+        pkt = gnrc_netif_pktq_coalesce(netif, pkt);
         _send(netif, pkt, true);
         gnrc_netif_pktq_sched_get(netif);
     }
@@ -1620,6 +1668,7 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
             LOG_ERROR("gnrc_netif: can't queue packet for sending\n");
             /* If we got here, it means the device was busy and the pkt queue
              * was full. The packet should be dropped here anyway */
+            netif->send_queue.stats.dropped++;
             gnrc_pktbuf_release_error(pkt, ENOMEM);
         }
         return;
@@ -1788,6 +1837,11 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
     else {
         DEBUG("gnrc_netif: event triggered -> %i\n", event);
         gnrc_pktsnip_t *pkt = NULL;
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+        /* let a sleepy child learn about pending data before the next
+         * transmission is started */
+        gnrc_netif_ieee802154_indirect_event(netif, event);
+#endif
         switch (event) {
             case NETDEV_EVENT_RX_COMPLETE:
                 pkt = netif->ops->recv(netif);
@@ -15,6 +15,9 @@
 
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ieee802154.h"
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+#include "net/gnrc/netif/ieee802154_indirect.h"
+#endif
 #include "net/netdev/ieee802154.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -27,10 +30,24 @@
 #include "od.h"
 
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+static int _send_frame(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
 
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+static void _init(gnrc_netif_t *netif)
+{
+    gnrc_netif_default_init(netif);
+    gnrc_netif_ieee802154_indirect_init(netif);
+}
+#endif
+
 static const gnrc_netif_ops_t ieee802154_ops = {
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+    .init = _init,
+    .msg_handler = gnrc_netif_ieee802154_indirect_msg_handler,
+#else
     .init = gnrc_netif_default_init,
+#endif
     .send = _send,
     .recv = _recv,
     .get = gnrc_netif_get_from_netdev,
@@ -90,6 +107,34 @@ static inline bool _already_received(gnrc_netif_t *netif,
 }
 #endif /* MODULE_GNRC_NETIF_DEDUP */
 
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+static inline bool _is_data_req(const uint8_t *mhr, size_t mhr_len, int nread)
+{
+    return ((mhr[0] & IEEE802154_FCF_TYPE_MASK) == IEEE802154_FCF_TYPE_MACCMD) &&
+           ((size_t)nread > mhr_len) &&
+           (mhr[mhr_len] == IEEE802154_CMD_DATA_REQ);
+}
+
+static bool _handle_indirect(gnrc_netif_t *netif, const uint8_t *mhr,
+                             size_t mhr_len, int nread,
+                             const gnrc_netif_hdr_t *hdr)
+{
+    if (_is_data_req(mhr, mhr_len, nread)) {
+        gnrc_pktsnip_t *pkt = gnrc_netif_ieee802154_indirect_get(
+                netif, gnrc_netif_hdr_get_src_addr(hdr), hdr->src_l2addr_len
+            );
+        if (pkt != NULL) {
+            _send_frame(netif, pkt);
+        }
+        return true;
+    }
+    if ((mhr[0] & IEEE802154_FCF_TYPE_MASK) == IEEE802154_FCF_TYPE_DATA) {
+        return gnrc_netif_ieee802154_indirect_recv(netif, hdr, nread - mhr_len);
+    }
+    return false;
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT) */
+
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
     netdev_t *dev = netif->dev;
@@ -195,6 +240,14 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
                 }
                 nread -= mic_size;
             }
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+            if (_handle_indirect(netif, mhr, mhr_len, nread, hdr)) {
+                DEBUG("_recv_ieee802154: frame consumed by indirect transmission\n");
+                gnrc_pktbuf_release(pkt);
+                gnrc_pktbuf_release(netif_hdr);
+                return NULL;
+            }
 #endif
             hdr->lqi = rx_info.lqi;
             hdr->rssi = rx_info.rssi;
@@ -236,6 +289,24 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 }
 
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETIF_IEEE802154_INDIRECT)
+    if ((pkt != NULL) && (pkt->type == GNRC_NETTYPE_NETIF)) {
+        int res = gnrc_netif_ieee802154_indirect_put(netif, pkt);
+
+        if (res < 0) {
+            gnrc_pktbuf_release(pkt);
+        }
+        if (res <= 0) {
+            /* held for a sleepy child or dropped */
+            return res;
+        }
+    }
+#endif
+    return _send_frame(netif, pkt);
+}
+
+static int _send_frame(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     netdev_t *dev = netif->dev;
     netdev_ieee802154_t *state = (netdev_ieee802154_t *)netif->dev;
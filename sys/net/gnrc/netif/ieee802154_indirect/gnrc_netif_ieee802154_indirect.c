@@ -0,0 +1,510 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netif/ieee802154_indirect.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev/ieee802154.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define QUEUE_SIZE      (CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_QUEUE_SIZE)
+
+static inline bool _valid_addr_len(size_t addr_len)
+{
+    return (addr_len == IEEE802154_SHORT_ADDRESS_LEN) ||
+           (addr_len == IEEE802154_LONG_ADDRESS_LEN);
+}
+
+static inline bool _time_reached(uint32_t now, uint32_t time)
+{
+    return (int32_t)(now - time) >= 0;
+}
+
+static gnrc_netif_ieee802154_indirect_child_t *_find(gnrc_netif_t *netif,
+                                                     const uint8_t *addr,
+                                                     size_t addr_len)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ind->children); i++) {
+        gnrc_netif_ieee802154_indirect_child_t *child = &ind->children[i];
+
+        if ((child->addr_len == addr_len) &&
+            (memcmp(child->addr, addr, addr_len) == 0)) {
+            return child;
+        }
+    }
+    return NULL;
+}
+
+static gnrc_pktsnip_t *_pop(gnrc_netif_ieee802154_indirect_child_t *child)
+{
+    gnrc_pktsnip_t *pkt = child->queue[child->head].pkt;
+
+    child->queue[child->head].pkt = NULL;
+    child->head = (child->head + 1) % QUEUE_SIZE;
+    child->num--;
+    return pkt;
+}
+
+static void _update_ack_pending(gnrc_netif_t *netif)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+    bool pending = false;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ind->children); i++) {
+        if (ind->children[i].num > 0) {
+            pending = true;
+            break;
+        }
+    }
+    if (pending != ind->ack_pending) {
+        netopt_enable_t enable = pending ? NETOPT_ENABLE : NETOPT_DISABLE;
+
+        DEBUG("gnrc_netif_ieee802154_indirect: frame pending in ACKs %s\n",
+              pending ? "on" : "off");
+        if (netif->dev->driver->set(netif->dev, NETOPT_ACK_PENDING,
+                                    &enable, sizeof(enable)) < 0) {
+            DEBUG("gnrc_netif_ieee802154_indirect: can't set ACK pending\n");
+        }
+        ind->ack_pending = pending;
+    }
+}
+
+/* drops expired packets, re-arms the expiry timer and updates the frame
+ * pending bit of ACKs. Needs to be called from the interface's thread. */
+static void _expire(gnrc_netif_t *netif)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    uint32_t next = UINT32_MAX;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ind->children); i++) {
+        gnrc_netif_ieee802154_indirect_child_t *child = &ind->children[i];
+
+        while ((child->num > 0) &&
+               _time_reached(now, child->queue[child->head].expires)) {
+            DEBUG("gnrc_netif_ieee802154_indirect: packet expired\n");
+            gnrc_pktbuf_release_error(_pop(child), ETIMEDOUT);
+            ind->stats.expired++;
+        }
+        if ((child->num > 0) &&
+            ((child->queue[child->head].expires - now) < next)) {
+            next = child->queue[child->head].expires - now;
+        }
+    }
+    if (next != UINT32_MAX) {
+        ztimer_set_msg(ZTIMER_MSEC, &ind->expire_timer, next,
+                       &ind->expire_msg, netif->pid);
+    }
+    else {
+        ztimer_remove(ZTIMER_MSEC, &ind->expire_timer);
+    }
+    _update_ack_pending(netif);
+}
+
+static void _set_radio_state(gnrc_netif_t *netif, netopt_state_t state)
+{
+    netif->dev->driver->set(netif->dev, NETOPT_STATE, &state, sizeof(state));
+}
+
+static inline bool _polling(gnrc_netif_ieee802154_indirect_t *ind)
+{
+    return (ind->state == GNRC_NETIF_IEEE802154_INDIRECT_POLLING) ||
+           (ind->state == GNRC_NETIF_IEEE802154_INDIRECT_WAITING);
+}
+
+static void _account_radio_on(gnrc_netif_ieee802154_indirect_t *ind)
+{
+    if (_polling(ind)) {
+        ind->stats.radio_on_ms += ztimer_now(ZTIMER_MSEC) - ind->radio_on;
+    }
+}
+
+static void _sleep(gnrc_netif_t *netif)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+
+    _account_radio_on(ind);
+    DEBUG("gnrc_netif_ieee802154_indirect: radio off\n");
+    ind->state = GNRC_NETIF_IEEE802154_INDIRECT_SLEEPING;
+    _set_radio_state(netif, NETOPT_STATE_SLEEP);
+    if (CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_POLL_PERIOD_MS > 0) {
+        ind->poll_msg.type = GNRC_NETIF_IEEE802154_INDIRECT_POLL_MSG;
+        ztimer_set_msg(ZTIMER_MSEC, &ind->poll_timer,
+                       CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_POLL_PERIOD_MS,
+                       &ind->poll_msg, netif->pid);
+    }
+    else {
+        ztimer_remove(ZTIMER_MSEC, &ind->poll_timer);
+    }
+}
+
+static void _wait(gnrc_netif_t *netif)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+
+    ind->wait_until = ztimer_now(ZTIMER_MSEC) +
+                      CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MS;
+    ind->poll_msg.type = GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MSG;
+    ztimer_set_msg(ZTIMER_MSEC, &ind->poll_timer,
+                   CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MS,
+                   &ind->poll_msg, netif->pid);
+}
+
+static void _send_data_req(gnrc_netif_t *netif)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+    netdev_t *dev = netif->dev;
+    netdev_ieee802154_t *state = (netdev_ieee802154_t *)dev;
+    le_uint16_t dev_pan = byteorder_htols(state->pan);
+    uint8_t mhr[IEEE802154_MAX_HDR_LEN];
+    uint8_t cmd = IEEE802154_CMD_DATA_REQ;
+    size_t mhr_len;
+
+    if (ind->state == GNRC_NETIF_IEEE802154_INDIRECT_SLEEPING) {
+        _set_radio_state(netif, NETOPT_STATE_IDLE);
+    }
+    if (!_polling(ind)) {
+        ind->radio_on = ztimer_now(ZTIMER_MSEC);
+    }
+    ind->state = GNRC_NETIF_IEEE802154_INDIRECT_POLLING;
+    ind->stats.polls++;
+    /* don't rely on the device to report the end of the transmission */
+    _wait(netif);
+
+    mhr_len = ieee802154_set_frame_hdr(mhr, netif->l2addr, netif->l2addr_len,
+                                       ind->parent, ind->parent_len,
+                                       dev_pan, dev_pan,
+                                       IEEE802154_FCF_TYPE_MACCMD |
+                                       IEEE802154_FCF_ACK_REQ,
+                                       state->seq++);
+    if (mhr_len == 0) {
+        DEBUG("gnrc_netif_ieee802154_indirect: error preparing data request\n");
+        _sleep(netif);
+        return;
+    }
+
+    iolist_t payload = {
+        .iol_base = &cmd,
+        .iol_len = sizeof(cmd),
+    };
+    iolist_t iolist = {
+        .iol_next = &payload,
+        .iol_base = mhr,
+        .iol_len = mhr_len,
+    };
+
+    DEBUG("gnrc_netif_ieee802154_indirect: sending data request\n");
+    if (dev->driver->send(dev, &iolist) < 0) {
+        DEBUG("gnrc_netif_ieee802154_indirect: can't send data request\n");
+        _sleep(netif);
+    }
+}
+
+int gnrc_netif_ieee802154_indirect_add(gnrc_netif_t *netif,
+                                       const uint8_t *addr, size_t addr_len)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+    int res = -ENOMEM;
+
+    assert(netif != NULL);
+    if (!_valid_addr_len(addr_len)) {
+        return -EINVAL;
+    }
+    gnrc_netif_acquire(netif);
+    if (_find(netif, addr, addr_len) != NULL) {
+        res = 0;
+    }
+    else {
+        for (unsigned i = 0; i < ARRAY_SIZE(ind->children); i++) {
+            gnrc_netif_ieee802154_indirect_child_t *child = &ind->children[i];
+
+            if (child->addr_len == 0) {
+                memcpy(child->addr, addr, addr_len);
+                child->addr_len = addr_len;
+                child->head = 0;
+                child->num = 0;
+                res = 0;
+                break;
+            }
+        }
+    }
+    gnrc_netif_release(netif);
+    return res;
+}
+
+void gnrc_netif_ieee802154_indirect_remove(gnrc_netif_t *netif,
+                                           const uint8_t *addr,
+                                           size_t addr_len)
+{
+    gnrc_netif_ieee802154_indirect_child_t *child;
+
+    assert(netif != NULL);
+    gnrc_netif_acquire(netif);
+    child = _find(netif, addr, addr_len);
+    if (child != NULL) {
+        msg_t msg = { .type = GNRC_NETIF_IEEE802154_INDIRECT_EXPIRE_MSG };
+
+        while (child->num > 0) {
+            gnrc_pktbuf_release_error(_pop(child), EHOSTUNREACH);
+        }
+        child->addr_len = 0;
+        /* let the interface's thread update the frame pending bit */
+        msg_try_send(&msg, netif->pid);
+    }
+    gnrc_netif_release(netif);
+}
+
+int gnrc_netif_ieee802154_indirect_pending(gnrc_netif_t *netif,
+                                           const uint8_t *addr,
+                                           size_t addr_len)
+{
+    gnrc_netif_ieee802154_indirect_child_t *child;
+    int res = -ENOENT;
+
+    assert(netif != NULL);
+    gnrc_netif_acquire(netif);
+    child = _find(netif, addr, addr_len);
+    if (child != NULL) {
+        res = child->num;
+    }
+    gnrc_netif_release(netif);
+    return res;
+}
+
+int gnrc_netif_ieee802154_indirect_set_parent(gnrc_netif_t *netif,
+                                              const uint8_t *addr,
+                                              size_t addr_len)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+    msg_t msg = { .type = GNRC_NETIF_IEEE802154_INDIRECT_POLL_MSG };
+
+    assert(netif != NULL);
+    if ((addr != NULL) && !_valid_addr_len(addr_len)) {
+        return -EINVAL;
+    }
+    gnrc_netif_acquire(netif);
+    if (addr != NULL) {
+        memcpy(ind->parent, addr, addr_len);
+        ind->parent_len = addr_len;
+    }
+    else {
+        ind->parent_len = 0;
+    }
+    gnrc_netif_release(netif);
+    /* the interface's thread polls once or wakes the radio up for good */
+    return (msg_try_send(&msg, netif->pid) == 1) ? 0 : -EBUSY;
+}
+
+int gnrc_netif_ieee802154_indirect_poll(gnrc_netif_t *netif)
+{
+    msg_t msg = { .type = GNRC_NETIF_IEEE802154_INDIRECT_POLL_MSG };
+
+    assert(netif != NULL);
+    if (netif->ieee802154_indirect.parent_len == 0) {
+        return -ENOTCONN;
+    }
+    return (msg_try_send(&msg, netif->pid) == 1) ? 0 : -EBUSY;
+}
+
+void gnrc_netif_ieee802154_indirect_init(gnrc_netif_t *netif)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+
+    memset(ind, 0, sizeof(*ind));
+    ind->expire_msg.type = GNRC_NETIF_IEEE802154_INDIRECT_EXPIRE_MSG;
+}
+
+int gnrc_netif_ieee802154_indirect_put(gnrc_netif_t *netif,
+                                       gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+    gnrc_netif_hdr_t *hdr = pkt->data;
+    gnrc_netif_ieee802154_indirect_child_t *child;
+    int res = 1;
+
+    if (hdr->flags &
+        (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
+        return 1;
+    }
+    gnrc_netif_acquire(netif);
+    child = _find(netif, gnrc_netif_hdr_get_dst_addr(hdr),
+                  hdr->dst_l2addr_len);
+    if (child == NULL) {
+        /* not a sleepy child, send right away */
+    }
+    else if (child->num >= QUEUE_SIZE) {
+        DEBUG("gnrc_netif_ieee802154_indirect: queue of child full\n");
+        ind->stats.dropped++;
+        res = -ENOBUFS;
+    }
+    else {
+        gnrc_netif_ieee802154_indirect_entry_t *entry;
+
+        entry = &child->queue[(child->head + child->num) % QUEUE_SIZE];
+        entry->pkt = pkt;
+        entry->expires = ztimer_now(ZTIMER_MSEC) +
+                         CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_TIMEOUT_MS;
+        child->num++;
+        ind->stats.queued++;
+        DEBUG("gnrc_netif_ieee802154_indirect: holding packet %p\n",
+              (void *)pkt);
+        _expire(netif);
+        res = 0;
+    }
+    gnrc_netif_release(netif);
+    return res;
+}
+
+gnrc_pktsnip_t *gnrc_netif_ieee802154_indirect_get(gnrc_netif_t *netif,
+                                                   const uint8_t *src,
+                                                   size_t src_len)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+    gnrc_netif_ieee802154_indirect_child_t *child;
+    gnrc_pktsnip_t *pkt = NULL;
+
+    gnrc_netif_acquire(netif);
+    child = _find(netif, src, src_len);
+    if ((child != NULL) && (child->num > 0)) {
+        bool more;
+
+        pkt = _pop(child);
+        more = (child->num > 0);
+        ind->stats.delivered++;
+        _expire(netif);
+
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(pkt);
+        if (tmp == NULL) {
+            DEBUG("gnrc_netif_ieee802154_indirect: no write access to pkt\n");
+            gnrc_pktbuf_release(pkt);
+            pkt = NULL;
+        }
+        else {
+            gnrc_netif_hdr_t *hdr = tmp->data;
+
+            if (more) {
+                hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+            }
+            else {
+                hdr->flags &= ~GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+            }
+            pkt = tmp;
+        }
+    }
+    else if (ind->ack_pending) {
+        /* the ACK claimed pending data for any child, so tell this one there
+         * is none with an empty frame (IEEE 802.15.4-2015, 6.7.3) */
+        DEBUG("gnrc_netif_ieee802154_indirect: nothing pending\n");
+        pkt = gnrc_netif_hdr_build(NULL, 0, src, src_len);
+    }
+    gnrc_netif_release(netif);
+    return pkt;
+}
+
+bool gnrc_netif_ieee802154_indirect_recv(gnrc_netif_t *netif,
+                                         const gnrc_netif_hdr_t *hdr,
+                                         size_t payload_len)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+
+    if (!_polling(ind) ||
+        (hdr->src_l2addr_len != ind->parent_len) ||
+        (memcmp(gnrc_netif_hdr_get_src_addr(hdr), ind->parent,
+                ind->parent_len) != 0)) {
+        return false;
+    }
+    if (hdr->flags & GNRC_NETIF_HDR_FLAGS_MORE_DATA) {
+        _send_data_req(netif);
+    }
+    else {
+        _sleep(netif);
+    }
+    return (payload_len == 0);
+}
+
+void gnrc_netif_ieee802154_indirect_event(gnrc_netif_t *netif,
+                                          netdev_event_t event)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+
+    if (ind->state != GNRC_NETIF_IEEE802154_INDIRECT_POLLING) {
+        return;
+    }
+    switch (event) {
+    case NETDEV_EVENT_TX_COMPLETE_DATA_PENDING:
+        DEBUG("gnrc_netif_ieee802154_indirect: data pending\n");
+        ind->stats.polls_pending++;
+        ind->state = GNRC_NETIF_IEEE802154_INDIRECT_WAITING;
+        _wait(netif);
+        break;
+    case NETDEV_EVENT_TX_COMPLETE:
+    case NETDEV_EVENT_TX_NOACK:
+    case NETDEV_EVENT_TX_MEDIUM_BUSY:
+        _sleep(netif);
+        break;
+    default:
+        break;
+    }
+}
+
+void gnrc_netif_ieee802154_indirect_msg_handler(gnrc_netif_t *netif,
+                                                msg_t *msg)
+{
+    gnrc_netif_ieee802154_indirect_t *ind = &netif->ieee802154_indirect;
+
+    switch (msg->type) {
+    case GNRC_NETIF_IEEE802154_INDIRECT_EXPIRE_MSG:
+        gnrc_netif_acquire(netif);
+        _expire(netif);
+        gnrc_netif_release(netif);
+        break;
+    case GNRC_NETIF_IEEE802154_INDIRECT_POLL_MSG:
+        if (ind->parent_len == 0) {
+            if (ind->state != GNRC_NETIF_IEEE802154_INDIRECT_AWAKE) {
+                DEBUG("gnrc_netif_ieee802154_indirect: radio on for good\n");
+                _account_radio_on(ind);
+                ztimer_remove(ZTIMER_MSEC, &ind->poll_timer);
+                _set_radio_state(netif, NETOPT_STATE_IDLE);
+                ind->state = GNRC_NETIF_IEEE802154_INDIRECT_AWAKE;
+            }
+        }
+        else if ((ind->state == GNRC_NETIF_IEEE802154_INDIRECT_AWAKE) ||
+                 (ind->state == GNRC_NETIF_IEEE802154_INDIRECT_SLEEPING)) {
+            _send_data_req(netif);
+        }
+        break;
+    case GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MSG:
+        if (_polling(ind) &&
+            _time_reached(ztimer_now(ZTIMER_MSEC), ind->wait_until)) {
+            DEBUG("gnrc_netif_ieee802154_indirect: no data received\n");
+            _sleep(netif);
+        }
+        break;
+    default:
+        DEBUG("gnrc_netif_ieee802154_indirect: unknown message type 0x%04x\n",
+              msg->type);
+        break;
+    }
+}
+/** @} */
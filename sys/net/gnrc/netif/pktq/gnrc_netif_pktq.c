@@ -14,14 +14,43 @@
  */
 
 #include <assert.h>
+#include <string.h>
 
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
 
 static gnrc_pktqueue_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+/**
+ * @brief   Scheduling information of a queued packet, indexed like _pool
+ */
+static struct {
+    uint32_t tag;               /**< start tag */
+    uint32_t time;              /**< time in µs the packet was queued */
+    uint8_t cls;                /**< gnrc_netif_pktq_fq_class_t */
+    uint8_t flow;               /**< flow of a packet of the bulk class */
+    bool retry;                 /**< packet was pushed back after sending */
+} _sched[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+
+/**
+ * @brief   Header fields packets are classified by
+ */
+typedef struct {
+    uint32_t fl;                /**< IPv6 flow label */
+    int nh;                     /**< IPv6 next header, -1 if unknown */
+    uint8_t dscp;               /**< DSCP of the IPv6 traffic class */
+    uint16_t tag;               /**< 6LoWPAN datagram tag of a fragment */
+} _fields_t;
+#endif
+
 static gnrc_pktqueue_t *_get_free_entry(void)
 {
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
@@ -32,6 +61,307 @@ static gnrc_pktqueue_t *_get_free_entry(void)
     return NULL;
 }
 
+static void _account(gnrc_netif_t *netif)
+{
+    netstats_queue_t *stats = &netif->send_queue.stats;
+
+    if (++stats->depth > stats->depth_max) {
+        stats->depth_max = stats->depth;
+    }
+}
+
+static bool _has_tx_sync(gnrc_pktsnip_t *pkt)
+{
+    return IS_USED(MODULE_GNRC_TX_SYNC) &&
+           (gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TX_SYNC) != NULL);
+}
+
+static bool _same_dst(const gnrc_pktsnip_t *a, const gnrc_pktsnip_t *b)
+{
+    const gnrc_netif_hdr_t *a_hdr = a->data;
+    const gnrc_netif_hdr_t *b_hdr = b->data;
+    const uint8_t group = GNRC_NETIF_HDR_FLAGS_BROADCAST |
+                          GNRC_NETIF_HDR_FLAGS_MULTICAST;
+
+    return ((a_hdr->flags & group) == (b_hdr->flags & group)) &&
+           (a_hdr->dst_l2addr_len == b_hdr->dst_l2addr_len) &&
+           (memcmp(gnrc_netif_hdr_get_dst_addr(a_hdr),
+                   gnrc_netif_hdr_get_dst_addr(b_hdr),
+                   a_hdr->dst_l2addr_len) == 0);
+}
+
+static bool _same_payload(const gnrc_pktsnip_t *a, const gnrc_pktsnip_t *b)
+{
+    size_t a_off = 0, b_off = 0;
+
+    if (gnrc_pkt_len(a) != gnrc_pkt_len(b)) {
+        return false;
+    }
+    while ((a != NULL) && (b != NULL)) {
+        if (a_off == a->size) {
+            a = a->next;
+            a_off = 0;
+            continue;
+        }
+        if (b_off == b->size) {
+            b = b->next;
+            b_off = 0;
+            continue;
+        }
+
+        size_t len = ((a->size - a_off) < (b->size - b_off))
+                   ? (a->size - a_off) : (b->size - b_off);
+
+        if (memcmp((uint8_t *)a->data + a_off, (uint8_t *)b->data + b_off,
+                   len) != 0) {
+            return false;
+        }
+        a_off += len;
+        b_off += len;
+    }
+    return true;
+}
+
+static bool _is_duplicate(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktqueue_t *entry;
+
+    if (_has_tx_sync(pkt)) {
+        /* the sender waits for the result of exactly this packet */
+        return false;
+    }
+    /* a packet put again (e.g. with a reference held by the caller) is
+     * queued again, releasing it would free it while still queued */
+    LL_FOREACH(netif->send_queue.queue, entry) {
+        if (entry->pkt == pkt) {
+            return false;
+        }
+    }
+    LL_FOREACH(netif->send_queue.queue, entry) {
+        if (_same_dst(entry->pkt, pkt) &&
+            _same_payload(entry->pkt->next, pkt->next)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+static size_t _peek(const gnrc_pktsnip_t *pkt, uint8_t *buf, size_t len)
+{
+    size_t res = 0;
+
+    for (; (pkt != NULL) && (res < len); pkt = pkt->next) {
+        size_t part = ((len - res) < pkt->size) ? (len - res) : pkt->size;
+
+        memcpy(buf + res, pkt->data, part);
+        res += part;
+    }
+    return res;
+}
+
+__attribute__((unused))
+static void _parse_ipv6(const uint8_t *buf, size_t len, _fields_t *fields)
+{
+    const ipv6_hdr_t *hdr = (const ipv6_hdr_t *)buf;
+
+    if (len >= sizeof(ipv6_hdr_t)) {
+        fields->dscp = ipv6_hdr_get_tc_dscp(hdr);
+        fields->fl = ipv6_hdr_get_fl(hdr);
+        fields->nh = hdr->nh;
+    }
+}
+
+__attribute__((unused))
+static void _parse_iphc(const uint8_t *buf, size_t len, _fields_t *fields)
+{
+    /* see https://tools.ietf.org/html/rfc6282#section-3.1.1 */
+    size_t off = SIXLOWPAN_IPHC_HDR_LEN;
+
+    if (len < SIXLOWPAN_IPHC_HDR_LEN) {
+        return;
+    }
+    if (buf[1] & SIXLOWPAN_IPHC2_CID_EXT) {
+        off += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    switch (buf[0] & SIXLOWPAN_IPHC1_TF) {
+    case 0x00:  /* ECN + DSCP + 4-bit pad + flow label */
+        if (len < (off + 4)) {
+            return;
+        }
+        fields->dscp = buf[off] & 0x3f;
+        fields->fl = ((uint32_t)(buf[off + 1] & 0x0f) << 16) |
+                     ((uint32_t)buf[off + 2] << 8) | buf[off + 3];
+        off += 4;
+        break;
+    case 0x08:  /* ECN + 2-bit pad + flow label */
+        if (len < (off + 3)) {
+            return;
+        }
+        fields->fl = ((uint32_t)(buf[off] & 0x0f) << 16) |
+                     ((uint32_t)buf[off + 1] << 8) | buf[off + 2];
+        off += 3;
+        break;
+    case 0x10:  /* ECN + DSCP */
+        if (len < (off + 1)) {
+            return;
+        }
+        fields->dscp = buf[off] & 0x3f;
+        off += 1;
+        break;
+    default:    /* traffic class and flow label elided */
+        break;
+    }
+    if (!(buf[0] & SIXLOWPAN_IPHC1_NH) && (len > off)) {
+        fields->nh = buf[off];
+    }
+}
+
+static uint8_t _classify(gnrc_pktsnip_t *pkt, uint8_t *flow)
+{
+    const gnrc_netif_hdr_t *netif_hdr = pkt->data;
+    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
+    _fields_t fields = { .nh = -1 };
+    uint8_t buf[sizeof(ipv6_hdr_t) + 1];
+    size_t len;
+    uint32_t hash = 5381;
+
+    if (pkt->next == NULL) {
+        *flow = 0;
+        return GNRC_NETIF_PKTQ_FQ_BULK;
+    }
+    len = _peek(pkt->next, buf, sizeof(buf));
+    (void)len;  /* only used with IPv6 or 6LoWPAN */
+    switch (pkt->next->type) {
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    case GNRC_NETTYPE_IPV6:
+        _parse_ipv6(buf, len, &fields);
+        break;
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+    case GNRC_NETTYPE_SIXLOWPAN:
+        if (len == 0) {
+            break;
+        }
+        if ((buf[0] & SIXLOWPAN_FRAG_DISP_MASK) == SIXLOWPAN_FRAG_1_DISP ||
+            (buf[0] & SIXLOWPAN_FRAG_DISP_MASK) == SIXLOWPAN_FRAG_N_DISP) {
+            /* keep all fragments of a datagram in the same flow */
+            if (len >= sizeof(sixlowpan_frag_t)) {
+                fields.tag = byteorder_ntohs(((sixlowpan_frag_t *)buf)->tag);
+            }
+        }
+        else if (buf[0] == SIXLOWPAN_UNCOMP) {
+            _parse_ipv6(buf + 1, len - 1, &fields);
+        }
+        else if (sixlowpan_iphc_is(buf)) {
+            _parse_iphc(buf, len, &fields);
+        }
+        break;
+#endif
+    default:
+        break;
+    }
+    if ((fields.nh == PROTNUM_ICMPV6) || (fields.dscp >= 48)) {
+        /* ICMPv6 (NDP, RPL) or DSCP CS6 and CS7 (network control) */
+        *flow = 0;
+        return GNRC_NETIF_PKTQ_FQ_CONTROL;
+    }
+    for (unsigned i = 0; i < netif_hdr->dst_l2addr_len; i++) {
+        hash = (hash * 33) ^ dst[i];
+    }
+    hash = (hash * 33) ^ fields.fl;
+    hash = (hash * 33) ^ (uint8_t)fields.nh;
+    hash = (hash * 33) ^ fields.dscp;
+    hash = (hash * 33) ^ fields.tag;
+    *flow = hash % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS;
+    return GNRC_NETIF_PKTQ_FQ_BULK;
+}
+
+static void _fq_enqueue(gnrc_netif_t *netif, gnrc_pktqueue_t *entry,
+                        uint8_t cls, uint8_t flow, bool retry)
+{
+    gnrc_netif_pktq_fq_t *fq = &netif->send_queue.fq;
+    unsigned idx = entry - _pool;
+    gnrc_pktqueue_t *prev = NULL, *cur;
+
+    _sched[idx].cls = cls;
+    _sched[idx].flow = flow;
+    _sched[idx].retry = retry;
+    _sched[idx].time = xtimer_now_usec();
+    if (cls == GNRC_NETIF_PKTQ_FQ_BULK) {
+        fq->num[flow]++;
+    }
+    if (retry) {
+        /* a packet pushed back is sent next */
+        _sched[idx].tag = fq->vtime;
+        LL_PREPEND(netif->send_queue.queue, entry);
+        return;
+    }
+    if (cls == GNRC_NETIF_PKTQ_FQ_BULK) {
+        uint32_t start = fq->finish[flow];
+
+        if ((int32_t)(fq->vtime - start) > 0) {
+            start = fq->vtime;
+        }
+        _sched[idx].tag = start;
+        fq->finish[flow] = start + gnrc_pkt_len(entry->pkt->next);
+    }
+    LL_FOREACH(netif->send_queue.queue, cur) {
+        unsigned cur_idx = cur - _pool;
+
+        if (_sched[cur_idx].cls != GNRC_NETIF_PKTQ_FQ_CONTROL) {
+            if ((cls == GNRC_NETIF_PKTQ_FQ_CONTROL) ||
+                ((int32_t)(_sched[cur_idx].tag - _sched[idx].tag) > 0)) {
+                break;
+            }
+        }
+        prev = cur;
+    }
+    if (prev == NULL) {
+        LL_PREPEND(netif->send_queue.queue, entry);
+    }
+    else {
+        entry->next = prev->next;
+        prev->next = entry;
+    }
+}
+
+static void _fq_dequeue(gnrc_netif_t *netif, gnrc_pktqueue_t *entry)
+{
+    gnrc_netif_pktq_fq_t *fq = &netif->send_queue.fq;
+    unsigned idx = entry - _pool;
+
+    if (_sched[idx].cls == GNRC_NETIF_PKTQ_FQ_BULK) {
+        fq->num[_sched[idx].flow]--;
+        if ((int32_t)(_sched[idx].tag - fq->vtime) > 0) {
+            fq->vtime = _sched[idx].tag;
+        }
+    }
+    if (!_sched[idx].retry) {
+        gnrc_netif_pktq_fq_stats_t *stats = &fq->stats[_sched[idx].cls];
+        uint32_t sojourn = xtimer_now_usec() - _sched[idx].time;
+
+        stats->packets++;
+        stats->sojourn_sum += sojourn;
+        if (sojourn > stats->sojourn_max) {
+            stats->sojourn_max = sojourn;
+        }
+    }
+}
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) */
+
+static gnrc_pktsnip_t *_take(gnrc_netif_t *netif, gnrc_pktqueue_t *entry)
+{
+    gnrc_pktsnip_t *pkt = entry->pkt;
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    _fq_dequeue(netif, entry);
+#endif
+    entry->pkt = NULL;
+    netif->send_queue.stats.depth--;
+    return pkt;
+}
+
 unsigned gnrc_netif_pktq_usage(void)
 {
     unsigned res = 0;
@@ -49,16 +379,79 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     assert(netif != NULL);
     assert(pkt != NULL);
 
+    if (IS_ACTIVE(CONFIG_GNRC_NETIF_PKTQ_DEDUP) && _is_duplicate(netif, pkt)) {
+        netif->send_queue.stats.deduplicated++;
+        gnrc_pktbuf_release(pkt);
+        return 0;
+    }
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    uint8_t flow;
+    uint8_t cls = _classify(pkt, &flow);
+
+    if ((cls == GNRC_NETIF_PKTQ_FQ_BULK) &&
+        (netif->send_queue.fq.num[flow] >= CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT)) {
+        return -1;
+    }
+#endif
+
     gnrc_pktqueue_t *entry = _get_free_entry();
 
     if (entry == NULL) {
         return -1;
     }
     entry->pkt = pkt;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    _fq_enqueue(netif, entry, cls, flow, false);
+#else
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
+#endif
+    netif->send_queue.stats.queued++;
+    _account(netif);
     return 0;
 }
 
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
+{
+    assert(netif != NULL);
+
+    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(
+        &netif->send_queue.queue
+    );
+
+    if (entry == NULL) {
+        return NULL;
+    }
+    return _take(netif, entry);
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_coalesce(gnrc_netif_t *netif,
+                                         gnrc_pktsnip_t *pkt)
+{
+    assert(netif != NULL);
+    assert(pkt != NULL);
+
+    if ((netif->ops->aggregate == NULL) || _has_tx_sync(pkt)) {
+        return pkt;
+    }
+    while (netif->send_queue.queue != NULL) {
+        gnrc_pktqueue_t *entry = netif->send_queue.queue;
+        gnrc_pktsnip_t *res;
+
+        if (!_same_dst(pkt, entry->pkt) || _has_tx_sync(entry->pkt)) {
+            break;
+        }
+        if ((res = netif->ops->aggregate(netif, pkt, entry->pkt)) == NULL) {
+            break;
+        }
+        gnrc_pktqueue_remove_head(&netif->send_queue.queue);
+        _take(netif, entry);
+        netif->send_queue.stats.coalesced++;
+        pkt = res;
+    }
+    return pkt;
+}
+
 void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
 {
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
@@ -91,7 +484,15 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         return -1;
     }
     entry->pkt = pkt;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    uint8_t flow;
+    uint8_t cls = _classify(pkt, &flow);
+
+    _fq_enqueue(netif, entry, cls, flow, true);
+#else
     LL_PREPEND(netif->send_queue.queue, entry);
+#endif
+    _account(netif);
     return 0;
 }
 
@@ -26,6 +26,7 @@
 #include "net/gnrc/udp.h"
 #ifdef MODULE_GNRC_TCP
 #include "net/gnrc/tcp.h"
+#include "net/tcp.h"
 #endif
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
@@ -149,4 +150,27 @@ int gnrc_netreg_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
     }
 }
 
+int gnrc_netreg_clear_csum(gnrc_pktsnip_t *hdr)
+{
+    switch (hdr->type) {
+#ifdef MODULE_GNRC_ICMPV6
+        case GNRC_NETTYPE_ICMPV6:
+            ((icmpv6_hdr_t *)hdr->data)->csum.u16 = 0;
+            return 0;
+#endif
+#ifdef MODULE_GNRC_TCP
+        case GNRC_NETTYPE_TCP:
+            ((tcp_hdr_t *)hdr->data)->checksum.u16 = 0;
+            return 0;
+#endif
+#ifdef MODULE_GNRC_UDP
+        case GNRC_NETTYPE_UDP:
+            ((udp_hdr_t *)hdr->data)->checksum.u16 = 0;
+            return 0;
+#endif
+        default:
+            return -ENOENT;
+    }
+}
+
 /** @} */
@@ -198,7 +198,8 @@ static int _receive(gnrc_pktsnip_t *pkt)
     }
 
     /* Validate checksum */
-    if (byteorder_ntohs(hdr->checksum) != _gnrc_tcp_pkt_calc_csum(tcp, ip, pkt)) {
+    if (!gnrc_netif_hdr_csum_valid(pkt) &&
+        (byteorder_ntohs(hdr->checksum) != _gnrc_tcp_pkt_calc_csum(tcp, ip, pkt))) {
 #ifndef MODULE_FUZZING
         gnrc_pktbuf_release(pkt);
         TCP_DEBUG_ERROR("-EINVAL: Invalid checksum.");
@@ -351,17 +351,37 @@ static void _comp_mic(ieee802154_sec_context_t *ctx,
     }
 }
 
+/**
+ * @brief   Perform CTR on the payload, passing up to
+ *          @ref IEEE802154_SEC_CTR_BLOCKS counter blocks to a single
+ *          ECB operation
+ */
 static void _ctr(ieee802154_sec_context_t *ctx,
                  ieee802154_ccm_block_t *A0,
                  const void *m, uint16_t m_len)
 {
-    uint8_t tmp1[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint8_t tmp2[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
+    uint8_t Ai[IEEE802154_SEC_CTR_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t Si[IEEE802154_SEC_CTR_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t *data = (uint8_t *)m;
 
     for (uint16_t off = 0; off < m_len;) {
-        _advance_ctr_Ai(A0);
-        off += _ecb(ctx, tmp1, tmp2,
-                    &(((uint8_t *)m)[off]), (uint8_t *)A0, m_len - off);
+        uint16_t len = _min(sizeof(Ai), m_len - off);
+        uint8_t nblocks = (len + IEEE802154_SEC_BLOCK_SIZE - 1)
+                        / IEEE802154_SEC_BLOCK_SIZE;
+
+        for (uint8_t i = 0; i < nblocks; i++) {
+            _advance_ctr_Ai(A0);
+            memcpy(&Ai[i * IEEE802154_SEC_BLOCK_SIZE], A0,
+                   IEEE802154_SEC_BLOCK_SIZE);
+        }
+        if (ctx->dev.cipher_ops->ecb) {
+            ctx->dev.cipher_ops->ecb(&ctx->dev, Si, Ai, nblocks);
+        }
+        else {
+            _sec_ecb(&ctx->dev, Si, Ai, nblocks);
+        }
+        _memxor(&data[off], Si, len);
+        off += len;
     }
 }
 
@@ -28,12 +28,73 @@
 #define ACK_TIMEOUT_US                      (864U)
 
 static void _handle_tx_no_ack(ieee802154_submac_t *submac);
+static void _start_tx(ieee802154_submac_t *submac, const iolist_t *iolist);
+
+#if CONFIG_IEEE802154_SUBMAC_TXQ_SIZE
+static int _txq_put(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    if (submac->txq_num == CONFIG_IEEE802154_SUBMAC_TXQ_SIZE) {
+        submac->stats.tx_queue_full++;
+        return -EBUSY;
+    }
+
+    size_t len = iolist_size(iolist);
+    if (len > IEEE802154_FRAME_LEN_MAX) {
+        return -EMSGSIZE;
+    }
+
+    unsigned idx = (submac->txq_head + submac->txq_num) %
+                   CONFIG_IEEE802154_SUBMAC_TXQ_SIZE;
+    ieee802154_submac_txq_frame_t *frame = &submac->txq[idx];
+    uint8_t *pos = frame->psdu;
+
+    for (; iolist; iolist = iolist->iol_next) {
+        memcpy(pos, iolist->iol_base, iolist->iol_len);
+        pos += iolist->iol_len;
+    }
+    frame->len = len;
+    submac->txq_num++;
+    submac->stats.tx_queued++;
+
+    return 0;
+}
+
+/* Start the oldest queued frame. The radio is switched to TX_ON right away
+ * instead of first returning to the state of the SubMAC. The caller must not
+ * leave a state transition unconfirmed */
+static void _txq_start_next(ieee802154_submac_t *submac)
+{
+    ieee802154_submac_txq_frame_t *frame = &submac->txq[submac->txq_head];
+    const iolist_t iolist = {
+        .iol_base = frame->psdu,
+        .iol_len = frame->len,
+    };
+
+    submac->txq_head = (submac->txq_head + 1) % CONFIG_IEEE802154_SUBMAC_TXQ_SIZE;
+    submac->txq_num--;
+    submac->stats.tx_back_to_back++;
+
+    while (ieee802154_radio_request_set_trx_state(submac->dev,
+                                                  IEEE802154_TRX_STATE_TX_ON) == -EBUSY) {}
+    _start_tx(submac, &iolist);
+}
+#endif
 
 static void _tx_end(ieee802154_submac_t *submac, int status,
                     ieee802154_tx_info_t *info)
 {
     ieee802154_dev_t *dev = submac->dev;
 
+#if CONFIG_IEEE802154_SUBMAC_TXQ_SIZE
+    if (submac->txq_num) {
+        /* Load the next frame before reporting the previous one, so that
+         * the upper layer only adds frames behind the queued ones */
+        _txq_start_next(submac);
+        submac->cb->tx_done(submac, status, info);
+        return;
+    }
+#endif
+
     ieee802154_radio_request_set_trx_state(dev, submac->state == IEEE802154_STATE_LISTEN ? IEEE802154_TRX_STATE_RX_ON : IEEE802154_TRX_STATE_TRX_OFF);
 
     submac->wait_for_ack = false;
@@ -230,6 +291,7 @@ static void _handle_tx_medium_busy(ieee802154_submac_t *submac)
     if (ieee802154_radio_has_frame_retrans(dev) ||
         ieee802154_radio_has_auto_csma(dev)) {
         ieee802154_radio_request_set_trx_state(dev, IEEE802154_TRX_STATE_RX_ON);
+        while (ieee802154_radio_confirm_set_trx_state(dev) == -EAGAIN) {}
         _tx_end(submac, TX_STATUS_MEDIUM_BUSY, NULL);
     }
     else {
@@ -244,6 +306,7 @@ static void _handle_tx_no_ack(ieee802154_submac_t *submac)
 
     if (ieee802154_radio_has_frame_retrans(dev)) {
         ieee802154_radio_request_set_trx_state(dev, IEEE802154_TRX_STATE_RX_ON);
+        while (ieee802154_radio_confirm_set_trx_state(dev) == -EAGAIN) {}
         _tx_end(submac, TX_STATUS_NO_ACK, NULL);
     }
     else {
@@ -276,23 +339,14 @@ void ieee802154_submac_tx_done_cb(ieee802154_submac_t *submac)
     }
 }
 
-int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
+/* The radio must have been requested to go to TX_ON */
+static void _start_tx(ieee802154_submac_t *submac, const iolist_t *iolist)
 {
     ieee802154_dev_t *dev = submac->dev;
 
     uint8_t *buf = iolist->iol_base;
     bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
 
-    if (submac->state == IEEE802154_STATE_OFF) {
-        return -ENETDOWN;
-    }
-
-    if (submac->tx ||
-        ieee802154_radio_request_set_trx_state(dev,
-                                               IEEE802154_TRX_STATE_TX_ON) < 0) {
-        return -EBUSY;
-    }
-
     submac->tx = true;
 
     ieee802154_radio_write(dev, iolist);
@@ -300,8 +354,34 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
 
     submac->wait_for_ack = cnf;
     submac->retrans = 0;
+    submac->stats.tx_frames++;
 
     ieee802154_csma_ca_transmit(submac);
+}
+
+int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    ieee802154_dev_t *dev = submac->dev;
+
+    if (submac->state == IEEE802154_STATE_OFF) {
+        return -ENETDOWN;
+    }
+
+    if (submac->tx) {
+#if CONFIG_IEEE802154_SUBMAC_TXQ_SIZE
+        return _txq_put(submac, iolist);
+#else
+        submac->stats.tx_queue_full++;
+        return -EBUSY;
+#endif
+    }
+
+    if (ieee802154_radio_request_set_trx_state(dev,
+                                               IEEE802154_TRX_STATE_TX_ON) < 0) {
+        return -EBUSY;
+    }
+
+    _start_tx(submac, iolist);
     return 0;
 }
 
@@ -312,6 +392,11 @@ int ieee802154_submac_init(ieee802154_submac_t *submac, const network_uint16_t *
 
     submac->tx = false;
     submac->state = IEEE802154_STATE_LISTEN;
+    memset(&submac->stats, 0, sizeof(submac->stats));
+#if CONFIG_IEEE802154_SUBMAC_TXQ_SIZE
+    submac->txq_head = 0;
+    submac->txq_num = 0;
+#endif
 
     ieee802154_radio_request_on(dev);
 
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_pm_governor
+ * @{
+ *
+ * @file
+ * @brief       Tickless idle governor implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "assert.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "periph/pm.h"
+#include "pm_governor.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if defined(MODULE_ZTIMER_USEC) && defined(MODULE_ZTIMER_MSEC) && \
+    IS_ACTIVE(CONFIG_PM_GOVERNOR_SUSPEND_USEC)
+#define _CAN_SUSPEND    1
+#else
+#define _CAN_SUSPEND    0
+#endif
+
+typedef struct {
+    uint32_t usec;
+    uint32_t msec;
+} _timestamp_t;
+
+static pm_governor_mode_t _modes[PM_NUM_MODES] = PM_GOVERNOR_MODES;
+static pm_governor_stats_t _stats;
+
+#if _CAN_SUSPEND
+static ztimer_t _wakeup;
+#endif
+
+static inline uint32_t _min_u32(uint32_t a, uint32_t b)
+{
+    return a < b ? a : b;
+}
+
+static inline uint32_t _to_us(uint32_t ticks, uint32_t us_per_tick)
+{
+    if (ticks > UINT32_MAX / us_per_tick) {
+        return UINT32_MAX;
+    }
+    return ticks * us_per_tick;
+}
+
+static uint32_t _next_deadline_us(bool usec)
+{
+    uint32_t deadline = UINT32_MAX;
+
+#ifdef MODULE_ZTIMER_USEC
+    if (usec) {
+        deadline = ztimer_until_next(ZTIMER_USEC);
+    }
+#else
+    (void)usec;
+#endif
+#ifdef MODULE_ZTIMER_MSEC
+    deadline = _min_u32(deadline, _to_us(ztimer_until_next(ZTIMER_MSEC),
+                                         US_PER_MS));
+#endif
+#ifdef MODULE_ZTIMER_SEC
+    deadline = _min_u32(deadline, _to_us(ztimer_until_next(ZTIMER_SEC),
+                                         US_PER_SEC));
+#endif
+    return deadline;
+}
+
+static unsigned _lowest(pm_blocker_t blocker)
+{
+    unsigned mode = PM_NUM_MODES;
+
+    while (mode && !blocker.val_u8[mode - 1]) {
+        mode--;
+    }
+    return mode;
+}
+
+static unsigned _select(unsigned lowest, uint32_t deadline_us)
+{
+    for (unsigned mode = lowest; mode < PM_NUM_MODES; mode++) {
+        const pm_governor_mode_t *params = &_modes[mode];
+
+        if ((uint64_t)params->latency_us + params->residency_us <= deadline_us) {
+            return mode;
+        }
+    }
+    return PM_GOVERNOR_IDLE;
+}
+
+static void _now(_timestamp_t *ts)
+{
+#ifdef MODULE_ZTIMER_USEC
+    ts->usec = ztimer_now(ZTIMER_USEC);
+#endif
+#ifdef MODULE_ZTIMER_MSEC
+    ts->msec = ztimer_now(ZTIMER_MSEC);
+#endif
+    (void)ts;
+}
+
+/* ZTIMER_USEC may not have counted while suspended, so take the larger of
+ * both clocks. ZTIMER_MSEC may have ticked right after taking the timestamp,
+ * so a millisecond less is counted */
+static uint32_t _elapsed_us(const _timestamp_t *before)
+{
+    _timestamp_t now;
+    uint32_t elapsed = 0;
+
+    _now(&now);
+#ifdef MODULE_ZTIMER_USEC
+    elapsed = now.usec - before->usec;
+#endif
+#ifdef MODULE_ZTIMER_MSEC
+    uint32_t ms = now.msec - before->msec;
+    if ((ms > 1) && (_to_us(ms - 1, US_PER_MS) > elapsed)) {
+        elapsed = _to_us(ms - 1, US_PER_MS);
+    }
+#endif
+    (void)before;
+    return elapsed;
+}
+
+#if _CAN_SUSPEND
+static void _wakeup_cb(void *arg)
+{
+    (void)arg;
+}
+
+static bool _suspend(pm_blocker_t *blocker)
+{
+    uint8_t usec_mode = ZTIMER_USEC_BASE->block_pm_mode;
+    uint8_t msec_mode = ZTIMER_MSEC_BASE->block_pm_mode;
+
+    if ((ZTIMER_USEC_BASE == ZTIMER_MSEC_BASE) ||
+        (usec_mode == ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) ||
+        !ZTIMER_USEC_BASE->list.next) {
+        return false;
+    }
+    if ((msec_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) &&
+        (msec_mode >= usec_mode)) {
+        return false;
+    }
+
+    /* see if anything else blocks the modes ZTIMER_USEC blocks */
+    pm_blocker_t without = *blocker;
+    without.val_u8[usec_mode]--;
+    unsigned target = _lowest(without);
+    if (target >= _lowest(*blocker)) {
+        return false;
+    }
+
+    uint32_t until = ztimer_until_next(ZTIMER_USEC);
+    const pm_governor_mode_t *params = &_modes[target];
+    if (until < (uint64_t)params->latency_us + params->residency_us) {
+        return false;
+    }
+    /* wake up a millisecond early, as ZTIMER_MSEC may tick right after
+     * setting the timer */
+    uint32_t sleep_ms = (until - params->latency_us) / US_PER_MS;
+    if (sleep_ms <= CONFIG_PM_GOVERNOR_SUSPEND_MIN_MS) {
+        return false;
+    }
+
+    DEBUG("pm_governor: suspending ZTIMER_USEC for %" PRIu32 " ms\n",
+          sleep_ms - 1);
+    _wakeup.callback = _wakeup_cb;
+    ztimer_set(ZTIMER_MSEC, &_wakeup, sleep_ms - 1);
+    pm_unblock(usec_mode);
+    *blocker = pm_get_blocker();
+    _stats.suspended++;
+    return true;
+}
+
+static void _resume(const _timestamp_t *before)
+{
+    _timestamp_t now;
+
+    ztimer_remove(ZTIMER_MSEC, &_wakeup);
+    pm_block(ZTIMER_USEC_BASE->block_pm_mode);
+
+    _now(&now);
+    uint32_t counted = now.usec - before->usec;
+    uint32_t ms = now.msec - before->msec;
+    /* count a millisecond less, so no timer fires early */
+    uint32_t passed = (ms > 1) ? _to_us(ms - 1, US_PER_MS) : 0;
+
+    if (passed > counted) {
+        DEBUG("pm_governor: ZTIMER_USEC missed %" PRIu32 " us\n",
+              passed - counted);
+        ztimer_advance(ZTIMER_USEC, passed - counted);
+    }
+}
+#endif /* _CAN_SUSPEND */
+
+void pm_governor_set_mode(unsigned mode, const pm_governor_mode_t *params)
+{
+    assert(mode < PM_NUM_MODES);
+
+    unsigned state = irq_disable();
+    _modes[mode] = *params;
+    irq_restore(state);
+}
+
+uint32_t pm_governor_next_deadline_us(void)
+{
+    return _next_deadline_us(true);
+}
+
+unsigned pm_governor_select(unsigned lowest)
+{
+    return _select(lowest, pm_governor_next_deadline_us());
+}
+
+void pm_governor_get_stats(pm_governor_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _stats;
+    irq_restore(state);
+}
+
+void pm_governor_reset_stats(void)
+{
+    unsigned state = irq_disable();
+    memset(&_stats, 0, sizeof(_stats));
+    irq_restore(state);
+}
+
+void pm_governor_set_lowest(void)
+{
+    unsigned state = irq_disable();
+    pm_blocker_t blocker = pm_get_blocker();
+    bool suspended = false;
+
+#if _CAN_SUSPEND
+    suspended = _suspend(&blocker);
+#endif
+
+    unsigned lowest = _lowest(blocker);
+    unsigned mode = _select(lowest, _next_deadline_us(!suspended));
+
+    _timestamp_t before;
+    _now(&before);
+    irq_restore(state);
+
+    /* pm_set() must be called with IRQs enabled, on native it waits for a
+     * signal. An interrupt right before only takes effect on the next call */
+    DEBUG("pm_governor: setting mode %u\n", mode);
+    pm_set(mode);
+
+    state = irq_disable();
+#if _CAN_SUSPEND
+    if (suspended) {
+        _resume(&before);
+    }
+#endif
+
+    if (mode != lowest) {
+        _stats.limited++;
+    }
+    _stats.entries[mode]++;
+    _stats.residency_us[mode] += _elapsed_us(&before);
+
+    irq_restore(state);
+}
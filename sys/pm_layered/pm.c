@@ -22,7 +22,9 @@
 
 #include "atomic_utils.h"
 #include "irq.h"
+#include "kernel_defines.h"
 #include "periph/pm.h"
+#include "pm_governor.h"
 #include "pm_layered.h"
 
 #define ENABLE_DEBUG 0
@@ -43,6 +45,11 @@ static pm_blocker_t pm_blocker = { .val_u32 = PM_BLOCKER_INITIAL };
 
 void pm_set_lowest(void)
 {
+    if (IS_USED(MODULE_PM_GOVERNOR)) {
+        pm_governor_set_lowest();
+        return;
+    }
+
     pm_blocker_t blocker = { .val_u32 = atomic_load_u32(&pm_blocker.val_u32) };
     unsigned mode = PM_NUM_MODES;
     while (mode) {
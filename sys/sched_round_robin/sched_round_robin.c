@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_round_robin
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling implementation
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "sched.h"
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifdef MODULE_SCHEDSTATISTICS
+#include "schedstatistics.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static void _slice_expired(void *arg);
+
+static ztimer_t _timer = { .callback = _slice_expired };
+
+static inline bool _is_sliced(uint8_t prio)
+{
+    return (CONFIG_SCHED_ROUND_ROBIN_PRIO_MASK >> prio) & 1;
+}
+
+static void _slice_expired(void *arg)
+{
+    (void)arg;
+    thread_t *active = thread_get_active();
+
+    if ((active == NULL) || !_is_sliced(active->priority)) {
+        return;
+    }
+
+    clist_node_t *rq = &sched_runqueues[active->priority];
+
+    if (rq->next->next == rq->next) {
+        /* no other thread of this priority is ready, start a new slice */
+        ztimer_set(ZTIMER_USEC, &_timer, CONFIG_SCHED_ROUND_ROBIN_SLICE_US);
+        return;
+    }
+
+    DEBUG("sched_round_robin: slice of %" PRIkernel_pid " expired\n",
+          active->pid);
+#ifdef MODULE_SCHEDSTATISTICS
+    sched_pidlist[active->pid].slices++;
+#endif
+    sched_runq_advance(active->priority);
+    thread_yield_higher();
+}
+
+static void _sched_cb(kernel_pid_t active, kernel_pid_t next)
+{
+#ifdef MODULE_SCHEDSTATISTICS
+    sched_statistics_cb(active, next);
+#else
+    (void)active;
+#endif
+    /* the scheduler reports descheduling and scheduling separately, the
+     * timer is only updated once the next thread is known */
+    if (next == KERNEL_PID_UNDEF) {
+        return;
+    }
+
+    thread_t *thread = thread_get(next);
+
+    /* every thread gets a full slice when it is scheduled */
+    if ((thread != NULL) && _is_sliced(thread->priority)) {
+        ztimer_set(ZTIMER_USEC, &_timer, CONFIG_SCHED_ROUND_ROBIN_SLICE_US);
+    }
+    else {
+        ztimer_remove(ZTIMER_USEC, &_timer);
+    }
+}
+
+void sched_round_robin_init(void)
+{
+    sched_register_cb(_sched_cb);
+    _sched_cb(KERNEL_PID_UNDEF, thread_getpid());
+}
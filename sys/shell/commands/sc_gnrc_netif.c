@@ -142,6 +142,8 @@ static const char *_netstats_module_to_str(uint8_t module)
             return "Layer 2";
         case NETSTATS_IPV6:
             return "IPv6";
+        case NETSTATS_QUEUE:
+            return "send queue";
         case NETSTATS_ALL:
             return "all";
         default:
@@ -179,6 +181,43 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
     }
     return res;
 }
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+static int _netif_stats_queue(netif_t *iface, bool reset)
+{
+    netstats_queue_t *stats;
+    int res = netif_get_opt(iface, NETOPT_STATS, NETSTATS_QUEUE, &stats,
+                            sizeof(&stats));
+
+    if (res < 0) {
+        puts("           Interface doesn't provide send queue statistics.");
+    }
+    else if (reset) {
+        /* keep the depth, it tracks the current content of the queue */
+        uint16_t depth = stats->depth;
+
+        memset(stats, 0, sizeof(netstats_queue_t));
+        stats->depth = depth;
+        stats->depth_max = depth;
+        printf("Reset statistics for module %s!\n",
+               _netstats_module_to_str(NETSTATS_QUEUE));
+    }
+    else {
+        printf("          Statistics for %s\n"
+               "            queued %u  depth %u (max: %u)\n"
+               "            dropped %u  deduplicated %u  coalesced %u\n",
+               _netstats_module_to_str(NETSTATS_QUEUE),
+               (unsigned) stats->queued,
+               (unsigned) stats->depth,
+               (unsigned) stats->depth_max,
+               (unsigned) stats->dropped,
+               (unsigned) stats->deduplicated,
+               (unsigned) stats->coalesced);
+        res = 0;
+    }
+    return res;
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 #endif /* MODULE_NETSTATS */
 
 static void _link_usage(char *cmd_name)
@@ -273,7 +312,7 @@ static void _del_usage(char *cmd_name)
 #ifdef MODULE_NETSTATS
 static void _stats_usage(char *cmd_name)
 {
-    printf("usage: %s <if_id> stats [l2|ipv6] [reset]\n", cmd_name);
+    printf("usage: %s <if_id> stats [l2|ipv6|queue] [reset]\n", cmd_name);
     puts("       reset can be only used if the module is specified.");
 }
 #endif
@@ -912,6 +951,9 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#if IS_USED(MODULE_NETSTATS) && IS_USED(MODULE_GNRC_NETIF_PKTQ)
+    _netif_stats_queue(iface, false);
 #endif
     puts("");
 }
@@ -1867,6 +1909,9 @@ int _gnrc_netif_config(int argc, char **argv)
             else if (strcmp(argv[3], "ipv6") == 0) {
                 module = NETSTATS_IPV6;
             }
+            else if (strcmp(argv[3], "queue") == 0) {
+                module = NETSTATS_QUEUE;
+            }
             else {
                 printf("Module %s doesn't exist or does not provide statistics.\n", argv[3]);
 
@@ -1883,6 +1928,11 @@ int _gnrc_netif_config(int argc, char **argv)
             if (module & NETSTATS_IPV6) {
                 _netif_stats(iface, NETSTATS_IPV6, reset);
             }
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+            if (module & NETSTATS_QUEUE) {
+                _netif_stats_queue(iface, reset);
+            }
+#endif
 
             return 1;
         }
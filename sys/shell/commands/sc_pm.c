@@ -20,6 +20,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -30,6 +31,10 @@
 
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_GOVERNOR
+#include "pm_governor.h"
+#endif /* MODULE_PM_GOVERNOR */
+
 static void _print_usage(void) {
     puts("Usage:");
 #ifdef MODULE_PM_LAYERED
@@ -38,6 +43,9 @@ static void _print_usage(void) {
     puts("\tpm block <mode>: manually block power mode");
     puts("\tpm unblock <mode>: manually unblock power mode");
 #endif /* MODULE_PM_LAYERED */
+#ifdef MODULE_PM_GOVERNOR
+    puts("\tpm stats [reset]: display or reset time spent in each power mode");
+#endif /* MODULE_PM_GOVERNOR */
     puts("\tpm off: call pm_off()");
 }
 
@@ -138,6 +146,28 @@ static int cmd_show(char *arg)
 }
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_GOVERNOR
+static int cmd_stats(void)
+{
+    pm_governor_stats_t stats;
+
+    pm_governor_get_stats(&stats);
+    for (unsigned i = 0; i <= PM_NUM_MODES; i++) {
+        if (i == PM_GOVERNOR_IDLE) {
+            printf("idle  ");
+        }
+        else {
+            printf("mode %u", i);
+        }
+        printf(" entries: %" PRIu32 " residency: %" PRIu32 " ms\n",
+               stats.entries[i], (uint32_t)(stats.residency_us[i] / 1000));
+    }
+    printf("limited by timers: %" PRIu32 "\n", stats.limited);
+    printf("ZTIMER_USEC suspended: %" PRIu32 "\n", stats.suspended);
+    return 0;
+}
+#endif /* MODULE_PM_GOVERNOR */
+
 static int cmd_off(char *arg)
 {
     (void)arg;
@@ -189,6 +219,21 @@ int _pm_handler(int argc, char **argv)
     }
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_GOVERNOR
+    if (!strcmp(argv[1], "stats")) {
+        if ((argc == 3) && !strcmp(argv[2], "reset")) {
+            pm_governor_reset_stats();
+            return 0;
+        }
+        if (argc != 2) {
+            puts("usage: pm stats [reset]");
+            return 1;
+        }
+
+        return cmd_stats();
+    }
+#endif /* MODULE_PM_GOVERNOR */
+
     if (!strcmp(argv[1], "off")) {
         return cmd_off(NULL);
     }
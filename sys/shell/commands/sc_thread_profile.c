@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell commands for the thread_profile module
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "thread_profile.h"
+
+static uint8_t _buf[THREAD_PROFILE_DUMP_SIZE_MAX];
+
+static int _dump(void)
+{
+    ssize_t len = thread_profile_dump(_buf, sizeof(_buf));
+
+    if (len < 0) {
+        puts("tprof: dump failed");
+        return 1;
+    }
+    printf("tprof dump %u: ", (unsigned)len);
+    for (ssize_t i = 0; i < len; i++) {
+        printf("%02x", _buf[i]);
+    }
+    puts("");
+    return 0;
+}
+
+int _tprof_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        thread_profile_print();
+        return 0;
+    }
+    if (strcmp(argv[1], "dump") == 0) {
+        return _dump();
+    }
+    if (strcmp(argv[1], "reset") == 0) {
+        thread_profile_reset();
+        return 0;
+    }
+    printf("usage: %s [dump|reset]\n", argv[0]);
+    return 1;
+}
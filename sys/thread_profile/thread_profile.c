@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_thread_profile
+ * @{
+ *
+ * @file
+ * @brief       Thread profiling implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "assert.h"
+#include "bitarithm.h"
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "thread_profile.h"
+#include "timex.h"
+
+#if defined(THREAD_PROFILE_DWT)
+#include "cpu.h"
+#include "periph_conf.h"
+#elif defined(CPU_NATIVE)
+#include <time.h>
+#else
+#include "ztimer.h"
+#endif
+
+/**
+ * When core_idle_thread is not active, KERNEL_PID_UNDEF is used to track
+ * the idle time
+ */
+static thread_profile_t _threads[KERNEL_PID_LAST + 1];
+static thread_profile_irq_t _irq;
+static const void *_irq_where;
+/* the hooks are called before the time base is initialized */
+static bool _started;
+
+thread_profile_ticks_t thread_profile_now(void)
+{
+#if defined(THREAD_PROFILE_DWT)
+    return DWT->CYCCNT;
+#elif defined(CPU_NATIVE)
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * NS_PER_SEC + t.tv_nsec;
+#else
+    return ztimer_now(ZTIMER_USEC);
+#endif
+}
+
+static void _hist_add(thread_profile_hist_t *hist, thread_profile_ticks_t ticks)
+{
+    uint32_t duration = (ticks > UINT32_MAX) ? UINT32_MAX : ticks;
+    unsigned bucket = (duration > 1) ? bitarithm_msb(duration) : 0;
+
+    if (bucket >= CONFIG_THREAD_PROFILE_HIST_BUCKETS) {
+        bucket = CONFIG_THREAD_PROFILE_HIST_BUCKETS - 1;
+    }
+    hist->buckets[bucket]++;
+    if (duration > hist->max) {
+        hist->max = duration;
+    }
+}
+
+static bool _is_tracked(kernel_pid_t pid)
+{
+    return !IS_USED(MODULE_CORE_IDLE_THREAD) || (pid != KERNEL_PID_UNDEF);
+}
+
+void thread_profile_wakeup(kernel_pid_t pid)
+{
+    if (!_started) {
+        return;
+    }
+
+    thread_profile_t *profile = &_threads[pid];
+
+    profile->woken = thread_profile_now();
+    profile->pending = true;
+}
+
+void thread_profile_sched(kernel_pid_t active, kernel_pid_t next)
+{
+    if (!_started) {
+        return;
+    }
+
+    thread_profile_ticks_t now = thread_profile_now();
+
+    if (_is_tracked(active)) {
+        thread_profile_t *profile = &_threads[active];
+        profile->runtime += (thread_profile_ticks_t)(now - profile->laststart);
+    }
+
+    if (_is_tracked(next)) {
+        thread_profile_t *profile = &_threads[next];
+        profile->laststart = now;
+        profile->schedules++;
+        if (profile->pending) {
+            _hist_add(&profile->latency,
+                      (thread_profile_ticks_t)(now - profile->woken));
+            profile->pending = false;
+        }
+    }
+}
+
+void thread_profile_irq_off(const void *where)
+{
+    if (!_started) {
+        return;
+    }
+
+    /* irq_disable() is inlined on Cortex-M, so our caller is the one of
+     * irq_disable() there */
+    _irq_where = where ? where : __builtin_return_address(0);
+    _irq.start = thread_profile_now();
+    _irq.off = true;
+}
+
+void thread_profile_irq_on(void)
+{
+    if (!_irq.off) {
+        return;
+    }
+    _irq.off = false;
+
+    thread_profile_ticks_t duration = thread_profile_now() - _irq.start;
+
+    if (duration >= _irq.hist.max) {
+        _irq.longest = _irq_where;
+        _irq.longest_pid = thread_getpid();
+    }
+    _hist_add(&_irq.hist, duration);
+}
+
+void thread_profile_init(void)
+{
+#if defined(THREAD_PROFILE_DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if defined(CPU_CORE_CORTEX_M7)
+    /* the DWT of the Cortex-M7 is locked after reset */
+    DWT->LAR = 0xC5ACCE55;
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    /* the thread starting the profiling was scheduled without it */
+    thread_profile_t *profile = &_threads[thread_getpid()];
+    profile->laststart = thread_profile_now();
+    profile->schedules = 1;
+    _started = true;
+}
+
+const thread_profile_t *thread_profile_get(kernel_pid_t pid)
+{
+    assert(pid >= KERNEL_PID_UNDEF && pid <= KERNEL_PID_LAST);
+    return &_threads[pid];
+}
+
+const thread_profile_irq_t *thread_profile_irq_get(void)
+{
+    return &_irq;
+}
+
+void thread_profile_reset(void)
+{
+    unsigned state = irq_disable();
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        thread_profile_t *profile = &_threads[pid];
+        profile->runtime = 0;
+        profile->schedules = 0;
+        memset(&profile->latency, 0, sizeof(profile->latency));
+    }
+    /* the currently running thread keeps counting from now on */
+    _threads[thread_getpid()].laststart = thread_profile_now();
+    memset(&_irq.hist, 0, sizeof(_irq.hist));
+    _irq.longest = NULL;
+    _irq.longest_pid = KERNEL_PID_UNDEF;
+
+    irq_restore(state);
+}
+
+uint64_t thread_profile_ticks_to_us(uint64_t ticks)
+{
+    uint64_t tps = THREAD_PROFILE_TICKS_PER_SEC;
+
+    return (ticks / tps) * US_PER_SEC + ((ticks % tps) * US_PER_SEC) / tps;
+}
+
+static bool _exists(kernel_pid_t pid)
+{
+    return (pid == KERNEL_PID_UNDEF) ? !IS_USED(MODULE_CORE_IDLE_THREAD)
+                                     : (thread_get(pid) != NULL);
+}
+
+/* copies a profile, including the time slice of the running thread up to
+ * @p now */
+static void _snapshot(kernel_pid_t pid, thread_profile_t *profile,
+                      thread_profile_ticks_t now)
+{
+    unsigned state = irq_disable();
+
+    *profile = _threads[pid];
+    if (pid == thread_getpid()) {
+        profile->runtime += (thread_profile_ticks_t)(now - profile->laststart);
+    }
+
+    irq_restore(state);
+}
+
+static uint8_t *_put(uint8_t *pos, uint64_t val, unsigned len)
+{
+    for (unsigned i = 0; i < len; i++) {
+        *pos++ = val >> (8 * i);
+    }
+    return pos;
+}
+
+static uint8_t *_put_hist(uint8_t *pos, const thread_profile_hist_t *hist)
+{
+    pos = _put(pos, hist->max, 4);
+    for (unsigned i = 0; i < CONFIG_THREAD_PROFILE_HIST_BUCKETS; i++) {
+        pos = _put(pos, hist->buckets[i], 4);
+    }
+    return pos;
+}
+
+ssize_t thread_profile_dump(void *buf, size_t len)
+{
+    unsigned records = 0;
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        records += _exists(pid);
+    }
+
+    size_t size = sizeof(thread_profile_dump_hdr_t) +
+                  (records * THREAD_PROFILE_DUMP_RECORD_SIZE) +
+                  THREAD_PROFILE_DUMP_IRQ_SIZE;
+
+    if (buf == NULL) {
+        return size;
+    }
+    if (len < size) {
+        return -ENOBUFS;
+    }
+
+    thread_profile_ticks_t now = thread_profile_now();
+    uint8_t *pos = buf;
+
+    pos = _put(pos, THREAD_PROFILE_DUMP_MAGIC, 4);
+    pos = _put(pos, THREAD_PROFILE_DUMP_VERSION, 1);
+    pos = _put(pos, CONFIG_THREAD_PROFILE_HIST_BUCKETS, 1);
+    /* number of records is filled in last, threads may have exited */
+    uint8_t *num = pos;
+    pos += 2;
+    pos = _put(pos, THREAD_PROFILE_TICKS_PER_SEC, 4);
+
+    records = 0;
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        thread_profile_t profile;
+
+        /* skip threads created since counting */
+        if (!_exists(pid) ||
+            (pos + THREAD_PROFILE_DUMP_RECORD_SIZE +
+             THREAD_PROFILE_DUMP_IRQ_SIZE > (uint8_t *)buf + size)) {
+            continue;
+        }
+        _snapshot(pid, &profile, now);
+        pos = _put(pos, pid, 2);
+        pos = _put(pos, 0, 2);
+        pos = _put(pos, profile.schedules, 4);
+        pos = _put(pos, profile.runtime, 8);
+        pos = _put_hist(pos, &profile.latency);
+        records++;
+    }
+    _put(num, records, 2);
+
+    unsigned state = irq_disable();
+    thread_profile_irq_t irq = _irq;
+    irq_restore(state);
+
+    pos = _put(pos, irq.longest_pid, 2);
+    pos = _put(pos, 0, 2);
+    pos = _put(pos, (uintptr_t)irq.longest, 8);
+    pos = _put_hist(pos, &irq.hist);
+
+    return pos - (uint8_t *)buf;
+}
+
+static void _print_hist(const char *name, const thread_profile_hist_t *hist)
+{
+    unsigned last = 0;
+
+    for (unsigned i = 0; i < CONFIG_THREAD_PROFILE_HIST_BUCKETS; i++) {
+        if (hist->buckets[i]) {
+            last = i + 1;
+        }
+    }
+    if (!last) {
+        return;
+    }
+    printf("\t%s:", name);
+    for (unsigned i = 0; i < last; i++) {
+        printf(" %" PRIu32, hist->buckets[i]);
+    }
+    puts("");
+}
+
+void thread_profile_print(void)
+{
+    thread_profile_ticks_t now = thread_profile_now();
+    thread_profile_t profile;
+    uint64_t total = 0;
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        if (_exists(pid)) {
+            _snapshot(pid, &profile, now);
+            total += profile.runtime;
+        }
+    }
+
+    printf("ticks per second: %" PRIu32 "\n",
+           (uint32_t)THREAD_PROFILE_TICKS_PER_SEC);
+    printf("\tpid | %-21s| runtime us   | cpu    | switches   | lat max us\n",
+           "name");
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        if (!_exists(pid)) {
+            continue;
+        }
+        _snapshot(pid, &profile, now);
+
+        const char *name = "idle";
+        if (pid != KERNEL_PID_UNDEF) {
+            name = thread_getname(pid);
+        }
+        unsigned permille = total ? (profile.runtime * 1000) / total : 0;
+
+        printf("\t%3" PRIkernel_pid " | %-21s| %12" PRIu32 " | %3u.%u%% | %10"
+               PRIu32 " | %10" PRIu32 "\n",
+               pid, name ? name : "-",
+               (uint32_t)thread_profile_ticks_to_us(profile.runtime),
+               permille / 10, permille % 10, profile.schedules,
+               (uint32_t)thread_profile_ticks_to_us(profile.latency.max));
+        _print_hist("latency", &profile.latency);
+    }
+
+    if (IS_USED(MODULE_THREAD_PROFILE_IRQ)) {
+        unsigned state = irq_disable();
+        thread_profile_irq_t irq = _irq;
+        irq_restore(state);
+
+        printf("irq off max: %" PRIu32 " us (%" PRIu32 " ticks) at %p in pid %"
+               PRIkernel_pid "\n",
+               (uint32_t)thread_profile_ticks_to_us(irq.hist.max),
+               irq.hist.max, irq.longest, irq.longest_pid);
+        _print_hist("irq off", &irq.hist);
+    }
+}
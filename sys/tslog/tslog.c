@@ -0,0 +1,504 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_tslog
+ * @{
+ *
+ * @file
+ * @brief       Time-series log implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "mtd.h"
+#include "mutex.h"
+#include "tslog.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define TSLOG_MAGIC         (0x54534c47UL)  /**< "TSLG" */
+
+#define LEN_ERASED          (0xffffU)
+#define WORD_ERASED         (0xffffffffUL)
+
+/* chunk size used when scanning flash */
+#define CHUNK_SIZE          (32U)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t time;      /* time stamp of the last record before this sector */
+} _sector_hdr_t;
+
+typedef struct {
+    uint32_t time;
+    uint16_t len;
+    uint16_t crc;
+} _record_hdr_t;
+
+static_assert(sizeof(_sector_hdr_t) == TSLOG_SECTOR_HDR_SIZE,
+              "unexpected sector header size");
+static_assert(sizeof(_record_hdr_t) == TSLOG_RECORD_HDR_SIZE,
+              "unexpected record header size");
+
+static uint32_t _sector_size(const tslog_t *log)
+{
+    return log->mtd->pages_per_sector * log->mtd->page_size;
+}
+
+static uint32_t _page(const tslog_t *log, uint32_t idx)
+{
+    return (log->first_sector + idx) * log->mtd->pages_per_sector;
+}
+
+static uint32_t _next(const tslog_t *log, uint32_t idx)
+{
+    return (idx + 1 == log->sector_numof) ? 0 : idx + 1;
+}
+
+static bool _empty(const tslog_t *log)
+{
+    return log->head_offset == 0;
+}
+
+static int _read(const tslog_t *log, uint32_t idx, uint32_t offset,
+                 void *dest, uint32_t len)
+{
+    return mtd_read_page(log->mtd, dest, _page(log, idx), offset, len);
+}
+
+static int _read_sector_hdr(const tslog_t *log, uint32_t idx,
+                            _sector_hdr_t *hdr)
+{
+    int res = _read(log, idx, 0, hdr, sizeof(*hdr));
+    if (res < 0) {
+        return res;
+    }
+    if ((hdr->magic != TSLOG_MAGIC) ||
+        (hdr->seq == WORD_ERASED) || (hdr->time == WORD_ERASED)) {
+        return -ENOENT;
+    }
+    return 0;
+}
+
+/* read a record header, -ENOENT if there is none at @p offset */
+static int _read_record_hdr(const tslog_t *log, uint32_t idx, uint32_t offset,
+                            _record_hdr_t *hdr)
+{
+    if (offset + sizeof(*hdr) > _sector_size(log)) {
+        return -ENOENT;
+    }
+    int res = _read(log, idx, offset, hdr, sizeof(*hdr));
+    if (res < 0) {
+        return res;
+    }
+    if ((hdr->len == LEN_ERASED) ||
+        (offset + TSLOG_RECORD_SIZE(hdr->len) > _sector_size(log))) {
+        return -ENOENT;
+    }
+    return 0;
+}
+
+static uint16_t _crc_hdr(const _record_hdr_t *hdr)
+{
+    uint16_t crc = crc16_ccitt_update(0xffff, (const void *)&hdr->time,
+                                      sizeof(hdr->time));
+    return crc16_ccitt_update(crc, (const void *)&hdr->len, sizeof(hdr->len));
+}
+
+/* read the payload into @p data and verify the CRC of the record */
+static int _read_payload(const tslog_t *log, uint32_t idx, uint32_t offset,
+                         const _record_hdr_t *hdr, void *data, size_t len)
+{
+    uint16_t crc = _crc_hdr(hdr);
+    uint32_t pos = offset + sizeof(*hdr);
+    uint32_t left = hdr->len;
+    int res;
+
+    if (data && len) {
+        len = (len < left) ? len : left;
+        res = _read(log, idx, pos, data, len);
+        if (res < 0) {
+            return res;
+        }
+        crc = crc16_ccitt_update(crc, data, len);
+        pos += len;
+        left -= len;
+    }
+
+    while (left) {
+        uint8_t chunk[CHUNK_SIZE];
+        uint32_t n = (left < sizeof(chunk)) ? left : sizeof(chunk);
+        res = _read(log, idx, pos, chunk, n);
+        if (res < 0) {
+            return res;
+        }
+        crc = crc16_ccitt_update(crc, chunk, n);
+        pos += n;
+        left -= n;
+    }
+
+    return (crc == hdr->crc) ? 0 : -EBADMSG;
+}
+
+static int _is_erased(const tslog_t *log, uint32_t idx, uint32_t offset)
+{
+    while (offset < _sector_size(log)) {
+        uint8_t chunk[CHUNK_SIZE];
+        uint32_t n = _sector_size(log) - offset;
+        n = (n < sizeof(chunk)) ? n : sizeof(chunk);
+        int res = _read(log, idx, offset, chunk, n);
+        if (res < 0) {
+            return res;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            if (chunk[i] != 0xff) {
+                return 0;
+            }
+        }
+        offset += n;
+    }
+    return 1;
+}
+
+/* erase sector @p idx and make it the head of the log */
+static int _open(tslog_t *log, uint32_t idx)
+{
+    if (_empty(log)) {
+        log->tail = idx;
+    }
+    else if (idx == log->tail) {
+        /* drop the oldest sector */
+        log->tail = _next(log, log->tail);
+    }
+
+    /* from here on, the old head is closed even if this fails */
+    log->head = idx;
+    log->head_offset = _sector_size(log);
+
+    int res = mtd_erase_sector(log->mtd, log->first_sector + idx, 1);
+    if (res < 0) {
+        return res;
+    }
+
+    _sector_hdr_t hdr = {
+        .magic = TSLOG_MAGIC,
+        .seq = ++log->seq,
+        .time = log->last_time,
+    };
+
+    /* the magic commits the header */
+    res = mtd_write_page_raw(log->mtd, &hdr.seq, _page(log, idx),
+                             offsetof(_sector_hdr_t, seq),
+                             sizeof(hdr) - offsetof(_sector_hdr_t, seq));
+    if (res < 0) {
+        return res;
+    }
+    res = mtd_write_page_raw(log->mtd, &hdr.magic, _page(log, idx),
+                             offsetof(_sector_hdr_t, magic), sizeof(hdr.magic));
+    if (res < 0) {
+        return res;
+    }
+
+    DEBUG("tslog: open sector %" PRIu32 " (seq %" PRIu32 ")\n", idx, log->seq);
+    log->head_offset = sizeof(hdr);
+    return 0;
+}
+
+/* find the end of the log in the head sector */
+static int _recover_head(tslog_t *log)
+{
+    uint32_t offset = TSLOG_SECTOR_HDR_SIZE;
+    _record_hdr_t hdr;
+    int res;
+
+    while ((res = _read_record_hdr(log, log->head, offset, &hdr)) == 0) {
+        res = _read_payload(log, log->head, offset, &hdr, NULL, 0);
+        if (res < 0) {
+            break;
+        }
+        log->last_time = hdr.time;
+        offset += TSLOG_RECORD_SIZE(hdr.len);
+    }
+
+    if (res == -ENOENT) {
+        res = _is_erased(log, log->head, offset);
+    }
+    else if (res == -EBADMSG) {
+        res = 0;
+    }
+    if (res < 0) {
+        return res;
+    }
+
+    /* never program on top of a torn write */
+    log->head_offset = res ? offset : _sector_size(log);
+    DEBUG("tslog: recovered head %" PRIu32 " at offset %" PRIu32 "\n",
+          log->head, log->head_offset);
+    return 0;
+}
+
+int tslog_init(tslog_t *log, mtd_dev_t *mtd, uint32_t first_sector,
+               uint32_t sector_numof)
+{
+    assert(sector_numof >= 2);
+    assert(first_sector + sector_numof <= mtd->sector_count);
+
+    memset(log, 0, sizeof(*log));
+    mutex_init(&log->lock);
+    log->mtd = mtd;
+    log->first_sector = first_sector;
+    log->sector_numof = sector_numof;
+
+    /* the newest sector is the head */
+    bool found = false;
+    for (uint32_t i = 0; i < sector_numof; i++) {
+        _sector_hdr_t hdr;
+        int res = _read_sector_hdr(log, i, &hdr);
+        if (res == -ENOENT) {
+            continue;
+        }
+        if (res < 0) {
+            return res;
+        }
+        if (!found || ((int32_t)(hdr.seq - log->seq) > 0)) {
+            found = true;
+            log->head = i;
+            log->seq = hdr.seq;
+            log->last_time = hdr.time;
+        }
+    }
+    if (!found) {
+        return 0;
+    }
+
+    /* walk back as long as the sequence numbers are contiguous */
+    log->tail = log->head;
+    for (uint32_t n = 1; n < sector_numof; n++) {
+        uint32_t prev = (log->tail == 0) ? sector_numof - 1 : log->tail - 1;
+        _sector_hdr_t hdr;
+        int res = _read_sector_hdr(log, prev, &hdr);
+        if (res == -ENOENT) {
+            break;
+        }
+        if (res < 0) {
+            return res;
+        }
+        if (hdr.seq != log->seq - n) {
+            break;
+        }
+        log->tail = prev;
+    }
+
+    return _recover_head(log);
+}
+
+int tslog_append(tslog_t *log, uint32_t time, const void *data, size_t len)
+{
+    uint32_t size = TSLOG_RECORD_SIZE(len);
+    int res = 0;
+
+    if ((len >= LEN_ERASED) ||
+        (TSLOG_SECTOR_HDR_SIZE + size > _sector_size(log))) {
+        return -EMSGSIZE;
+    }
+
+    mutex_lock(&log->lock);
+    if ((time == WORD_ERASED) ||
+        (!_empty(log) && (time < log->last_time))) {
+        res = -EINVAL;
+        goto out;
+    }
+
+    if (_empty(log)) {
+        res = _open(log, log->head);
+    }
+    else if (log->head_offset + size > _sector_size(log)) {
+        res = _open(log, _next(log, log->head));
+    }
+    if (res < 0) {
+        goto out;
+    }
+
+    uint32_t page = _page(log, log->head);
+    uint32_t offset = log->head_offset;
+    _record_hdr_t hdr = {
+        .time = time,
+        .len = len,
+    };
+
+    /* nothing may be programmed twice if this fails */
+    log->head_offset += size;
+
+    /* payload first, in whole words */
+    uint32_t aligned = len & ~3U;
+    if (aligned) {
+        res = mtd_write_page_raw(log->mtd, data, page,
+                                 offset + sizeof(hdr), aligned);
+        if (res < 0) {
+            goto out;
+        }
+    }
+    if (len > aligned) {
+        uint8_t tail[4];
+        memset(tail, 0xff, sizeof(tail));
+        memcpy(tail, (const uint8_t *)data + aligned, len - aligned);
+        res = mtd_write_page_raw(log->mtd, tail, page,
+                                 offset + sizeof(hdr) + aligned, sizeof(tail));
+        if (res < 0) {
+            goto out;
+        }
+    }
+
+    /* the header commits the record */
+    hdr.crc = crc16_ccitt_update(_crc_hdr(&hdr), data, len);
+    res = mtd_write_page_raw(log->mtd, &hdr, page, offset, sizeof(hdr));
+    if (res == 0) {
+        log->last_time = time;
+    }
+
+out:
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+/* advance @p pos to the next record header, -ENOENT at the end of the log */
+static int _peek(tslog_t *log, tslog_pos_t *pos, _record_hdr_t *hdr)
+{
+    for (;;) {
+        bool head = (pos->sector == log->head);
+        if (!head || (pos->offset < log->head_offset)) {
+            int res = _read_record_hdr(log, pos->sector, pos->offset, hdr);
+            if (res != -ENOENT) {
+                return res;
+            }
+        }
+        if (head) {
+            return -ENOENT;
+        }
+        pos->sector = _next(log, pos->sector);
+        pos->offset = TSLOG_SECTOR_HDR_SIZE;
+    }
+}
+
+int tslog_seek(tslog_t *log, tslog_pos_t *pos, uint32_t time)
+{
+    int res;
+
+    mutex_lock(&log->lock);
+    if (_empty(log)) {
+        res = -ENOENT;
+        goto out;
+    }
+
+    /* find the newest sector started before @p time, all records in
+     * earlier sectors are older */
+    uint32_t numof = (log->head + log->sector_numof - log->tail)
+                   % log->sector_numof + 1;
+    uint32_t lo = 0;
+    uint32_t hi = numof;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        _sector_hdr_t hdr;
+        res = _read_sector_hdr(log, (log->tail + mid) % log->sector_numof,
+                               &hdr);
+        if (res < 0) {
+            goto out;
+        }
+        if (hdr.time < time) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+
+    pos->sector = (log->tail + (lo ? lo - 1 : 0)) % log->sector_numof;
+    pos->offset = TSLOG_SECTOR_HDR_SIZE;
+
+    _record_hdr_t hdr;
+    while ((res = _peek(log, pos, &hdr)) == 0) {
+        if (hdr.time >= time) {
+            break;
+        }
+        pos->offset += TSLOG_RECORD_SIZE(hdr.len);
+    }
+
+out:
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+int tslog_read(tslog_t *log, tslog_pos_t *pos, uint32_t *time,
+               void *data, size_t len)
+{
+    _record_hdr_t hdr;
+
+    mutex_lock(&log->lock);
+    int res = _empty(log) ? -ENOENT : _peek(log, pos, &hdr);
+    while (res == 0) {
+        res = _read_payload(log, pos->sector, pos->offset, &hdr, data, len);
+        if (res != -EBADMSG) {
+            pos->offset += TSLOG_RECORD_SIZE(hdr.len);
+            break;
+        }
+        /* the length of a torn record cannot be trusted, so skip the rest
+         * of the sector just like tslog_init() does */
+        DEBUG("tslog: bad record in sector %" PRIu32 " at offset %" PRIu32
+              "\n", pos->sector, pos->offset);
+        if (pos->sector == log->head) {
+            res = -ENOENT;
+            break;
+        }
+        pos->sector = _next(log, pos->sector);
+        pos->offset = TSLOG_SECTOR_HDR_SIZE;
+        res = _peek(log, pos, &hdr);
+    }
+    mutex_unlock(&log->lock);
+
+    if (res < 0) {
+        return res;
+    }
+    if (time) {
+        *time = hdr.time;
+    }
+    return hdr.len;
+}
+
+int tslog_clear(tslog_t *log)
+{
+    int res = 0;
+
+    mutex_lock(&log->lock);
+    while (!_empty(log)) {
+        res = mtd_erase_sector(log->mtd, log->first_sector + log->tail, 1);
+        if (res < 0) {
+            break;
+        }
+        if (log->tail == log->head) {
+            log->head = _next(log, log->head);
+            log->head_offset = 0;
+            log->last_time = 0;
+        }
+        else {
+            log->tail = _next(log, log->tail);
+        }
+    }
+    mutex_unlock(&log->lock);
+    return res;
+}
@@ -17,9 +17,18 @@
  * @}
  */
 
+#include <limits.h>
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
+/* reserved writes modulo 2^24 and number of producers writing, packed into
+ * tsrb_mp_t::state */
+#define MP_HEAD_SHIFT       (8U)
+#define MP_HEAD_MASK        (0xffffffLU)
+#define MP_PENDING_MASK     (0xffU)
+
 static void _push(tsrb_t *rb, uint8_t c)
 {
     rb->buf[rb->writes++ & (rb->size - 1)] = c;
@@ -30,6 +39,31 @@ static uint8_t _pop(tsrb_t *rb)
     return rb->buf[rb->reads++ & (rb->size - 1)];
 }
 
+/* copies up to the end of the buffer and the rest from its start */
+static void _write(tsrb_t *rb, unsigned pos, const uint8_t *src, size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t chunk = rb->size - idx;
+
+    if (chunk > n) {
+        chunk = n;
+    }
+    memcpy(&rb->buf[idx], src, chunk);
+    memcpy(rb->buf, src + chunk, n - chunk);
+}
+
+static void _read(const tsrb_t *rb, unsigned pos, uint8_t *dst, size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t chunk = rb->size - idx;
+
+    if (chunk > n) {
+        chunk = n;
+    }
+    memcpy(dst, &rb->buf[idx], chunk);
+    memcpy(dst + chunk, rb->buf, n - chunk);
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -43,26 +77,27 @@ int tsrb_get_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    size_t avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    _read(rb, rb->reads, dst, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    size_t avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -79,12 +114,110 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    size_t space = rb->size - (rb->writes - rb->reads);
+    if (n > space) {
+        n = space;
     }
+    _write(rb, rb->writes, src, n);
+    rb->writes += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
+}
+
+unsigned tsrb_reserve(tsrb_t *rb, uint8_t **data)
+{
+    unsigned irq_state = irq_disable();
+    unsigned idx = rb->writes & (rb->size - 1);
+    unsigned space = rb->size - (rb->writes - rb->reads);
+    irq_restore(irq_state);
+
+    *data = &rb->buf[idx];
+    return (space < rb->size - idx) ? space : rb->size - idx;
+}
+
+void tsrb_commit(tsrb_t *rb, unsigned n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= rb->size - (rb->writes - rb->reads));
+    rb->writes += n;
+    irq_restore(irq_state);
+}
+
+unsigned tsrb_peek(const tsrb_t *rb, const uint8_t **data)
+{
+    unsigned irq_state = irq_disable();
+    unsigned idx = rb->reads & (rb->size - 1);
+    unsigned avail = rb->writes - rb->reads;
+    irq_restore(irq_state);
+
+    *data = &rb->buf[idx];
+    return (avail < rb->size - idx) ? avail : rb->size - idx;
+}
+
+void tsrb_consume(tsrb_t *rb, unsigned n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= rb->writes - rb->reads);
+    rb->reads += n;
+    irq_restore(irq_state);
+}
+
+void tsrb_mp_init(tsrb_mp_t *rb, uint8_t *buffer, unsigned bufsize)
+{
+    assert(bufsize <= TSRB_MP_SIZE_MAX);
+
+    tsrb_init(&rb->rb, buffer, bufsize);
+    atomic_init(&rb->state, 0);
+}
+
+/* makes all reserved bytes readable, unless a producer is still writing.
+ * That one publishes them when done. */
+static void _mp_publish(tsrb_mp_t *mp)
+{
+    unsigned irq_state = irq_disable();
+    uint32_t state = atomic_load(&mp->state);
+    if (!(state & MP_PENDING_MASK)) {
+        mp->rb.writes += ((state >> MP_HEAD_SHIFT) - mp->rb.writes)
+                         & MP_HEAD_MASK;
+    }
+    irq_restore(irq_state);
+}
+
+int tsrb_mp_add(tsrb_mp_t *mp, const uint8_t *src, size_t n)
+{
+    tsrb_t *rb = &mp->rb;
+    uint32_t state;
+    uint32_t head;
+    size_t len;
+
+    do {
+        /* reads may not be atomic on 8 and 16 bit platforms. Loading it
+         * together with the state keeps both consistent */
+        unsigned irq_state = irq_disable();
+        uint32_t reads = rb->reads;
+        state = atomic_load(&mp->state);
+        irq_restore(irq_state);
+
+        head = state >> MP_HEAD_SHIFT;
+        /* the pending count must not overflow into the head, check it
+         * before the compare and swap below can publish the overflow */
+        assert((state & MP_PENDING_MASK) < MP_PENDING_MASK);
+
+        /* reads wraps at UINT_MAX, the head at MP_HEAD_MASK */
+        size_t space = rb->size - ((head - reads) & MP_HEAD_MASK & UINT_MAX);
+        len = (n < space) ? n : space;
+        if (!len) {
+            return 0;
+        }
+    } while (!atomic_compare_exchange_weak(&mp->state, &state,
+                 (((head + len) & MP_HEAD_MASK) << MP_HEAD_SHIFT) |
+                 ((state & MP_PENDING_MASK) + 1)));
+
+    _write(rb, head, src, len);
+
+    if (!((atomic_fetch_sub(&mp->state, 1) - 1) & MP_PENDING_MASK)) {
+        _mp_publish(mp);
+    }
+    return len;
 }
@@ -15,6 +15,7 @@
  */
 
 #include <errno.h> /* for error codes */
+#include <stdbool.h> /* for bool */
 #include <string.h> /* for strncmp */
 #include <stddef.h> /* for NULL */
 #include <sys/types.h> /* for off_t etc */
@@ -24,10 +25,15 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "vfs.h"
+#include "bitarithm.h"
 #include "mutex.h"
 #include "thread.h"
 #include "sched.h"
 #include "clist.h"
+#include "kernel_defines.h"
+#if IS_USED(MODULE_VFS_BUFFERED)
+#include "memarray.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -51,6 +57,65 @@
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+/**
+ * @internal
+ * @brief Number of fd numbers tracked per word of the allocation bitmap
+ */
+#define VFS_FD_WORD_BITS    (sizeof(unsigned) * 8)
+
+/**
+ * @internal
+ * @brief Number of words in the allocation bitmap
+ */
+#define VFS_FD_WORDS        ((VFS_MAX_OPEN_FILES + VFS_FD_WORD_BITS - 1) / VFS_FD_WORD_BITS)
+
+/**
+ * @internal
+ * @brief Bitmap of fd numbers currently in use, bit n represents fd n
+ *
+ * Lets _allocate_fd find a free slot with a find-first-set per word instead
+ * of scanning the open files table. Protected by _open_mutex.
+ */
+static unsigned _vfs_used_fds[VFS_FD_WORDS];
+
+#if IS_USED(MODULE_VFS_BUFFERED)
+/**
+ * @internal
+ * @brief Read-ahead/write-back buffer attached to an open file
+ */
+typedef struct {
+    uint8_t data[CONFIG_VFS_BUFFER_SIZE];   /**< buffered file contents */
+    size_t size;                            /**< usable bytes of data */
+    size_t len;                             /**< number of valid bytes in data */
+    size_t idx;                             /**< read position within data */
+    bool dirty;                             /**< data holds pending writes */
+} _vfs_buf_t;
+
+/**
+ * @internal
+ * @brief Storage for the buffer pool
+ */
+static _vfs_buf_t _vfs_buf_storage[CONFIG_VFS_BUFFER_NUMOF];
+
+/**
+ * @internal
+ * @brief Buffer pool, lazily initialized by vfs_buffer_attach
+ */
+static memarray_t _vfs_buf_pool;
+
+/**
+ * @internal
+ * @brief Set once _vfs_buf_pool has been initialized
+ */
+static bool _vfs_buf_pool_ready;
+
+/**
+ * @internal
+ * @brief Buffers attached to open files, indexed by fd number
+ */
+static _vfs_buf_t *_vfs_bufs[VFS_MAX_OPEN_FILES];
+#endif
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
@@ -68,9 +133,8 @@ static clist_node_t _vfs_mounts_list;
  * corresponding slot in the open files table is already occupied, no iteration
  * is done to find another free number in this case.
  *
- * If the @p fd argument is negative, the algorithm will iterate through the
- * open files table until it find an unused slot and return the number of that
- * slot.
+ * If the @p fd argument is negative, the lowest unused slot is looked up in
+ * the allocation bitmap and its number is returned.
  *
  * @param[in]  fd  Desired fd number, use VFS_ANY_FD for any free fd
  *
@@ -130,6 +194,62 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
+/**
+ * @internal
+ * @brief Seek in an open file without touching any attached buffer
+ *
+ * @param[in]  filp     open file
+ * @param[in]  off      seek offset
+ * @param[in]  whence   seek method, see vfs_lseek
+ *
+ * @return the new seek location in the file on success
+ * @return <0 on error
+ */
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence);
+
+#if IS_USED(MODULE_VFS_BUFFERED)
+/**
+ * @internal
+ * @brief Write pending data of @p buf to the file system driver
+ *
+ * @return 0 on success
+ * @return <0 on error, unwritten data stays in the buffer
+ */
+static int _buf_flush(vfs_file_t *filp, _vfs_buf_t *buf);
+
+/**
+ * @internal
+ * @brief Bring the file system driver in sync with the user's view of @p filp
+ *
+ * Flushes pending writes or rewinds over unconsumed read-ahead data.
+ *
+ * @param[in]  filp     open file
+ * @param[in]  buf      buffer attached to @p filp, may be NULL
+ *
+ * @return 0 on success
+ * @return <0 on error
+ */
+static int _buf_sync(vfs_file_t *filp, _vfs_buf_t *buf);
+
+/**
+ * @internal
+ * @brief Return the buffer attached to @p fd, if any, to the pool
+ */
+static void _buf_release(int fd);
+
+/**
+ * @internal
+ * @brief Read from an open file through its buffer
+ */
+static ssize_t _buf_read(vfs_file_t *filp, _vfs_buf_t *buf, void *dest, size_t count);
+
+/**
+ * @internal
+ * @brief Write to an open file through its buffer
+ */
+static ssize_t _buf_write(vfs_file_t *filp, _vfs_buf_t *buf, const void *src, size_t count);
+#endif
+
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
@@ -141,10 +261,17 @@ int vfs_close(int fd)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+#if IS_USED(MODULE_VFS_BUFFERED)
+    /* pending writes are lost if this fails, the file is closed regardless */
+    res = _buf_sync(filp, _vfs_bufs[fd]);
+#endif
     if (filp->f_op->close != NULL) {
         /* We will invalidate the fd regardless of the outcome of the file
          * system driver close() call below */
-        res = filp->f_op->close(filp);
+        int close_res = filp->f_op->close(filp);
+        if (res == 0) {
+            res = close_res;
+        }
     }
     _free_fd(fd);
     return res;
@@ -190,6 +317,13 @@ int vfs_fstat(int fd, struct stat *buf)
         /* driver does not implement fstat() */
         return -EINVAL;
     }
+#if IS_USED(MODULE_VFS_BUFFERED)
+    /* make sure the reported size includes pending writes */
+    res = _buf_sync(filp, _vfs_bufs[fd]);
+    if (res < 0) {
+        return res;
+    }
+#endif
     return filp->f_op->fstat(filp, buf);
 }
 
@@ -223,6 +357,17 @@ off_t vfs_lseek(int fd, off_t off, int whence)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+#if IS_USED(MODULE_VFS_BUFFERED)
+    res = _buf_sync(filp, _vfs_bufs[fd]);
+    if (res < 0) {
+        return res;
+    }
+#endif
+    return _lseek(filp, off, whence);
+}
+
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
+{
     if (filp->f_op->lseek == NULL) {
         /* driver does not implement lseek() */
         /* default seek functionality is naive */
@@ -308,6 +453,11 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
         /* driver does not implement read() */
         return -EINVAL;
     }
+#if IS_USED(MODULE_VFS_BUFFERED)
+    if (_vfs_bufs[fd] != NULL) {
+        return _buf_read(filp, _vfs_bufs[fd], dest, count);
+    }
+#endif
     return filp->f_op->read(filp, dest, count);
 }
 
@@ -331,9 +481,191 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
+#if IS_USED(MODULE_VFS_BUFFERED)
+    if (_vfs_bufs[fd] != NULL) {
+        return _buf_write(filp, _vfs_bufs[fd], src, count);
+    }
+#endif
     return filp->f_op->write(filp, src, count);
 }
 
+#if IS_USED(MODULE_VFS_BUFFERED)
+int vfs_buffer_attach(int fd, size_t size)
+{
+    DEBUG("vfs_buffer_attach: %d, %lu\n", fd, (unsigned long)size);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    if (size > CONFIG_VFS_BUFFER_SIZE) {
+        return -EINVAL;
+    }
+    mutex_lock(&_open_mutex);
+    if (_vfs_bufs[fd] != NULL) {
+        mutex_unlock(&_open_mutex);
+        return -EALREADY;
+    }
+    if (!_vfs_buf_pool_ready) {
+        memarray_init(&_vfs_buf_pool, _vfs_buf_storage, sizeof(_vfs_buf_t),
+                      CONFIG_VFS_BUFFER_NUMOF);
+        _vfs_buf_pool_ready = true;
+    }
+    _vfs_buf_t *buf = memarray_alloc(&_vfs_buf_pool);
+    if (buf != NULL) {
+        buf->size = (size > 0) ? size : CONFIG_VFS_BUFFER_SIZE;
+        buf->len = 0;
+        buf->idx = 0;
+        buf->dirty = false;
+        _vfs_bufs[fd] = buf;
+    }
+    mutex_unlock(&_open_mutex);
+    return (buf != NULL) ? 0 : -ENOMEM;
+}
+
+int vfs_buffer_detach(int fd)
+{
+    DEBUG("vfs_buffer_detach: %d\n", fd);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    res = _buf_sync(&_vfs_open_files[fd], _vfs_bufs[fd]);
+    if (res < 0) {
+        return res;
+    }
+    _buf_release(fd);
+    return 0;
+}
+
+int vfs_buffer_flush(int fd)
+{
+    DEBUG("vfs_buffer_flush: %d\n", fd);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    return _buf_sync(&_vfs_open_files[fd], _vfs_bufs[fd]);
+}
+
+static int _buf_flush(vfs_file_t *filp, _vfs_buf_t *buf)
+{
+    size_t done = 0;
+    int res = 0;
+    while (done < buf->len) {
+        ssize_t n = filp->f_op->write(filp, &buf->data[done], buf->len - done);
+        if (n <= 0) {
+            res = (n < 0) ? (int)n : -EIO;
+            break;
+        }
+        done += n;
+    }
+    /* keep whatever could not be written for the next attempt */
+    memmove(buf->data, &buf->data[done], buf->len - done);
+    buf->len -= done;
+    buf->dirty = (buf->len > 0);
+    return res;
+}
+
+static int _buf_sync(vfs_file_t *filp, _vfs_buf_t *buf)
+{
+    if (buf == NULL) {
+        return 0;
+    }
+    if (buf->dirty) {
+        return _buf_flush(filp, buf);
+    }
+    size_t ahead = buf->len - buf->idx;
+    buf->len = 0;
+    buf->idx = 0;
+    if (ahead > 0) {
+        /* the driver is ahead of the user by the unconsumed read-ahead */
+        off_t res = _lseek(filp, -(off_t)ahead, SEEK_CUR);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+static void _buf_release(int fd)
+{
+    mutex_lock(&_open_mutex);
+    if (_vfs_bufs[fd] != NULL) {
+        memarray_free(&_vfs_buf_pool, _vfs_bufs[fd]);
+        _vfs_bufs[fd] = NULL;
+    }
+    mutex_unlock(&_open_mutex);
+}
+
+static ssize_t _buf_read(vfs_file_t *filp, _vfs_buf_t *buf, void *dest, size_t count)
+{
+    if (buf->dirty) {
+        int res = _buf_flush(filp, buf);
+        if (res < 0) {
+            return res;
+        }
+    }
+    uint8_t *out = dest;
+    size_t done = 0;
+    while (done < count) {
+        size_t avail = buf->len - buf->idx;
+        if (avail > 0) {
+            size_t n = (count - done < avail) ? count - done : avail;
+            memcpy(&out[done], &buf->data[buf->idx], n);
+            buf->idx += n;
+            done += n;
+            continue;
+        }
+        ssize_t res;
+        if (count - done >= buf->size) {
+            /* large request, read directly into the destination */
+            res = filp->f_op->read(filp, &out[done], count - done);
+            if (res > 0) {
+                done += res;
+            }
+        }
+        else {
+            res = filp->f_op->read(filp, buf->data, buf->size);
+            if (res > 0) {
+                buf->len = res;
+                buf->idx = 0;
+                continue;
+            }
+        }
+        if (res <= 0 && done == 0) {
+            return res;
+        }
+        break;
+    }
+    return done;
+}
+
+static ssize_t _buf_write(vfs_file_t *filp, _vfs_buf_t *buf, const void *src, size_t count)
+{
+    if (!buf->dirty) {
+        /* drop read-ahead data before switching to writing */
+        int res = _buf_sync(filp, buf);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if (buf->len + count > buf->size) {
+        int res = _buf_flush(filp, buf);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if (count >= buf->size) {
+        /* large request, write directly from the source */
+        return filp->f_op->write(filp, src, count);
+    }
+    memcpy(&buf->data[buf->len], src, count);
+    buf->len += count;
+    buf->dirty = true;
+    return count;
+}
+#endif /* MODULE_VFS_BUFFERED */
+
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("vfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
@@ -878,15 +1210,19 @@ const vfs_file_t *vfs_file_get(int fd)
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
+        fd = VFS_MAX_OPEN_FILES;
+        for (unsigned i = 0; i < VFS_FD_WORDS; ++i) {
+            unsigned free_fds = ~_vfs_used_fds[i];
+            if (i == 0) {
                 /* Do not auto-allocate the stdio file descriptor numbers to
                  * avoid conflicts between normal file system users and stdio
                  * drivers such as stdio_uart, stdio_rtt which need to be able
                  * to bind to these specific file descriptor numbers. */
-                continue;
+                free_fds &= ~((1U << STDIN_FILENO) | (1U << STDOUT_FILENO) |
+                              (1U << STDERR_FILENO));
             }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
+            if (free_fds != 0) {
+                fd = i * VFS_FD_WORD_BITS + bitarithm_lsb(free_fds);
                 break;
             }
         }
@@ -899,6 +1235,7 @@ static inline int _allocate_fd(int fd)
         /* The desired fd is already in use */
         return -EEXIST;
     }
+    _vfs_used_fds[fd / VFS_FD_WORD_BITS] |= 1U << (fd % VFS_FD_WORD_BITS);
     kernel_pid_t pid = thread_getpid();
     if (pid == KERNEL_PID_UNDEF) {
         /* This happens when calling vfs_bind during boot, before threads have
@@ -915,7 +1252,13 @@ static inline void _free_fd(int fd)
     if (_vfs_open_files[fd].mp != NULL) {
         atomic_fetch_sub(&_vfs_open_files[fd].mp->open_files, 1);
     }
+#if IS_USED(MODULE_VFS_BUFFERED)
+    _buf_release(fd);
+#endif
+    mutex_lock(&_open_mutex);
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    _vfs_used_fds[fd / VFS_FD_WORD_BITS] &= ~(1U << (fd % VFS_FD_WORD_BITS));
+    mutex_unlock(&_open_mutex);
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -70,10 +70,18 @@ static uint32_t ztimer_convert_frac_op_now(ztimer_clock_t *z)
     return scaled;
 }
 
+static uint64_t ztimer_convert_frac_op_now64(ztimer_clock_t *z)
+{
+    ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
+
+    return frac_scale64(&self->scale_now, ztimer_now64(self->super.lower));
+}
+
 static const ztimer_ops_t ztimer_convert_frac_ops = {
     .set = ztimer_convert_frac_op_set,
     .now = ztimer_convert_frac_op_now,
     .cancel = ztimer_convert_cancel,
+    .now64 = ztimer_convert_frac_op_now64,
 };
 
 static void ztimer_convert_frac_compute_scale(ztimer_convert_frac_t *self,
@@ -94,10 +94,25 @@ static uint32_t _ztimer_convert_muldiv64_now(ztimer_clock_t *ztimer)
                                      ztimer_convert_muldiv64->super.lower));
 }
 
+static uint64_t _ztimer_convert_muldiv64_now64(ztimer_clock_t *ztimer)
+{
+    const ztimer_convert_muldiv64_t *ztimer_convert_muldiv64 =
+        (ztimer_convert_muldiv64_t *)ztimer;
+    uint64_t lower = ztimer_now64(ztimer_convert_muldiv64->super.lower);
+    uint64_t div = ztimer_convert_muldiv64->div > 1
+                   ? ztimer_convert_muldiv64->div : 1;
+    uint64_t mul = ztimer_convert_muldiv64->mul > 1
+                   ? ztimer_convert_muldiv64->mul : 1;
+
+    /* lower * div / mul, without overflowing */
+    return (lower / mul) * div + ((lower % mul) * div) / mul;
+}
+
 static const ztimer_ops_t _ztimer_convert_muldiv64_ops = {
     .set = _ztimer_convert_muldiv64_set,
     .now = _ztimer_convert_muldiv64_now,
     .cancel = ztimer_convert_cancel,
+    .now64 = _ztimer_convert_muldiv64_now64,
 };
 
 void ztimer_convert_muldiv64_init(
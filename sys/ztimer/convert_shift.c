@@ -74,10 +74,20 @@ static uint32_t _ztimer_convert_shift_up_now(ztimer_clock_t *ztimer)
                                  ztimer_now(ztimer_convert_shift->super.lower));
 }
 
+static uint64_t _ztimer_convert_shift_up_now64(ztimer_clock_t *ztimer)
+{
+    ztimer_convert_shift_t *ztimer_convert_shift =
+        (ztimer_convert_shift_t *)ztimer;
+
+    return ztimer_now64(ztimer_convert_shift->super.lower)
+           << ztimer_convert_shift->shift;
+}
+
 static const ztimer_ops_t _ztimer_convert_shift_ops_up = {
     .set = _ztimer_convert_shift_up_set,
     .now = _ztimer_convert_shift_up_now,
     .cancel = ztimer_convert_cancel,
+    .now64 = _ztimer_convert_shift_up_now64,
 };
 
 void ztimer_convert_shift_up_init(ztimer_convert_shift_t *clock,
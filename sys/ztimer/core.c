@@ -41,11 +41,28 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 
-#ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
     return a < b ? a : b;
 }
+
+/* ztimer_now64() tracks the wraps of ztimer_now() of the clock */
+static inline unsigned _now64_tracked(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_NOW64
+    (void)clock;
+    return 0;
+#else
+    return clock->now64_used;
+#endif
+}
+
+#if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64
+/* the clock is set at most half its range ahead to be observed in time */
+static inline unsigned _is_extended(const ztimer_clock_t *clock)
+{
+    return (clock->max_value < UINT32_MAX) || _now64_tracked(clock);
+}
 #endif
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
@@ -81,10 +98,34 @@ void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     irq_restore(state);
 }
 
+/* finds the target in [val, val + slack] of the first timer set in it, or
+ * the end of it */
+static uint32_t _coalesce(const ztimer_clock_t *clock, uint32_t val,
+                          uint32_t slack)
+{
+    uint32_t latest = (val > UINT32_MAX - slack) ? UINT32_MAX : val + slack;
+    uint32_t target = 0;
+
+    for (ztimer_base_t *entry = clock->list.next; entry; entry = entry->next) {
+        target += entry->offset;
+        if (target >= val) {
+            return _min_u32(target, latest);
+        }
+    }
+    return latest;
+}
+
 void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 {
-    DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32 "\n",
-          (void *)clock, (void *)timer, clock->ops->now(clock), val);
+    ztimer_set_with_slack(clock, timer, val, 0);
+}
+
+void ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                           uint32_t val, uint32_t slack)
+{
+    DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32
+          " slack %" PRIu32 "\n",
+          (void *)clock, (void *)timer, clock->ops->now(clock), val, slack);
 
     unsigned state = irq_disable();
 
@@ -101,11 +142,16 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+    if (slack) {
+        val = _coalesce(clock, val, slack);
+    }
+
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    /* ztimer_handler() sets the clock once all timers due are fired */
+    if ((clock->list.next == &timer->base) && !clock->in_handler) {
 #ifdef MODULE_ZTIMER_EXTEND
-        if (clock->max_value < UINT32_MAX) {
+        if (_is_extended(clock)) {
             val = _min_u32(val, clock->max_value >> 1);
         }
         DEBUG("ztimer_set(): %p setting %" PRIu32 "\n", (void *)clock, val);
@@ -186,16 +232,13 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
 }
 #endif /* MODULE_ZTIMER_EXTEND */
 
-void ztimer_update_head_offset(ztimer_clock_t *clock)
+/* moves the timers of clock closer to expiry by diff ticks */
+static void _advance_head(ztimer_clock_t *clock, uint32_t diff)
 {
-    uint32_t old_base = clock->list.offset;
-    uint32_t now = ztimer_now(clock);
-    uint32_t diff = now - old_base;
-
     ztimer_base_t *entry = clock->list.next;
 
     DEBUG(
-        "clock %p: ztimer_update_head_offset(): diff=%" PRIu32 " old head %p\n",
+        "clock %p: _advance_head(): diff=%" PRIu32 " old head %p\n",
         (void *)clock, diff, (void *)entry);
     if (entry) {
         do {
@@ -214,9 +257,8 @@ void ztimer_update_head_offset(ztimer_clock_t *clock)
                 }
             }
         } while (diff && entry);
-        DEBUG(
-            "ztimer %p: ztimer_update_head_offset(): now=%" PRIu32 " new head %p",
-            (void *)clock, now, (void *)entry);
+        DEBUG("clock %p: _advance_head(): new head %p", (void *)clock,
+              (void *)entry);
         if (entry) {
             DEBUG(" offset %" PRIu32 "\n", entry->offset);
         }
@@ -224,10 +266,90 @@ void ztimer_update_head_offset(ztimer_clock_t *clock)
             DEBUG("\n");
         }
     }
+}
+
+#if !MODULE_ZTIMER_NOW64
+/* counts the wraps of ztimer_now(), must be called at least once per wrap */
+static uint64_t _now64_observe(ztimer_clock_t *clock, uint32_t now)
+{
+    if (now < clock->now64_last) {
+        clock->now64_hi++;
+    }
+    clock->now64_last = now;
+    return ((uint64_t)clock->now64_hi << 32) | now;
+}
+#endif
+
+uint64_t ztimer_now64(ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_NOW64
+    return ztimer_now(clock);
+#else
+    if (clock->ops->now64) {
+        return clock->ops->now64(clock);
+    }
+
+    unsigned state = irq_disable();
+    uint64_t now = _now64_observe(clock, ztimer_now(clock));
+
+    if (!clock->now64_used) {
+        clock->now64_used = 1;
+        /* keeps the clock set to observe it at least every half wrap */
+        if (clock->list.next) {
+            ztimer_update_head_offset(clock);
+        }
+        _ztimer_update(clock);
+    }
 
+    irq_restore(state);
+    return now;
+#endif
+}
+
+void ztimer_update_head_offset(ztimer_clock_t *clock)
+{
+    uint32_t old_base = clock->list.offset;
+    uint32_t now = ztimer_now(clock);
+
+#if !MODULE_ZTIMER_NOW64
+    if (clock->now64_used) {
+        _now64_observe(clock, now);
+    }
+#endif
+
+    DEBUG("clock %p: ztimer_update_head_offset(): now=%" PRIu32 "\n",
+          (void *)clock, now);
+    _advance_head(clock, now - old_base);
     clock->list.offset = now;
 }
 
+uint32_t ztimer_until_next(ztimer_clock_t *clock)
+{
+    uint32_t res = UINT32_MAX;
+    unsigned state = irq_disable();
+
+    if (clock->list.next) {
+        ztimer_update_head_offset(clock);
+        res = clock->list.next->offset;
+    }
+
+    irq_restore(state);
+    return res;
+}
+
+void ztimer_advance(ztimer_clock_t *clock, uint32_t ticks)
+{
+    unsigned state = irq_disable();
+
+    if (clock->list.next) {
+        ztimer_update_head_offset(clock);
+        _advance_head(clock, ticks);
+        _ztimer_update(clock);
+    }
+
+    irq_restore(state);
+}
+
 static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     DEBUG("_del_entry_from_list()\n");
@@ -294,8 +416,13 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    if (clock->in_handler) {
+        /* ztimer_handler() updates the clock once it is done */
+        return;
+    }
+
 #ifdef MODULE_ZTIMER_EXTEND
-    if (clock->max_value < UINT32_MAX) {
+    if (_is_extended(clock)) {
         if (clock->list.next) {
             clock->ops->set(clock,
                             _min_u32(clock->list.next->offset,
@@ -332,8 +459,18 @@ void ztimer_handler(ztimer_clock_t *clock)
         _ztimer_print(clock);
     }
 
+#ifdef MODULE_ZTIMER_STATS
+    clock->stats.irqs++;
+#endif
+
+#if !MODULE_ZTIMER_NOW64
+    if (clock->now64_used) {
+        _now64_observe(clock, ztimer_now(clock));
+    }
+#endif
+
 #if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64
-    if (IS_USED(MODULE_ZTIMER_NOW64) || clock->max_value < UINT32_MAX) {
+    if (IS_USED(MODULE_ZTIMER_NOW64) || _is_extended(clock)) {
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
 
@@ -365,10 +502,20 @@ void ztimer_handler(ztimer_clock_t *clock)
     clock->list.offset += clock->list.next->offset;
     clock->list.next->offset = 0;
 
+#ifdef MODULE_ZTIMER_STATS
+    clock->stats.wakeups++;
+#endif
+
+    /* fire all timers due before setting the clock once */
+    clock->in_handler = 1;
+
     ztimer_t *entry = _now_next(clock);
     while (entry) {
         DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
               (void *)entry, (void *)entry->base.next, clock->ops->now(clock));
+#ifdef MODULE_ZTIMER_STATS
+        clock->stats.fired++;
+#endif
         entry->callback(entry->arg);
         entry = _now_next(clock);
         if (!entry) {
@@ -379,6 +526,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         }
     }
 
+    clock->in_handler = 0;
     _ztimer_update(clock);
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
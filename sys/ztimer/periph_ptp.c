@@ -52,10 +52,17 @@ static void _ztimer_periph_ptp_cancel(ztimer_clock_t *clock)
     ptp_timer_clear();
 }
 
+static uint64_t _ztimer_periph_ptp_now64(ztimer_clock_t *clock)
+{
+    (void)clock;
+    return ptp_clock_read_u64();
+}
+
 static const ztimer_ops_t _ztimer_periph_ptp_ops = {
     .set = _ztimer_periph_ptp_set,
     .now = _ztimer_periph_ptp_now,
     .cancel = _ztimer_periph_ptp_cancel,
+    .now64 = _ztimer_periph_ptp_now64,
 };
 
 void ztimer_periph_ptp_init(ztimer_periph_ptp_t *clock)
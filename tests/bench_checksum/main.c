@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the checksum algorithms
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "checksum/crc8.h"
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc32.h"
+#include "checksum/fletcher16.h"
+#include "checksum/fletcher32.h"
+#include "checksum/ucrc16.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS    (100U)
+#endif
+
+#define BUF_SIZE        (1024U)
+
+/* 16 bit aligned for fletcher32 */
+static uint16_t _buf[BUF_SIZE / 2];
+
+static const uint16_t _sizes[] = { 16, 64, 256, BUF_SIZE };
+
+static uint32_t _crc8(const uint8_t *buf, size_t len)
+{
+    return crc8(buf, len, 0x31, 0xff);
+}
+
+static uint32_t _ucrc16(const uint8_t *buf, size_t len)
+{
+    return ucrc16_calc_be(buf, len, UCRC16_CCITT_POLY_BE, 0x1d0f);
+}
+
+static uint32_t _crc16_ccitt(const uint8_t *buf, size_t len)
+{
+    return crc16_ccitt_calc(buf, len);
+}
+
+static uint32_t _crc32_ieee(const uint8_t *buf, size_t len)
+{
+    return crc32_ieee_calc(buf, len);
+}
+
+static uint32_t _crc32c(const uint8_t *buf, size_t len)
+{
+    return crc32c_calc(buf, len);
+}
+
+static uint32_t _fletcher16(const uint8_t *buf, size_t len)
+{
+    return fletcher16(buf, len);
+}
+
+static uint32_t _fletcher32(const uint8_t *buf, size_t len)
+{
+    return fletcher32((const uint16_t *)buf, len / 2);
+}
+
+static const struct {
+    const char *name;
+    uint32_t (*func)(const uint8_t *, size_t);
+} _algos[] = {
+    { "crc8", _crc8 },
+    { "ucrc16", _ucrc16 },
+    { "crc16_ccitt", _crc16_ccitt },
+    { "crc32_ieee", _crc32_ieee },
+    { "crc32c", _crc32c },
+    { "fletcher16", _fletcher16 },
+    { "fletcher32", _fletcher32 },
+};
+
+static void _run(unsigned algo, size_t len)
+{
+    volatile uint32_t sum = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        sum = _algos[algo].func((const uint8_t *)_buf, len);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+    (void)sum;
+
+    /* bytes per microsecond equals MB/s */
+    uint32_t kbps = (uint64_t)len * BENCH_ROUNDS * 1000 / (elapsed ? elapsed : 1);
+    printf("%-11s %4u B: %6" PRIu32 " us, %4" PRIu32 ".%03" PRIu32 " MB/s\n",
+           _algos[algo].name, (unsigned)len, elapsed, kbps / 1000, kbps % 1000);
+}
+
+int main(void)
+{
+    uint8_t *buf = (uint8_t *)_buf;
+
+    for (unsigned i = 0; i < BUF_SIZE; i++) {
+        buf[i] = i * 7 + 3;
+    }
+
+    printf("CRC slices: %u (CRC-16), %u (CRC-32)\n",
+           CONFIG_CRC16_CCITT_SLICES, CONFIG_CRC32_SLICES);
+    for (unsigned i = 0; i < ARRAY_SIZE(_algos); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(_sizes); j++) {
+            _run(i, _sizes[j]);
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"CRC slices: \d+ \(CRC-16\), \d+ \(CRC-32\)")
+    for _ in range(7 * 4):
+        child.expect(r"\w+ +\d+ B: +\d+ us, +\d+\.\d+ MB/s")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
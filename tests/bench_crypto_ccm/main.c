@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for AES-CTR and AES-CCM
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto/ciphers.h"
+#include "crypto/helper.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS    (100U)
+#endif
+
+#define BUF_SIZE        (1024U)
+#define MAC_LEN         (8U)
+#define ADATA_LEN       (16U)
+
+static uint8_t _buf[BUF_SIZE];
+static uint8_t _out[BUF_SIZE + MAC_LEN];
+static uint8_t _ref[BUF_SIZE + MAC_LEN];
+
+static const uint8_t _key[16] = {
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+};
+static const uint8_t _nonce[13] = {
+    0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0,
+    0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+};
+
+/* 802.15.4 frame payload, IPv6 minimum MTU and a DTLS record */
+static const uint16_t _sizes[] = { 16, 127, 1024 };
+
+static cipher_t _cipher;
+
+/* counter mode with one cipher call per block as baseline */
+static void _ctr_per_block(const uint8_t *input, size_t len, uint8_t *output)
+{
+    uint8_t ctr[16] = { 0 };
+    uint8_t stream[16];
+
+    memcpy(ctr, _nonce, sizeof(_nonce));
+    for (size_t off = 0; off < len; off += sizeof(stream)) {
+        cipher_encrypt(&_cipher, ctr, stream);
+        crypto_block_inc_ctr(ctr, 3);
+        for (size_t i = 0; i < sizeof(stream) && off + i < len; i++) {
+            output[off + i] = input[off + i] ^ stream[i];
+        }
+    }
+}
+
+static void _ctr(const uint8_t *input, size_t len, uint8_t *output)
+{
+    uint8_t ctr[16] = { 0 };
+
+    memcpy(ctr, _nonce, sizeof(_nonce));
+    cipher_encrypt_ctr(&_cipher, ctr, sizeof(_nonce), input, len, output);
+}
+
+static void _ccm(const uint8_t *input, size_t len, uint8_t *output)
+{
+    cipher_encrypt_ccm(&_cipher, _buf, ADATA_LEN, MAC_LEN, 2,
+                       _nonce, sizeof(_nonce), input, len, output);
+}
+
+/* the same, passing the payload in chunks of 16 bytes */
+static void _ccm_incremental(const uint8_t *input, size_t len,
+                             uint8_t *output)
+{
+    cipher_ccm_ctx_t ctx;
+
+    cipher_ccm_init(&ctx, &_cipher, MAC_LEN, 2, _nonce, sizeof(_nonce),
+                    ADATA_LEN, len);
+    cipher_ccm_update_adata(&ctx, _buf, ADATA_LEN);
+    for (size_t off = 0; off < len; off += 16) {
+        size_t n = (len - off < 16) ? len - off : 16;
+        cipher_ccm_encrypt_update(&ctx, input + off, n, output + off);
+    }
+    cipher_ccm_encrypt_finish(&ctx, output + len);
+}
+
+static void _run(const char *name, void (*func)(const uint8_t *, size_t, uint8_t *),
+                 size_t len)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        func(_buf, len, _out);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%-15s %4u B: %7" PRIu32 " us, %5" PRIu32 " ns/B\n", name,
+           (unsigned)len, elapsed,
+           (uint32_t)((uint64_t)elapsed * 1000 / (len * BENCH_ROUNDS)));
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7 + 3;
+    }
+    cipher_init(&_cipher, CIPHER_AES_128, _key, sizeof(_key));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        size_t len = _sizes[i];
+
+        _run("ctr per block", _ctr_per_block, len);
+        memcpy(_ref, _out, len);
+        _run("ctr", _ctr, len);
+        if (memcmp(_ref, _out, len)) {
+            puts("ctr mismatch");
+            return 1;
+        }
+
+        _run("ccm", _ccm, len);
+        memcpy(_ref, _out, len + MAC_LEN);
+        _run("ccm incremental", _ccm_incremental, len);
+        if (memcmp(_ref, _out, len + MAC_LEN)) {
+            puts("ccm mismatch");
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for ChaCha20-Poly1305
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto/chacha20poly1305.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS    (100U)
+#endif
+
+#define BUF_SIZE        (1024U)
+#define AAD_LEN         (16U)
+#define CHUNK_LEN       (16U)
+
+static uint8_t _buf[BUF_SIZE];
+static uint8_t _out[BUF_SIZE + CHACHA20POLY1305_TAG_BYTES];
+static uint8_t _ref[BUF_SIZE + CHACHA20POLY1305_TAG_BYTES];
+
+static const uint8_t _key[CHACHA20POLY1305_KEY_BYTES] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+};
+static const uint8_t _nonce[CHACHA20POLY1305_NONCE_BYTES] = {
+    0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47,
+};
+
+/* 802.15.4 frame payload, IPv6 minimum MTU and a DTLS record */
+static const uint16_t _sizes[] = { 16, 127, 1024 };
+
+static void _encrypt(const uint8_t *input, size_t len, uint8_t *output)
+{
+    chacha20poly1305_encrypt(output, input, len, _buf, AAD_LEN, _key, _nonce);
+}
+
+/* the same, passing the payload in small chunks */
+static void _encrypt_incremental(const uint8_t *input, size_t len,
+                                 uint8_t *output)
+{
+    chacha20poly1305_stream_ctx_t ctx;
+
+    chacha20poly1305_init(&ctx, _key, _nonce);
+    chacha20poly1305_update_aad(&ctx, _buf, AAD_LEN);
+    for (size_t off = 0; off < len; off += CHUNK_LEN) {
+        size_t n = (len - off < CHUNK_LEN) ? len - off : CHUNK_LEN;
+        chacha20poly1305_encrypt_update(&ctx, input + off, output + off, n);
+    }
+    chacha20poly1305_encrypt_finish(&ctx, output + len);
+}
+
+static void _decrypt(const uint8_t *input, size_t len, uint8_t *output)
+{
+    size_t msglen;
+
+    (void)input;
+    if (!chacha20poly1305_decrypt(_ref, len + CHACHA20POLY1305_TAG_BYTES,
+                                  output, &msglen, _buf, AAD_LEN,
+                                  _key, _nonce)) {
+        puts("decryption failed");
+    }
+}
+
+static void _run(const char *name, void (*func)(const uint8_t *, size_t, uint8_t *),
+                 size_t len)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        func(_buf, len, _out);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+
+    /* bytes per microsecond equals MB/s, printed with two decimals */
+    uint32_t rate = elapsed ? (uint64_t)len * BENCH_ROUNDS * 100 / elapsed : 0;
+    printf("%-11s %4u B: %7" PRIu32 " us, %4" PRIu32 ".%02" PRIu32 " MB/s\n",
+           name, (unsigned)len, elapsed, rate / 100, rate % 100);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7 + 3;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        size_t len = _sizes[i];
+
+        _run("encrypt", _encrypt, len);
+        memcpy(_ref, _out, len + CHACHA20POLY1305_TAG_BYTES);
+        _run("incremental", _encrypt_incremental, len);
+        if (memcmp(_ref, _out, len + CHACHA20POLY1305_TAG_BYTES)) {
+            puts("incremental mismatch");
+            return 1;
+        }
+        _run("decrypt", _decrypt, len);
+        if (memcmp(_buf, _out, len)) {
+            puts("decrypt mismatch");
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Per packet cost of UDP checksums with and without offloading
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/udp.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS    (1000U)
+#endif
+
+static const uint16_t _sizes[] = { 8, 64, 256, 1232 };
+
+static const ipv6_addr_t _src = { .u8 = {
+    0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 } };
+static const ipv6_addr_t _dst = { .u8 = {
+    0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02 } };
+
+static gnrc_pktsnip_t *_build(uint16_t payload_len)
+{
+    gnrc_pktsnip_t *payload, *udp, *ipv6, *netif;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, payload_len, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return NULL;
+    }
+    memset(payload->data, 0x5a, payload_len);
+    udp = gnrc_udp_hdr_build(payload, 0xf0b0, 0xf0b1);
+    if (udp == NULL) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    ipv6 = gnrc_ipv6_hdr_build(udp, &_src, &_dst);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(udp);
+        return NULL;
+    }
+    ((ipv6_hdr_t *)ipv6->data)->len = byteorder_htons(gnrc_pkt_len(udp));
+    ((ipv6_hdr_t *)ipv6->data)->nh = PROTNUM_UDP;
+
+    /* received packets carry the interface header at the end */
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->flags |= GNRC_NETIF_HDR_FLAGS_CSUM_VALID;
+    gnrc_pkt_append(ipv6, netif);
+    return ipv6;
+}
+
+static uint32_t _ns_per_pkt(uint32_t start)
+{
+    return (uint64_t)(ztimer_now(ZTIMER_USEC) - start) * 1000 / BENCH_ROUNDS;
+}
+
+static int _run(uint16_t payload_len)
+{
+    gnrc_pktsnip_t *ipv6 = _build(payload_len);
+    uint32_t start, sw, tx, rx;
+    unsigned valid = 0;
+
+    if (ipv6 == NULL) {
+        puts("unable to allocate packet");
+        return -1;
+    }
+    gnrc_pktsnip_t *udp = ipv6->next;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        gnrc_netreg_clear_csum(udp);
+        gnrc_netreg_calc_csum(udp, ipv6);
+    }
+    sw = _ns_per_pkt(start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        gnrc_netreg_clear_csum(udp);
+    }
+    tx = _ns_per_pkt(start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        valid += gnrc_netif_hdr_csum_valid(ipv6);
+    }
+    rx = _ns_per_pkt(start);
+
+    printf("%4u B: sw %7" PRIu32 " ns, tx offload %5" PRIu32 " ns, "
+           "rx offload %5" PRIu32 " ns\n",
+           (unsigned)gnrc_pkt_len(udp), sw, tx, rx);
+    gnrc_pktbuf_release(ipv6);
+
+    return (valid == BENCH_ROUNDS) ? 0 : -1;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        if (_run(_sizes[i]) < 0) {
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the latency of control traffic in the send queue
+ *              of a network interface under bulk load
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+
+/* simulated air time of a frame */
+#define FRAME_US            (2000U)
+/* bulk packets sent every BURST_US, more than the link can carry */
+#define BURST_LEN           (4U)
+#define BURST_US            (6000U)
+#define BURSTS              (100U)
+/* a control packet is sent every CONTROL_EVERY bursts */
+#define CONTROL_EVERY       (4U)
+#define BULK_PAYLOAD_LEN    (80U)
+#define CONTROL_PAYLOAD_LEN (16U)
+
+enum {
+    CONTROL = 0,
+    BULK,
+    CLASS_NUMOF,
+};
+
+typedef struct {
+    unsigned sent;
+    unsigned received;
+    uint32_t latency_sum;
+    uint32_t latency_max;
+} _stats_t;
+
+static const char *_names[] = { "control", "bulk" };
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static ztimer_t _tx_timer;
+static volatile bool _busy;
+static _stats_t _stats[CLASS_NUMOF];
+
+static void _tx_done(void *arg)
+{
+    (void)arg;
+    _busy = false;
+    netdev_trigger_event_isr(&_dev.netdev);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_TX_COMPLETE);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    const ipv6_hdr_t *hdr = iolist->iol_base;
+    const iolist_t *payload = iolist->iol_next;
+    _stats_t *stats;
+    uint32_t sent_at;
+    uint32_t latency;
+
+    if (_busy) {
+        return -EBUSY;
+    }
+    _busy = true;
+    ztimer_set(ZTIMER_USEC, &_tx_timer, FRAME_US);
+
+    expect(payload != NULL);
+    expect(payload->iol_len >= sizeof(sent_at));
+    stats = &_stats[(hdr->nh == PROTNUM_ICMPV6) ? CONTROL : BULK];
+    memcpy(&sent_at, payload->iol_base, sizeof(sent_at));
+    latency = ztimer_now(ZTIMER_USEC) - sent_at;
+    stats->received++;
+    stats->latency_sum += latency;
+    if (latency > stats->latency_max) {
+        stats->latency_max = latency;
+    }
+    return iolist_size(iolist);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_TEST;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = 127U;
+    return sizeof(uint16_t);
+}
+
+static void _send_pkt(unsigned cls, uint32_t fl)
+{
+    static const uint8_t dst[] = { 0x00, 0x02 };
+    size_t payload_len = (cls == CONTROL) ? CONTROL_PAYLOAD_LEN
+                                          : BULK_PAYLOAD_LEN;
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, NULL, payload_len,
+                                              GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t),
+                                           GNRC_NETTYPE_IPV6);
+    gnrc_pktsnip_t *netif_hdr = gnrc_netif_hdr_build(NULL, 0, dst,
+                                                     sizeof(dst));
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    ipv6_hdr_t *hdr;
+
+    _stats[cls].sent++;
+    if ((payload == NULL) || (ipv6 == NULL) || (netif_hdr == NULL)) {
+        gnrc_pktbuf_release(ipv6 ? ipv6 : payload);
+        gnrc_pktbuf_release(netif_hdr);
+        return;
+    }
+    memset(payload->data, 0, payload_len);
+    memcpy(payload->data, &now, sizeof(now));
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(*hdr));
+    ipv6_hdr_set_version(hdr);
+    ipv6_hdr_set_fl(hdr, fl);
+    hdr->nh = (cls == CONTROL) ? PROTNUM_ICMPV6 : PROTNUM_UDP;
+    hdr->len = byteorder_htons(payload_len);
+    hdr->hl = 64;
+    ipv6 = gnrc_pkt_prepend(ipv6, netif_hdr);
+    if (gnrc_netapi_send(_netif.pid, ipv6) < 1) {
+        gnrc_pktbuf_release(ipv6);
+    }
+}
+
+int main(void)
+{
+    netstats_queue_t *queue = &_netif.send_queue.stats;
+
+    _tx_timer.callback = _tx_done;
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    expect(gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                 NETIF_PRIO, "bench", &_dev.netdev) == 0);
+
+    printf("fair queueing: %s\n",
+           IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) ? "yes" : "no");
+    for (unsigned i = 0; i < BURSTS; i++) {
+        /* two bulk flows, distinguished by flow label */
+        for (unsigned j = 0; j < BURST_LEN; j++) {
+            _send_pkt(BULK, 1 + (j & 1));
+        }
+        if ((i % CONTROL_EVERY) == 0) {
+            _send_pkt(CONTROL, 0);
+        }
+        ztimer_sleep(ZTIMER_USEC, BURST_US);
+    }
+    /* let the queue drain */
+    ztimer_sleep(ZTIMER_USEC, CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE * FRAME_US * 2);
+
+    for (unsigned i = 0; i < CLASS_NUMOF; i++) {
+        _stats_t *stats = &_stats[i];
+
+        printf("%-8s sent %4u received %4u latency avg %6lu us max %6lu us\n",
+               _names[i], stats->sent, stats->received,
+               (unsigned long)(stats->received ? stats->latency_sum / stats->received
+                                               : 0),
+               (unsigned long)stats->latency_max);
+    }
+    printf("queue    queued %4lu dropped %4lu depth max %u\n",
+           (unsigned long)queue->queued, (unsigned long)queue->dropped,
+           queue->depth_max);
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    for (unsigned i = 0; i < GNRC_NETIF_PKTQ_FQ_CLASS_NUMOF; i++) {
+        gnrc_netif_pktq_fq_stats_t *sojourn = &_netif.send_queue.fq.stats[i];
+
+        printf("%-8s queued %4lu sojourn avg %6lu us max %6lu us\n",
+               _names[i], (unsigned long)sojourn->packets,
+               (unsigned long)(sojourn->packets
+                               ? sojourn->sojourn_sum / sojourn->packets : 0),
+               (unsigned long)sojourn->sojourn_max);
+    }
+#endif
+    expect(_stats[CONTROL].received > 0);
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"fair queueing: (yes|no)")
+    fq = child.match.group(1) == "yes"
+    for name in ("control", "bulk"):
+        child.expect(name + r" +sent +\d+ received +\d+ latency avg +\d+ us "
+                     r"max +\d+ us")
+    child.expect(r"queue +queued +\d+ dropped +\d+ depth max \d+")
+    if fq:
+        for name in ("control", "bulk"):
+            child.expect(name + r" +queued +\d+ sojourn avg +\d+ us "
+                         r"max +\d+ us")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=30))
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for SHA-256 and HMAC-SHA-256
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "hashes/sha256.h"
+#include "macros/units.h"
+#include "periph_conf.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS    (100U)
+#endif
+
+#define BUF_SIZE        (1024U)
+#define MULTI_NUMOF     (4U)
+
+static uint8_t _buf[MULTI_NUMOF][BUF_SIZE];
+static uint8_t _digest[MULTI_NUMOF][SHA256_DIGEST_LENGTH];
+
+static const uint16_t _sizes[] = { 64, 256, BUF_SIZE };
+
+static void _print(const char *name, size_t len, uint32_t elapsed)
+{
+    uint32_t bytes = len * BENCH_ROUNDS;
+
+    printf("%-11s %4u B: %7" PRIu32 " us, %5" PRIu32 " ns/B",
+           name, (unsigned)len, elapsed,
+           (uint32_t)((uint64_t)elapsed * 1000 / bytes));
+#ifdef CLOCK_CORECLOCK
+    printf(", %4" PRIu32 " cycles/B",
+           (uint32_t)((uint64_t)elapsed * (CLOCK_CORECLOCK / MHZ(1)) / bytes));
+#endif
+    puts("");
+}
+
+static void _bench_sha256(size_t len)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        sha256(_buf[0], len, _digest[0]);
+    }
+    _print("sha256", len, ztimer_now(ZTIMER_USEC) - start);
+}
+
+static void _bench_sha256_multi(size_t len)
+{
+    const void *data[MULTI_NUMOF];
+    void *digest[MULTI_NUMOF];
+
+    for (unsigned i = 0; i < MULTI_NUMOF; i++) {
+        data[i] = _buf[i];
+        digest[i] = _digest[i];
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        sha256_multi(data, len, digest, MULTI_NUMOF);
+    }
+    _print("sha256_multi", len * MULTI_NUMOF, ztimer_now(ZTIMER_USEC) - start);
+}
+
+static void _bench_hmac_sha256(size_t len)
+{
+    static const uint8_t key[] = "benchmark key";
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        hmac_sha256(key, sizeof(key), _buf[0], len, _digest[0]);
+    }
+    _print("hmac_sha256", len, ztimer_now(ZTIMER_USEC) - start);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i / BUF_SIZE][i % BUF_SIZE] = i * 7 + 3;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        _bench_sha256(_sizes[i]);
+        _bench_sha256_multi(_sizes[i]);
+        _bench_hmac_sha256(_sizes[i]);
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for back to back transmission of the SubMAC
+ *
+ * A mock radio reports the end of each transmission after a fixed air time.
+ * The gap between the end of a transmission and the start of the next one
+ * is measured with the upper layer handing over one frame per TX done event,
+ * and with the upper layer keeping the SubMAC transmission queue filled.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/ieee802154.h"
+#include "net/ieee802154/submac.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define FRAMES          (12U)   /* fragments of an IPv6 packet of 1280 bytes */
+#define FRAME_LEN       (100U)
+#define AIRTIME_US      (1000U)
+
+#define MSG_TYPE_SEND       (0x4201)
+#define MSG_TYPE_TX_DONE    (0x4202)
+#define MSG_TYPE_CONFIRM    (0x4203)
+
+#define MAC_QUEUE_SIZE  (16U)
+
+static ieee802154_submac_t _submac;
+static ieee802154_dev_t _dev;
+
+static char _mac_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _mac_queue[MAC_QUEUE_SIZE];
+static msg_t _main_queue[MAC_QUEUE_SIZE];
+static kernel_pid_t _mac_pid;
+static kernel_pid_t _main_pid;
+
+static uint8_t _frames[FRAMES][FRAME_LEN];
+
+/* mock radio state */
+static uint8_t _fb[IEEE802154_FRAME_LEN_MAX];
+static ztimer_t _tx_timer;
+static uint8_t _tx_log[FRAMES];
+static unsigned _tx_count;
+static uint32_t _tx_end;
+static uint32_t _gap_sum;
+static bool _trx_requested;
+static unsigned _trx_unrequested;
+
+static void _tx_timer_cb(void *arg)
+{
+    (void)arg;
+    msg_t m = { .type = MSG_TYPE_TX_DONE };
+
+    _tx_end = ztimer_now(ZTIMER_USEC);
+    msg_send_int(&m, _mac_pid);
+}
+
+static int _write(ieee802154_dev_t *dev, const iolist_t *psdu)
+{
+    (void)dev;
+    uint8_t *pos = _fb;
+
+    for (; psdu; psdu = psdu->iol_next) {
+        memcpy(pos, psdu->iol_base, psdu->iol_len);
+        pos += psdu->iol_len;
+    }
+    return 0;
+}
+
+static int _request_transmit(ieee802154_dev_t *dev)
+{
+    (void)dev;
+
+    if (_tx_count) {
+        _gap_sum += ztimer_now(ZTIMER_USEC) - _tx_end;
+    }
+    if (_tx_count < FRAMES) {
+        /* sequence number */
+        _tx_log[_tx_count] = _fb[2];
+    }
+    _tx_count++;
+    ztimer_set(ZTIMER_USEC, &_tx_timer, AIRTIME_US);
+    return 0;
+}
+
+static int _confirm_transmit(ieee802154_dev_t *dev, ieee802154_tx_info_t *info)
+{
+    (void)dev;
+    info->status = TX_STATUS_SUCCESS;
+    info->retrans = 0;
+    return 0;
+}
+
+static int _noop(ieee802154_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _len(ieee802154_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read(ieee802154_dev_t *dev, void *buf, size_t size,
+                 ieee802154_rx_info_t *info)
+{
+    (void)dev;
+    (void)buf;
+    (void)size;
+    (void)info;
+    return 0;
+}
+
+static int _set_trx_state(ieee802154_dev_t *dev, ieee802154_trx_state_t state)
+{
+    (void)dev;
+    (void)state;
+    _trx_requested = true;
+    return 0;
+}
+
+static int _confirm_set_trx_state(ieee802154_dev_t *dev)
+{
+    (void)dev;
+    /* a confirmation without request would wait for the wrong transition */
+    if (!_trx_requested) {
+        _trx_unrequested++;
+    }
+    _trx_requested = false;
+    return 0;
+}
+
+static int _set_cca_threshold(ieee802154_dev_t *dev, int8_t threshold)
+{
+    (void)dev;
+    (void)threshold;
+    return 0;
+}
+
+static int _config_phy(ieee802154_dev_t *dev, const ieee802154_phy_conf_t *conf)
+{
+    (void)dev;
+    (void)conf;
+    return 0;
+}
+
+static int _set_hw_addr_filter(ieee802154_dev_t *dev,
+                               const network_uint16_t *short_addr,
+                               const eui64_t *ext_addr,
+                               const uint16_t *pan_id)
+{
+    (void)dev;
+    (void)short_addr;
+    (void)ext_addr;
+    (void)pan_id;
+    return 0;
+}
+
+static int _set_rx_mode(ieee802154_dev_t *dev, ieee802154_rx_mode_t mode)
+{
+    (void)dev;
+    (void)mode;
+    return 0;
+}
+
+static const ieee802154_radio_ops_t _mock_ops = {
+    .caps = IEEE802154_CAP_24_GHZ
+          | IEEE802154_CAP_IRQ_TX_DONE
+          | IEEE802154_CAP_FRAME_RETRANS
+          | IEEE802154_CAP_AUTO_CSMA
+          | IEEE802154_CAP_PHY_OQPSK,
+    .write = _write,
+    .request_transmit = _request_transmit,
+    .confirm_transmit = _confirm_transmit,
+    .len = _len,
+    .read = _read,
+    .off = _noop,
+    .request_on = _noop,
+    .confirm_on = _noop,
+    .request_set_trx_state = _set_trx_state,
+    .confirm_set_trx_state = _confirm_set_trx_state,
+    .set_cca_threshold = _set_cca_threshold,
+    .config_phy = _config_phy,
+    .set_hw_addr_filter = _set_hw_addr_filter,
+    .set_rx_mode = _set_rx_mode,
+};
+
+void ieee802154_submac_ack_timer_set(ieee802154_submac_t *submac, uint16_t us)
+{
+    (void)submac;
+    (void)us;
+}
+
+void ieee802154_submac_ack_timer_cancel(ieee802154_submac_t *submac)
+{
+    (void)submac;
+}
+
+static void _tx_done(ieee802154_submac_t *submac, int status,
+                     ieee802154_tx_info_t *info)
+{
+    (void)submac;
+    (void)info;
+    msg_t m = { .type = MSG_TYPE_CONFIRM, .content.value = status };
+
+    msg_try_send(&m, _main_pid);
+}
+
+static void _rx_done(ieee802154_submac_t *submac)
+{
+    (void)submac;
+}
+
+static const ieee802154_submac_cb_t _submac_cb = {
+    .rx_done = _rx_done,
+    .tx_done = _tx_done,
+};
+
+/* plays the role of the network interface thread */
+static void *_mac_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    msg_init_queue(_mac_queue, MAC_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&m);
+        switch (m.type) {
+        case MSG_TYPE_SEND: {
+            iolist_t iol = {
+                .iol_base = _frames[m.content.value],
+                .iol_len = FRAME_LEN,
+            };
+            if (ieee802154_send(&_submac, &iol) < 0) {
+                puts("send failed");
+            }
+            break;
+        }
+        case MSG_TYPE_TX_DONE:
+            ieee802154_submac_tx_done_cb(&_submac);
+            break;
+        default:
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void _send(unsigned idx)
+{
+    msg_t m = { .type = MSG_TYPE_SEND, .content.value = idx };
+
+    msg_send(&m, _mac_pid);
+}
+
+static int _run(const char *name, unsigned window)
+{
+    msg_t m;
+    unsigned sent = 0;
+    unsigned outstanding = 0;
+
+    _tx_count = 0;
+    _gap_sum = 0;
+    memset(&_submac.stats, 0, sizeof(_submac.stats));
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned done = 0; done < FRAMES;) {
+        while (sent < FRAMES && outstanding < window) {
+            _send(sent++);
+            outstanding++;
+        }
+        msg_receive(&m);
+        if (m.type == MSG_TYPE_CONFIRM) {
+            if (m.content.value != TX_STATUS_SUCCESS) {
+                printf("%s: TX failed\n", name);
+                return 1;
+            }
+            outstanding--;
+            done++;
+        }
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+
+    if (_trx_unrequested) {
+        printf("%s: %u state changes confirmed without request\n", name,
+               _trx_unrequested);
+        return 1;
+    }
+
+    for (unsigned i = 0; i < FRAMES; i++) {
+        if (_tx_log[i] != i) {
+            printf("%s: frame %u sent at position %u\n", name, _tx_log[i], i);
+            return 1;
+        }
+    }
+
+    printf("%-10s %2u frames: %6" PRIu32 " us, gap %4" PRIu32 " us/frame, "
+           "queued %" PRIu32 ", back to back %" PRIu32 "\n",
+           name, FRAMES, elapsed, _gap_sum / (FRAMES - 1),
+           _submac.stats.tx_queued, _submac.stats.tx_back_to_back);
+    return 0;
+}
+
+int main(void)
+{
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_queue, MAC_QUEUE_SIZE);
+
+    for (unsigned i = 0; i < FRAMES; i++) {
+        memset(_frames[i], i, FRAME_LEN);
+        /* data frame without ACK request, sequence number i */
+        _frames[i][0] = IEEE802154_FCF_TYPE_DATA;
+        _frames[i][1] = 0;
+        _frames[i][2] = i;
+    }
+
+    _dev.driver = &_mock_ops;
+    _submac.dev = &_dev;
+    _submac.cb = &_submac_cb;
+    ieee802154_submac_init(&_submac, &(network_uint16_t){ .u16 = 0x1 },
+                           &(eui64_t){ .uint64.u64 = 0x1 });
+
+    _mac_pid = thread_create(_mac_stack, sizeof(_mac_stack),
+                             THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                             _mac_thread, NULL, "mac");
+
+    printf("TX queue size: %u\n", CONFIG_IEEE802154_SUBMAC_TXQ_SIZE);
+    if (_run("one by one", 1)) {
+        return 1;
+    }
+    if (_run("queued", CONFIG_IEEE802154_SUBMAC_TXQ_SIZE + 1)) {
+        return 1;
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the Internet checksum
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS    (1000U)
+#endif
+
+/* IPv6 minimum MTU */
+#define BUF_SIZE        (1280U)
+
+static uint8_t _buf[BUF_SIZE + 1];
+
+static const uint16_t _sizes[] = { 8, 64, 256, BUF_SIZE };
+
+/* byte-wise implementation as baseline */
+static uint16_t _bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1u); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint32_t _run(const char *name, uint16_t (*csum)(uint16_t, const uint8_t *, uint16_t),
+                     const uint8_t *buf, uint16_t len)
+{
+    uint16_t sum = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_ROUNDS; i++) {
+        sum = csum(sum, buf, len);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+
+    /* bytes per microsecond equals MB/s */
+    uint32_t kbps = (uint64_t)len * BENCH_ROUNDS * 1000 / (elapsed ? elapsed : 1);
+    printf("%s %4u B%s: %6" PRIu32 " us, %4" PRIu32 ".%03" PRIu32 " MB/s\n",
+           name, len, ((uintptr_t)buf & 1) ? " (unaligned)" : "", elapsed,
+           kbps / 1000, kbps % 1000);
+    return sum;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7 + 3;
+    }
+
+    for (unsigned offset = 0; offset < 2; offset++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+            const uint8_t *buf = _buf + offset;
+            uint16_t ref = _run("bytewise ", _bytewise, buf, _sizes[i]);
+            uint16_t res = _run("inet_csum", inet_csum, buf, _sizes[i]);
+            if (ref != res) {
+                printf("mismatch: 0x%04x != 0x%04x\n", res, ref);
+                return 1;
+            }
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark overlapping computation with MTD writes
+ *
+ * The flash is MTD_0 behind a wrapper that adds the busy time of a real
+ * flash to every erase and write. The blocking driver functions sleep for
+ * that time, the @ref mtd_desc_t::async hook starts a timer and completes
+ * the request from its callback, like a driver would from the ready
+ * interrupt of the flash.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "event.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BENCH_SECTORS
+#define BENCH_SECTORS       (16U)
+#endif
+
+#ifndef BENCH_WORK_ROUNDS
+#define BENCH_WORK_ROUNDS   (64U)
+#endif
+
+#ifndef BENCH_MAX_SECTOR_SIZE
+#define BENCH_MAX_SECTOR_SIZE   (4096U)
+#endif
+
+/* busy times of a typical SPI NOR flash */
+#ifndef BENCH_ERASE_US
+#define BENCH_ERASE_US      (45000U)    /**< erasing a sector */
+#endif
+
+#ifndef BENCH_PAGE_WRITE_US
+#define BENCH_PAGE_WRITE_US (700U)      /**< programming a page */
+#endif
+
+static char _flash_stack[THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _flash_queue;
+
+/* two buffers: one is being written while the next one is computed */
+static uint8_t _buf[2][BENCH_MAX_SECTOR_SIZE];
+
+static mtd_async_req_t _erase_req;
+static mtd_async_req_t _write_req;
+static mutex_t _write_done = MUTEX_INIT_LOCKED;
+static int _write_res;
+
+static mtd_dev_t *_parent;
+static ztimer_t _busy_timer;
+
+static uint32_t _write_time(mtd_dev_t *dev, uint32_t offset, uint32_t size)
+{
+    uint32_t pages = (offset % dev->page_size + size + dev->page_size - 1)
+                   / dev->page_size;
+    return pages * BENCH_PAGE_WRITE_US;
+}
+
+static int _slow_init(mtd_dev_t *dev)
+{
+    int res = mtd_init(_parent);
+    if (res < 0) {
+        return res;
+    }
+    dev->sector_count = _parent->sector_count;
+    dev->pages_per_sector = _parent->pages_per_sector;
+    dev->page_size = _parent->page_size;
+    return 0;
+}
+
+static int _slow_read_page(mtd_dev_t *dev, void *dest, uint32_t page,
+                           uint32_t offset, uint32_t size)
+{
+    (void)dev;
+    int res = mtd_read_page(_parent, dest, page, offset, size);
+    return (res < 0) ? res : (int)size;
+}
+
+static int _slow_write_page(mtd_dev_t *dev, const void *src, uint32_t page,
+                            uint32_t offset, uint32_t size)
+{
+    if (size > dev->page_size - offset) {
+        size = dev->page_size - offset;
+    }
+    int res = mtd_write_page_raw(_parent, src, page, offset, size);
+    if (res < 0) {
+        return res;
+    }
+    ztimer_sleep(ZTIMER_USEC, BENCH_PAGE_WRITE_US);
+    return size;
+}
+
+static int _slow_erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    (void)dev;
+    int res = mtd_erase_sector(_parent, sector, count);
+    if (res < 0) {
+        return res;
+    }
+    ztimer_sleep(ZTIMER_USEC, count * BENCH_ERASE_US);
+    return 0;
+}
+
+static int _slow_power(mtd_dev_t *dev, enum mtd_power_state power)
+{
+    (void)dev;
+    return mtd_power(_parent, power);
+}
+
+static void _busy_done(void *arg)
+{
+    mtd_async_complete(arg, 0);
+}
+
+static int _slow_async(mtd_dev_t *dev, mtd_async_req_t *req)
+{
+    uint32_t busy;
+    int res;
+
+    switch (req->op) {
+    case MTD_ASYNC_OP_WRITE:
+        res = mtd_write_page_raw(_parent, req->buf, req->page, req->offset,
+                                 req->size);
+        busy = _write_time(dev, req->offset, req->size);
+        break;
+    case MTD_ASYNC_OP_ERASE:
+        res = mtd_erase_sector(_parent, req->page, req->size);
+        busy = req->size * BENCH_ERASE_US;
+        break;
+    default:
+        return -ENOTSUP;
+    }
+    if (res < 0) {
+        return res;
+    }
+
+    /* the data is in place, the flash stays busy until the timer fires */
+    _busy_timer.callback = _busy_done;
+    _busy_timer.arg = req;
+    ztimer_set(ZTIMER_USEC, &_busy_timer, busy);
+    return 0;
+}
+
+static const mtd_desc_t _slow_driver = {
+    .init = _slow_init,
+    .read_page = _slow_read_page,
+    .write_page = _slow_write_page,
+    .erase_sector = _slow_erase_sector,
+    .power = _slow_power,
+    .async = _slow_async,
+};
+
+static mtd_dev_t _slow = {
+    .driver = &_slow_driver,
+};
+
+static void *_flash_thread(void *arg)
+{
+    (void)arg;
+    event_queue_init(&_flash_queue);
+    event_loop(&_flash_queue);
+    return NULL;
+}
+
+/* CPU bound workload producing the data of one sector */
+static uint32_t _work(uint8_t *buf, size_t len, uint32_t seed)
+{
+    uint32_t acc = seed;
+    for (unsigned round = 0; round < BENCH_WORK_ROUNDS; round++) {
+        for (size_t i = 0; i < len; i++) {
+            acc = (acc * 1103515245U) + 12345U + buf[i];
+            buf[i] = acc >> 24;
+        }
+    }
+    return acc;
+}
+
+static void _written(mtd_async_req_t *req, void *arg)
+{
+    (void)arg;
+    _write_res = req->res;
+    mutex_unlock(&_write_done);
+}
+
+static int _bench_blocking(mtd_dev_t *mtd, size_t sector_size)
+{
+    uint32_t acc = 0;
+    for (unsigned i = 0; i < BENCH_SECTORS; i++) {
+        acc = _work(_buf[0], sector_size, acc);
+        int res = mtd_erase_sector(mtd, i, 1);
+        if (res == 0) {
+            res = mtd_write_page_raw(mtd, _buf[0], i * mtd->pages_per_sector,
+                                     0, sector_size);
+        }
+        if (res < 0) {
+            printf("sector %u failed: %d\n", i, res);
+            return res;
+        }
+    }
+    return 0;
+}
+
+static int _bench_async(mtd_dev_t *mtd, size_t sector_size)
+{
+    uint32_t acc = 0;
+    bool pending = false;
+    for (unsigned i = 0; i < BENCH_SECTORS; i++) {
+        uint8_t *buf = _buf[i & 1];
+        acc = _work(buf, sector_size, acc);
+        if (pending) {
+            mutex_lock(&_write_done);
+            if (_write_res < 0) {
+                printf("sector %u failed: %d\n", i - 1, _write_res);
+                return _write_res;
+            }
+        }
+        mtd_async_erase_sector(&_erase_req, mtd, i, 1, NULL, NULL);
+        mtd_async_write_page(&_write_req, mtd, buf, i * mtd->pages_per_sector,
+                             0, sector_size, _written, NULL);
+        mtd_async_submit(&_flash_queue, &_erase_req);
+        mtd_async_submit(&_flash_queue, &_write_req);
+        pending = true;
+    }
+    if (pending) {
+        mutex_lock(&_write_done);
+    }
+    if (_erase_req.res < 0) {
+        return _erase_req.res;
+    }
+    return _write_res;
+}
+
+int main(void)
+{
+    mtd_dev_t *mtd = &_slow;
+
+    _parent = MTD_0;
+    if (mtd_init(mtd) < 0) {
+        puts("mtd_init failed");
+        return 1;
+    }
+    size_t sector_size = mtd->page_size * mtd->pages_per_sector;
+    if ((sector_size > BENCH_MAX_SECTOR_SIZE) ||
+        (mtd->sector_count < BENCH_SECTORS)) {
+        puts("MTD_0 geometry not supported");
+        return 1;
+    }
+
+    thread_create(_flash_stack, sizeof(_flash_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _flash_thread, NULL, "flash");
+
+    printf("%u sectors of %u B, %u work rounds per sector\n",
+           BENCH_SECTORS, (unsigned)sector_size, BENCH_WORK_ROUNDS);
+    printf("flash busy for %u us per erase, %u us per page write\n",
+           BENCH_ERASE_US, BENCH_PAGE_WRITE_US);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    if (_bench_blocking(mtd, sector_size) < 0) {
+        return 1;
+    }
+    printf("blocking: %" PRIu32 " us\n", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    if (_bench_async(mtd, sector_size) < 0) {
+        return 1;
+    }
+    printf("async: %" PRIu32 " us\n", ztimer_now(ZTIMER_USEC) - start);
+
+    puts("SUCCESS");
+    return 0;
+}
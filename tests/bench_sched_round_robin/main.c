@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for round robin scheduling
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "schedstatistics.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_MS
+#define TEST_DURATION_MS    (1000U)
+#endif
+
+#define WORKER_NUMOF        (4U)
+
+static char _stacks[WORKER_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _pids[WORKER_NUMOF];
+static volatile uint32_t _counts[WORKER_NUMOF];
+static volatile unsigned _stop;
+
+static void *_worker(void *arg)
+{
+    volatile uint32_t *count = arg;
+
+    while (!_stop) {
+        (*count)++;
+    }
+    return NULL;
+}
+
+static uint32_t _run(unsigned workers)
+{
+    uint32_t sum = 0;
+
+    _stop = 0;
+    for (unsigned i = 0; i < workers; i++) {
+        _counts[i] = 0;
+        /* lower priority than main, main only runs again once the test
+         * duration passed */
+        _pids[i] = thread_create(_stacks[i], sizeof(_stacks[i]),
+                                 THREAD_PRIORITY_MAIN + 1,
+                                 THREAD_CREATE_STACKTEST, _worker,
+                                 (void *)&_counts[i], "worker");
+    }
+    ztimer_sleep(ZTIMER_MSEC, TEST_DURATION_MS);
+    _stop = 1;
+    for (unsigned i = 0; i < workers; i++) {
+        sum += _counts[i];
+    }
+    /* let the workers exit */
+    ztimer_sleep(ZTIMER_MSEC, 10);
+    return sum;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    uint32_t baseline = _run(1);
+
+    printf("{ \"baseline\" : %" PRIu32 " }\n", baseline);
+
+    uint32_t sum = _run(WORKER_NUMOF);
+    uint64_t sum_sq = 0;
+
+    for (unsigned i = 0; i < WORKER_NUMOF; i++) {
+        printf("{ \"worker\" : %u, \"count\" : %" PRIu32, i, _counts[i]);
+#ifdef MODULE_SCHED_ROUND_ROBIN
+        printf(", \"slices\" : %u", sched_pidlist[_pids[i]].slices);
+#endif
+        puts(" }");
+        sum_sq += (uint64_t)_counts[i] * _counts[i];
+    }
+
+    /* Jain's fairness index in percent, 100 if all workers did the same */
+    unsigned fairness = 0;
+    if (sum_sq) {
+        fairness = ((uint64_t)sum * sum * 100) / (WORKER_NUMOF * sum_sq);
+    }
+    /* work lost to context switches compared to a single worker */
+    int overhead = 0;
+    if (baseline) {
+        overhead = ((int64_t)baseline - sum) * 1000 / baseline;
+    }
+
+    printf("{ \"fairness\" : %u, \"overhead_permille\" : %d }\n",
+           fairness, overhead);
+
+    return 0;
+}
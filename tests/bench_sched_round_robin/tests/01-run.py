@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+WORKER_NUMOF = 4
+MIN_FAIRNESS = 90
+
+
+def testfunc(child):
+    child.expect(r"{ \"baseline\" : \d+ }")
+    for _ in range(WORKER_NUMOF):
+        child.expect(r"{ \"worker\" : \d+, \"count\" : (\d+)"
+                     r"(, \"slices\" : \d+)? }")
+        assert int(child.match.group(1)) > 0
+    child.expect(r"{ \"fairness\" : (\d+), \"overhead_permille\" : -?\d+ }")
+    assert int(child.match.group(1)) >= MIN_FAIRNESS
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the thread-safe ringbuffer
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "tsrb.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES     (32U * 1024U)
+#endif
+
+#define RB_SIZE         (256U)
+#define CHUNK_MAX       (128U)
+
+static uint8_t _rb_buf[RB_SIZE];
+static tsrb_t _rb;
+static tsrb_mp_t _mp;
+
+static uint8_t _in[CHUNK_MAX];
+static uint8_t _out[CHUNK_MAX];
+
+static const uint16_t _chunks[] = { 1, 8, 32, CHUNK_MAX };
+
+/* the byte wise copies tsrb_add() and tsrb_get() used to do */
+static void _bytes(size_t len)
+{
+    for (unsigned i = 0; i < len; i++) {
+        tsrb_add_one(&_rb, _in[i]);
+    }
+    for (unsigned i = 0; i < len; i++) {
+        _out[i] = tsrb_get_one(&_rb);
+    }
+}
+
+static void _block(size_t len)
+{
+    tsrb_add(&_rb, _in, len);
+    tsrb_get(&_rb, _out, len);
+}
+
+static void _zero_copy(size_t len)
+{
+    for (size_t done = 0; done < len;) {
+        uint8_t *data;
+        unsigned n = tsrb_reserve(&_rb, &data);
+        n = (n < len - done) ? n : len - done;
+        memcpy(data, &_in[done], n);
+        tsrb_commit(&_rb, n);
+        done += n;
+    }
+    for (size_t done = 0; done < len;) {
+        const uint8_t *data;
+        unsigned n = tsrb_peek(&_rb, &data);
+        memcpy(&_out[done], data, n);
+        tsrb_consume(&_rb, n);
+        done += n;
+    }
+}
+
+static void _multi_producer(size_t len)
+{
+    tsrb_mp_add(&_mp, _in, len);
+    tsrb_get(&_mp.rb, _out, len);
+}
+
+static const struct {
+    const char *name;
+    void (*func)(size_t);
+} _impls[] = {
+    { "bytes", _bytes },
+    { "block", _block },
+    { "zero_copy", _zero_copy },
+    { "multi_producer", _multi_producer },
+};
+
+static void _run(unsigned impl, size_t len)
+{
+    tsrb_init(&_rb, _rb_buf, sizeof(_rb_buf));
+    tsrb_mp_init(&_mp, _rb_buf, sizeof(_rb_buf));
+    memset(_out, 0, sizeof(_out));
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_BYTES / len; i++) {
+        _impls[impl].func(len);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+
+    if (memcmp(_in, _out, len)) {
+        printf("%s: data mismatch\n", _impls[impl].name);
+    }
+
+    /* bytes per microsecond equals MB/s */
+    uint32_t kbps = (uint64_t)BENCH_BYTES * 1000 / (elapsed ? elapsed : 1);
+    printf("%-14s %3u B: %7" PRIu32 " us, %4" PRIu32 ".%03" PRIu32 " MB/s\n",
+           _impls[impl].name, (unsigned)len, elapsed, kbps / 1000, kbps % 1000);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < CHUNK_MAX; i++) {
+        _in[i] = i * 7 + 3;
+    }
+
+    printf("%u bytes through a %u byte ringbuffer\n", BENCH_BYTES, RB_SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(_impls); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(_chunks); j++) {
+            _run(i, _chunks[j]);
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Append and lookup benchmark for the time-series log
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "mtd.h"
+#include "phydat.h"
+#include "timex.h"
+#include "tslog.h"
+#include "ztimer.h"
+
+#ifndef BENCH_SECTORS
+#define BENCH_SECTORS       (16U)
+#endif
+
+#ifndef BENCH_RECORDS
+#define BENCH_RECORDS       (4096U)
+#endif
+
+#ifndef BENCH_LOOKUPS
+#define BENCH_LOOKUPS       (256U)
+#endif
+
+/* time stamps advance by this much per record */
+#define TIME_STEP           (10U)
+
+static uint32_t _bytes_written;
+static uint32_t _erases;
+
+/* pass-through MTD counting the flash traffic of the log */
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_dev_t *parent = MTD_0;
+    int res = mtd_init(parent);
+
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    return res;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    (void)mtd;
+    int res = mtd_read_page(MTD_0, dest, page, offset, count);
+    return res < 0 ? res : (int)count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    (void)mtd;
+    int res = mtd_write_page_raw(MTD_0, src, page, offset, count);
+    if (res < 0) {
+        return res;
+    }
+    _bytes_written += count;
+    return count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    (void)mtd;
+    _erases += count;
+    return mtd_erase_sector(MTD_0, sector, count);
+}
+
+static const mtd_desc_t _counting_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _counting_mtd = {
+    .driver = &_counting_driver,
+};
+
+static tslog_t _log;
+
+static uint32_t _rand(void)
+{
+    static uint32_t state = 0x12345678;
+    state = state * 1103515245 + 12345;
+    return state >> 8;
+}
+
+int main(void)
+{
+    if (mtd_init(&_counting_mtd) < 0) {
+        puts("mtd_init() failed");
+        return 1;
+    }
+    if (tslog_init(&_log, &_counting_mtd, 0, BENCH_SECTORS) < 0 ||
+        tslog_clear(&_log) < 0) {
+        puts("tslog_init() failed");
+        return 1;
+    }
+
+    phydat_t data = { .val = { 0, 0, 0 }, .unit = UNIT_TEMP_C, .scale = -2 };
+    _bytes_written = 0;
+    _erases = 0;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < BENCH_RECORDS; i++) {
+        data.val[0] = 2000 + (i & 0xff);
+        if (tslog_append(&_log, i * TIME_STEP, &data, sizeof(data)) < 0) {
+            puts("tslog_append() failed");
+            return 1;
+        }
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+
+    uint32_t milli_bytes = (uint64_t)_bytes_written * 1000 / BENCH_RECORDS;
+    printf("append: %u records, %" PRIu32 " us, %" PRIu32 " records/s, "
+           "%" PRIu32 ".%03" PRIu32 " bytes/record, %" PRIu32 " erases\n",
+           BENCH_RECORDS, elapsed,
+           (uint32_t)((uint64_t)BENCH_RECORDS * US_PER_SEC / (elapsed ? elapsed : 1)),
+           milli_bytes / 1000, milli_bytes % 1000, _erases);
+
+    /* records still in the log, the oldest ones may have been dropped */
+    tslog_pos_t pos;
+    uint32_t first;
+    if (tslog_seek(&_log, &pos, 0) < 0 ||
+        tslog_read(&_log, &pos, &first, NULL, 0) < 0) {
+        puts("tslog_seek() failed");
+        return 1;
+    }
+    uint32_t span = (BENCH_RECORDS - 1) * TIME_STEP - first;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_LOOKUPS; i++) {
+        uint32_t want = first + _rand() % span;
+        uint32_t time;
+        if (tslog_seek(&_log, &pos, want) < 0 ||
+            tslog_read(&_log, &pos, &time, &data, sizeof(data)) < 0 ||
+            time < want || time - want >= TIME_STEP) {
+            printf("lookup of %" PRIu32 " failed\n", want);
+            return 1;
+        }
+    }
+    elapsed = ztimer_now(ZTIMER_USEC) - start;
+    printf("seek: %u lookups, %" PRIu32 " us/lookup\n",
+           BENCH_LOOKUPS, elapsed / BENCH_LOOKUPS);
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Small read/write throughput benchmark for VFS with and without
+ *              the `vfs_buffered` layer
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "mtd.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+#ifdef MODULE_FATFS_VFS
+#include "fs/fatfs.h"
+#define FS_NAME         "fatfs"
+#else
+#include "fs/littlefs2_fs.h"
+#define FS_NAME         "littlefs2"
+#endif
+
+#define MNT_PATH        "/bench"
+#define FILE_PATH       MNT_PATH "/bench.bin"
+
+#ifndef BENCH_CHUNK_SIZE
+#define BENCH_CHUNK_SIZE    (8U)
+#endif
+
+#ifndef BENCH_CHUNKS
+#define BENCH_CHUNKS        (2048U)
+#endif
+
+#ifdef MODULE_FATFS_VFS
+static fatfs_desc_t _fs_desc = {
+    .vol_idx = 0
+};
+
+/* provide mtd devices for use within diskio layer of fatfs */
+mtd_dev_t *fatfs_mtd_devs[FF_VOLUMES];
+
+#define _fs (&fatfs_file_system)
+#else
+static littlefs2_desc_t _fs_desc;
+
+#define _fs (&littlefs2_file_system)
+#endif
+
+static unsigned _driver_calls;
+
+static vfs_file_ops_t _counting_f_op;
+
+static vfs_file_system_t _counting_fs;
+
+static vfs_mount_t _mount = {
+    .fs = &_counting_fs,
+    .mount_point = MNT_PATH,
+    .private_data = &_fs_desc,
+};
+
+static ssize_t _counting_read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    _driver_calls++;
+    return _fs->f_op->read(filp, dest, nbytes);
+}
+
+static ssize_t _counting_write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    _driver_calls++;
+    return _fs->f_op->write(filp, src, nbytes);
+}
+
+static int _bench(const char *name, bool buffered, int flags)
+{
+    uint8_t chunk[BENCH_CHUNK_SIZE];
+    int fd = vfs_open(FILE_PATH, flags, 0);
+    if (fd < 0) {
+        printf("vfs_open failed: %d\n", fd);
+        return fd;
+    }
+    if (buffered && (vfs_buffer_attach(fd, 0) < 0)) {
+        puts("vfs_buffer_attach failed");
+        vfs_close(fd);
+        return -1;
+    }
+
+    memset(chunk, 0x5a, sizeof(chunk));
+    _driver_calls = 0;
+    uint32_t start = xtimer_now_usec();
+    for (unsigned i = 0; i < BENCH_CHUNKS; i++) {
+        ssize_t res = (flags & O_WRONLY) ? vfs_write(fd, chunk, sizeof(chunk))
+                                         : vfs_read(fd, chunk, sizeof(chunk));
+        if (res != sizeof(chunk)) {
+            printf("%s failed at chunk %u: %d\n", name, i, (int)res);
+            vfs_close(fd);
+            return -1;
+        }
+    }
+    /* include write-back of the last buffer in the measurement */
+    int res = vfs_close(fd);
+    uint32_t stop = xtimer_now_usec();
+
+    printf("%s %u x %u B (%s): %" PRIu32 " us, %u driver calls\n",
+           name, BENCH_CHUNKS, BENCH_CHUNK_SIZE,
+           buffered ? "buffered" : "direct", stop - start, _driver_calls);
+    return res;
+}
+
+int main(void)
+{
+    puts("VFS small read/write benchmark on " FS_NAME);
+
+    _counting_f_op = *_fs->f_op;
+    _counting_f_op.read = _counting_read;
+    _counting_f_op.write = _counting_write;
+    _counting_fs = *_fs;
+    _counting_fs.f_op = &_counting_f_op;
+
+#ifdef MODULE_FATFS_VFS
+    fatfs_mtd_devs[_fs_desc.vol_idx] = MTD_0;
+#else
+    _fs_desc.dev = MTD_0;
+    if (vfs_format(&_mount) < 0) {
+        puts("vfs_format failed");
+        return 1;
+    }
+#endif
+    if (vfs_mount(&_mount) < 0) {
+        puts("vfs_mount failed");
+        return 1;
+    }
+
+    if ((_bench("write", false, O_WRONLY | O_CREAT | O_TRUNC) < 0) ||
+        (_bench("read", false, O_RDONLY) < 0) ||
+        (_bench("write", true, O_WRONLY | O_CREAT | O_TRUNC) < 0) ||
+        (_bench("read", true, O_RDONLY) < 0)) {
+        return 1;
+    }
+
+    vfs_unlink(FILE_PATH);
+    vfs_umount(&_mount);
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Event thread pool test application
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event/pool.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define WORKERS_NUMOF       (3U)
+#define FAST_NUMOF          (6U)
+
+static char stacks[WORKERS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static event_pool_t pool;
+
+static unsigned fast_done;
+static unsigned fast_done_at_slow;
+static kernel_pid_t pinned_pid;
+
+static void _slow_handler(event_t *event);
+static void _fast_handler(event_t *event);
+static void _pinned_handler(event_t *event);
+
+typedef struct {
+    event_pool_event_t super;
+    uint32_t duration;
+} slow_event_t;
+
+static slow_event_t slow[WORKERS_NUMOF] = {
+    { EVENT_POOL_EVENT_INIT(_slow_handler, EVENT_POOL_AFFINITY_ANY), 50 },
+    { EVENT_POOL_EVENT_INIT(_slow_handler, EVENT_POOL_AFFINITY_ANY), 100 },
+    { EVENT_POOL_EVENT_INIT(_slow_handler, EVENT_POOL_AFFINITY_ANY), 150 },
+};
+static event_pool_event_t fast[FAST_NUMOF];
+static event_pool_event_t pinned =
+    EVENT_POOL_EVENT_INIT(_pinned_handler, EVENT_POOL_AFFINITY(0));
+
+static void _slow_handler(event_t *event)
+{
+    slow_event_t *slow = container_of(event, slow_event_t, super.super);
+
+    ztimer_sleep(ZTIMER_MSEC, slow->duration);
+    fast_done_at_slow = fast_done;
+}
+
+static void _fast_handler(event_t *event)
+{
+    (void)event;
+    fast_done++;
+}
+
+static void _pinned_handler(event_t *event)
+{
+    (void)event;
+    pinned_pid = thread_getpid();
+}
+
+static void _print_stats(void)
+{
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        const event_pool_stats_t *stats = event_pool_stats(&pool, i);
+
+        printf("worker %u: handled %" PRIu32 ", stolen %" PRIu32 ", "
+               "latency max %" PRIu32 " us\n", i, stats->handled,
+               stats->stolen, stats->latency_max);
+    }
+}
+
+int main(void)
+{
+    puts("event pool test");
+
+    /* workers run at a higher priority than main */
+    event_pool_init(&pool, stacks[0], sizeof(stacks[0]), WORKERS_NUMOF,
+                    THREAD_PRIORITY_MAIN - 1);
+
+    for (unsigned i = 0; i < FAST_NUMOF; i++) {
+        fast[i].super.handler = _fast_handler;
+    }
+
+    /* a long running handler does not delay other events */
+    event_pool_post(&pool, &slow[0].super);
+    for (unsigned i = 0; i < FAST_NUMOF; i++) {
+        event_pool_post(&pool, &fast[i]);
+    }
+    /* pinned to the worker busy with the slow event */
+    event_pool_post(&pool, &pinned);
+    expect(pinned_pid == KERNEL_PID_UNDEF);
+    ztimer_sleep(ZTIMER_MSEC, 100);
+    expect(fast_done_at_slow == FAST_NUMOF);
+    expect(pinned_pid == pool.workers[0].pid);
+    puts("long running handler did not block the pool");
+    _print_stats();
+
+    /* with all workers busy, the first one done steals the events queued at
+     * the others */
+    fast_done = 0;
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        event_pool_post(&pool, &slow[i].super);
+    }
+    for (unsigned i = 0; i < FAST_NUMOF; i++) {
+        event_pool_post(&pool, &fast[i]);
+    }
+    ztimer_sleep(ZTIMER_MSEC, 75);
+    expect(fast_done == FAST_NUMOF);
+    ztimer_sleep(ZTIMER_MSEC, 100);
+    puts("idle worker stole queued events");
+    _print_stats();
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+WORKERS_NUMOF = 3
+
+
+def _expect_stats(child):
+    stolen = 0
+    for i in range(WORKERS_NUMOF):
+        child.expect(r"worker {}: handled (\d+), stolen (\d+), "
+                     r"latency max \d+ us".format(i))
+        stolen += int(child.match.group(2))
+    return stolen
+
+
+def testfunc(child):
+    child.expect_exact("long running handler did not block the pool")
+    _expect_stats(child)
+    child.expect_exact("idle worker stole queued events")
+    assert _expect_stats(child) > 0
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
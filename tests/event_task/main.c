@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Event task test application
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event/task.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define TICKERS_NUMOF       (4U)
+#define TICKS               (5U)
+#define WAKE_ROUNDS         (10U)
+
+typedef struct {
+    event_task_t task;
+    unsigned id;
+    unsigned ticks;
+} ticker_t;
+
+typedef struct {
+    event_task_t task;
+    ztimer_t timer;
+    volatile uint32_t fired;
+    uint32_t latency_sum;
+    uint32_t latency_max;
+    unsigned round;
+} waker_t;
+
+static event_queue_t queue;
+static ticker_t tickers[TICKERS_NUMOF];
+static waker_t waker;
+static unsigned done;
+
+/* tickers share the thread, sleeping for different periods */
+static int _ticker(event_task_t *task)
+{
+    ticker_t *ticker = container_of(task, ticker_t, task);
+
+    EVENT_TASK_BEGIN(task);
+    for (ticker->ticks = 0; ticker->ticks < TICKS; ticker->ticks++) {
+        EVENT_TASK_SLEEP(task, ZTIMER_MSEC, 10 * (ticker->id + 1));
+    }
+    printf("ticker %u done\n", ticker->id);
+    EVENT_TASK_END(task);
+}
+
+static void _timer_cb(void *arg)
+{
+    waker_t *waker = arg;
+
+    waker->fired = ztimer_now(ZTIMER_USEC);
+    event_task_wake(&waker->task);
+}
+
+/* woken up from a timer callback, as it would be from a sock callback */
+static int _waker(event_task_t *task)
+{
+    waker_t *waker = container_of(task, waker_t, task);
+
+    EVENT_TASK_BEGIN(task);
+    for (waker->round = 0; waker->round < WAKE_ROUNDS; waker->round++) {
+        waker->fired = 0;
+        ztimer_set(ZTIMER_MSEC, &waker->timer, 7);
+        EVENT_TASK_WAIT_UNTIL(task, waker->fired != 0);
+
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - waker->fired;
+
+        waker->latency_sum += latency;
+        if (latency > waker->latency_max) {
+            waker->latency_max = latency;
+        }
+        EVENT_TASK_YIELD(task);
+    }
+    EVENT_TASK_END(task);
+}
+
+static void _done(event_task_t *task)
+{
+    (void)task;
+    done++;
+}
+
+int main(void)
+{
+    puts("event task test");
+    event_queue_init(&queue);
+
+    for (unsigned i = 0; i < TICKERS_NUMOF; i++) {
+        tickers[i].id = i;
+        event_task_start(&tickers[i].task, &queue, _ticker, _done);
+    }
+    waker.timer.callback = _timer_cb;
+    waker.timer.arg = &waker;
+    event_task_start(&waker.task, &queue, _waker, _done);
+
+    while (done < TICKERS_NUMOF + 1) {
+        event_t *event = event_wait(&queue);
+        event->handler(event);
+    }
+
+    for (unsigned i = 0; i < TICKERS_NUMOF; i++) {
+        expect(tickers[i].ticks == TICKS);
+    }
+    printf("wake latency avg %" PRIu32 " us, max %" PRIu32 " us\n",
+           waker.latency_sum / WAKE_ROUNDS, waker.latency_max);
+    printf("%u tasks use %u bytes, %u threads would use %u bytes of stack\n",
+           TICKERS_NUMOF + 1,
+           (unsigned)(sizeof(tickers) + sizeof(waker)),
+           TICKERS_NUMOF + 1,
+           (unsigned)((TICKERS_NUMOF + 1) * THREAD_STACKSIZE_DEFAULT));
+    puts("SUCCESS");
+
+    return 0;
+}
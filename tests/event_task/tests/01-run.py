@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+TICKERS_NUMOF = 4
+
+
+def testfunc(child):
+    child.expect_exact("event task test")
+    # tickers with shorter periods finish first
+    for i in range(TICKERS_NUMOF):
+        child.expect_exact("ticker {} done".format(i))
+    child.expect(r"wake latency avg \d+ us, max \d+ us")
+    child.expect(r"\d+ tasks use (\d+) bytes, \d+ threads would use (\d+) "
+                 r"bytes of stack")
+    assert int(child.match.group(1)) < int(child.match.group(2))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
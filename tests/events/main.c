@@ -27,11 +27,14 @@
 #include "event.h"
 #include "event/timeout.h"
 #include "event/callback.h"
+#include "event/prio.h"
 #include "xtimer.h"
 
 #define STACKSIZE               THREAD_STACKSIZE_DEFAULT
 #define PRIO                    (THREAD_PRIORITY_MAIN - 1)
 #define DELAYED_QUEUES_NUMOF    2
+#define BENCH_EVENTS_NUMOF      (16U)
+#define BENCH_ROUNDS            (1000U)
 
 static char stack[STACKSIZE];
 
@@ -124,6 +127,74 @@ static void delayed_callback3(event_t *arg)
     printf("triggered delayed event %p\n", (void *)arg);
 }
 
+static unsigned bench_handled;
+static event_t bench_events[BENCH_EVENTS_NUMOF];
+
+static void bench_callback(event_t *arg)
+{
+    (void)arg;
+    bench_handled++;
+}
+
+static void bench(void)
+{
+    event_queue_t queue = EVENT_QUEUE_INIT;
+    event_t *ev;
+    uint32_t post = 0;
+    uint32_t cancel = 0;
+    uint32_t dispatch = 0;
+
+    for (unsigned i = 0; i < BENCH_EVENTS_NUMOF; i++) {
+        bench_events[i].handler = bench_callback;
+    }
+
+    for (unsigned round = 0; round < BENCH_ROUNDS; round++) {
+        uint32_t start = xtimer_now_usec();
+        for (unsigned i = 0; i < BENCH_EVENTS_NUMOF; i++) {
+            event_post(&queue, &bench_events[i]);
+        }
+        uint32_t posted = xtimer_now_usec();
+        /* cancel every other event, starting at the tail of the queue */
+        for (unsigned i = BENCH_EVENTS_NUMOF; i > 0; i -= 2) {
+            event_cancel(&queue, &bench_events[i - 1]);
+        }
+        uint32_t canceled = xtimer_now_usec();
+        while ((ev = event_get(&queue))) {
+            ev->handler(ev);
+        }
+        uint32_t dispatched = xtimer_now_usec();
+
+        post += posted - start;
+        cancel += canceled - posted;
+        dispatch += dispatched - canceled;
+    }
+    thread_flags_clear(THREAD_FLAG_EVENT);
+    expect(bench_handled == BENCH_ROUNDS * BENCH_EVENTS_NUMOF / 2);
+
+    printf("post: %" PRIu32 " ns, cancel: %" PRIu32 " ns, "
+           "dispatch: %" PRIu32 " ns per event\n",
+           (uint32_t)(post * NS_PER_US / (BENCH_ROUNDS * BENCH_EVENTS_NUMOF)),
+           (uint32_t)(cancel * NS_PER_US /
+                      (BENCH_ROUNDS * BENCH_EVENTS_NUMOF / 2)),
+           (uint32_t)(dispatch * NS_PER_US /
+                      (BENCH_ROUNDS * BENCH_EVENTS_NUMOF / 2)));
+
+    /* bands of an event priority queue are drained in priority order */
+    event_prio_queue_t prio_queue;
+    event_prio_queue_init(&prio_queue);
+    event_prio_post(&prio_queue, EVENT_PRIO_BAND_LOW, &bench_events[0]);
+    event_prio_post(&prio_queue, EVENT_PRIO_BAND_LOW, &bench_events[1]);
+    event_prio_post(&prio_queue, EVENT_PRIO_BAND_HIGH, &bench_events[2]);
+    event_prio_post(&prio_queue, EVENT_PRIO_BAND_HIGH, &bench_events[3]);
+    event_prio_cancel(&prio_queue, EVENT_PRIO_BAND_HIGH, &bench_events[3]);
+    expect(event_prio_get(&prio_queue) == &bench_events[2]);
+    expect(event_prio_get(&prio_queue) == &bench_events[0]);
+    expect(event_prio_get(&prio_queue) == &bench_events[1]);
+    expect(event_prio_get(&prio_queue) == NULL);
+    thread_flags_clear(THREAD_FLAG_EVENT);
+    puts("event priority queue drained in order");
+}
+
 static void *claiming_thread(void *arg)
 {
     event_queue_t *dqs = arg;
@@ -141,6 +212,8 @@ int main(void)
 {
     puts("[START] event test application.\n");
 
+    bench();
+
     /* test creation of delayed claiming of a detached event queue */
     event_queue_t dqs[DELAYED_QUEUES_NUMOF] = {
         EVENT_QUEUE_INIT_DETACHED, EVENT_QUEUE_INIT_DETACHED
@@ -12,6 +12,8 @@ from testrunner import run
 
 
 def testfunc(child):
+    child.expect(r"post: \d+ ns, cancel: \d+ ns, dispatch: \d+ ns per event")
+    child.expect_exact("event priority queue drained in order")
     child.expect_exact(u"[SUCCESS]")
 
 
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for checksum offloading of netdev_tap
+ *
+ * Packets are sent through gnrc_ipv6 over a netdev_tap interface, whose
+ * TAP is replaced by a pipe. The frames read from the pipe are checked for
+ * the virtio-net header and a checksum that is valid once completed the
+ * way the host does.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <linux/virtio_net.h>
+
+/* needs to be included before native's declarations of ntohl etc. */
+#include "byteorder.h"
+#include "native_internal.h"
+#include "net/ethernet.h"
+#include "net/ethernet/hdr.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/icmpv6.h"
+#include "net/gnrc/icmpv6/echo.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/udp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "netdev_tap.h"
+#include "netdev_tap_params.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define SEND_DELAY_MS   (100U)  /**< time the stack gets to send a packet */
+#define PAYLOAD_LEN     (32U)
+
+static netdev_tap_t _tap;
+static netdev_driver_t _driver;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static int _pipe[2];
+static uint8_t _frames[4 * (sizeof(struct virtio_net_hdr) + ETHERNET_FRAME_LEN)];
+
+static const ipv6_addr_t _dst = IPV6_ADDR_ALL_NODES_LINK_LOCAL;
+
+/* replaces the TAP by a pipe, frames carry the virtio-net header as if the
+ * TAP had accepted IFF_VNET_HDR */
+static int _init(netdev_t *netdev)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    if ((real_pipe(_pipe) < 0) ||
+        (real_fcntl(_pipe[0], F_SETFL, O_NONBLOCK) < 0)) {
+        return -errno;
+    }
+    dev->tap_fd = _pipe[1];
+    dev->promiscuous = 0;
+    dev->vnet_hdr = 1;
+    dev->csum_offload = NETOPT_CSUM_OFFLOAD_NONE;
+    memcpy(dev->addr, addr, sizeof(addr));
+    return 0;
+}
+
+static void _send(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *netif;
+
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, &_dst);
+    expect(pkt != NULL);
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, netif);
+    expect(gnrc_netapi_dispatch_send(type, GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+}
+
+static void _send_udp(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_LEN,
+                                          GNRC_NETTYPE_UNDEF);
+
+    expect(pkt != NULL);
+    memset(pkt->data, 0x5a, PAYLOAD_LEN);
+    pkt = gnrc_udp_hdr_build(pkt, 0xf0b0, 0xf0b1);
+    expect(pkt != NULL);
+    _send(pkt, GNRC_NETTYPE_UDP);
+}
+
+static void _send_icmpv6(void)
+{
+    uint8_t data[PAYLOAD_LEN];
+    gnrc_pktsnip_t *pkt;
+
+    memset(data, 0xa5, sizeof(data));
+    pkt = gnrc_icmpv6_echo_build(ICMPV6_ECHO_REQ, 1, 1, data, sizeof(data));
+    expect(pkt != NULL);
+    _send(pkt, GNRC_NETTYPE_IPV6);
+}
+
+static uint16_t _csum_offset(uint8_t nh)
+{
+    switch (nh) {
+        case PROTNUM_UDP:
+            return 6;
+        case PROTNUM_ICMPV6:
+            return 2;
+        default:
+            expect(false);
+            return 0;
+    }
+}
+
+/* reads the frames sent since the last call and returns how many carried
+ * @p nh, all of them with checksum offloading requested or not as given by
+ * @p offload */
+static unsigned _check_frames(uint8_t nh, bool offload)
+{
+    unsigned found = 0;
+
+    ztimer_sleep(ZTIMER_MSEC, SEND_DELAY_MS);
+    ssize_t len = _native_read(_pipe[0], _frames, sizeof(_frames));
+    if (len <= 0) {
+        return 0;
+    }
+
+    /* the pipe does not keep frame boundaries, but the IPv6 header does */
+    for (uint8_t *pos = _frames; pos < _frames + len;) {
+        struct virtio_net_hdr *vnet = (void *)pos;
+        ethernet_hdr_t *eth = (void *)(vnet + 1);
+        ipv6_hdr_t *ipv6 = (void *)(eth + 1);
+        uint8_t *l4 = (uint8_t *)(ipv6 + 1);
+        uint16_t l4_len = byteorder_ntohs(ipv6->len);
+        uint16_t pseudo = ipv6_hdr_inet_csum(0, ipv6, ipv6->nh, l4_len);
+
+        expect(byteorder_ntohs(eth->type) == ETHERTYPE_IPV6);
+        expect(vnet->gso_type == VIRTIO_NET_HDR_GSO_NONE);
+        if (vnet->flags & VIRTIO_NET_HDR_F_NEEDS_CSUM) {
+            expect(vnet->csum_start == sizeof(*eth) + sizeof(*ipv6));
+            expect(vnet->csum_offset == _csum_offset(ipv6->nh));
+
+            /* the field holds the sum of the pseudo header, the host adds
+             * everything from csum_start on and stores the complement */
+            network_uint16_t *field = (void *)((uint8_t *)eth +
+                                               vnet->csum_start +
+                                               vnet->csum_offset);
+            expect(byteorder_ntohs(*field) == pseudo);
+            *field = byteorder_htons((uint16_t)~inet_csum(0, l4, l4_len));
+        }
+        else {
+            expect(vnet->flags == 0);
+        }
+        expect(inet_csum(pseudo, l4, l4_len) == 0xffff);
+
+        if (ipv6->nh == nh) {
+            expect(!!(vnet->flags & VIRTIO_NET_HDR_F_NEEDS_CSUM) == offload);
+            found++;
+        }
+        pos = l4 + l4_len;
+    }
+    return found;
+}
+
+int main(void)
+{
+    puts("Checksum offload test");
+
+    netdev_tap_setup(&_tap, &netdev_tap_params[0]);
+    _driver = *_tap.netdev.driver;
+    _driver.init = _init;
+    _tap.netdev.driver = &_driver;
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "tap", &_tap.netdev) == 0);
+    expect(_netif.flags & GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD);
+
+    /* drop whatever the interface sent on its own */
+    _check_frames(PROTNUM_RESERVED, true);
+
+    _send_udp();
+    expect(_check_frames(PROTNUM_UDP, true) == 1);
+    puts("UDP, offload on: OK");
+
+    _send_icmpv6();
+    expect(_check_frames(PROTNUM_ICMPV6, true) == 1);
+    puts("ICMPv6, offload on: OK");
+
+    netopt_csum_offload_t offload = NETOPT_CSUM_OFFLOAD_NONE;
+    expect(gnrc_netapi_set(_netif.pid, NETOPT_CHECKSUM_OFFLOAD, 0, &offload,
+                           sizeof(offload)) == sizeof(offload));
+    expect(!(_netif.flags & GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD));
+
+    _send_udp();
+    expect(_check_frames(PROTNUM_UDP, false) == 1);
+    puts("UDP, offload off: OK");
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,443 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests indirect transmission of IEEE 802.15.4 interfaces
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netif/ieee802154_indirect.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "ztimer.h"
+
+#define OWN_ADDR        { 0x00, 0x01 }
+#define CHILD_ADDR      { 0x00, 0x02 }
+#define OTHER_ADDR      { 0x00, 0x03 }
+#define PAN             (0x23)
+#define PAYLOAD         "payload"
+
+static const uint8_t _own_addr[] = OWN_ADDR;
+static const uint8_t _child_addr[] = CHILD_ADDR;
+static const uint8_t _other_addr[] = OTHER_ADDR;
+static const uint8_t _own_long_addr[] = { 0x02, 0, 0, 0, 0, 0, 0, 0x01 };
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+/* device mock state */
+static uint8_t _rx_buf[IEEE802154_FRAME_LEN_MAX];
+static size_t _rx_len;
+static uint8_t _tx_buf[IEEE802154_FRAME_LEN_MAX];
+static size_t _tx_len;
+static unsigned _tx_count;
+static netdev_event_t _isr_event;
+static netopt_enable_t _ack_pending;
+static netopt_state_t _radio_state;
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    _tx_len = 0;
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        memcpy(&_tx_buf[_tx_len], iol->iol_base, iol->iol_len);
+        _tx_len += iol->iol_len;
+    }
+    _tx_count++;
+    return _tx_len;
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    int res = _rx_len;
+
+    if (buf == NULL) {
+        if (len > 0) {
+            _rx_len = 0;
+        }
+        return res;
+    }
+    if ((size_t)len < _rx_len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _rx_buf, _rx_len);
+    return res;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, _isr_event);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_UNDEF;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = sizeof(_own_addr);
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    memcpy(value, _own_addr, sizeof(_own_addr));
+    return sizeof(_own_addr);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    memcpy(value, _own_long_addr, sizeof(_own_long_addr));
+    return sizeof(_own_long_addr);
+}
+
+static int _set_ack_pending(netdev_t *dev, const void *value, size_t len)
+{
+    (void)dev;
+    _ack_pending = *((const netopt_enable_t *)value);
+    return len;
+}
+
+static int _set_state(netdev_t *dev, const void *value, size_t len)
+{
+    (void)dev;
+    _radio_state = *((const netopt_state_t *)value);
+    return len;
+}
+
+static void _trigger_event(netdev_event_t event)
+{
+    /* the interface thread has a higher priority, so the event is handled
+     * once this returns */
+    _isr_event = event;
+    netdev_trigger_event_isr(&_dev.netdev.netdev);
+}
+
+static void _recv_frame(const uint8_t *src, uint8_t type, uint8_t flags,
+                        const void *payload, size_t payload_len)
+{
+    le_uint16_t pan = byteorder_htols(PAN);
+    size_t mhr_len = ieee802154_set_frame_hdr(_rx_buf, src, 2,
+                                              _own_addr, sizeof(_own_addr),
+                                              pan, pan, type | flags, 0);
+
+    TEST_ASSERT(mhr_len > 0);
+    memcpy(&_rx_buf[mhr_len], payload, payload_len);
+    _rx_len = mhr_len + payload_len;
+    _trigger_event(NETDEV_EVENT_RX_COMPLETE);
+}
+
+static void _recv_data_req(const uint8_t *src)
+{
+    static const uint8_t cmd = IEEE802154_CMD_DATA_REQ;
+
+    _recv_frame(src, IEEE802154_FCF_TYPE_MACCMD, IEEE802154_FCF_ACK_REQ,
+                &cmd, sizeof(cmd));
+}
+
+static void _send_pkt(const uint8_t *dst)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, PAYLOAD, sizeof(PAYLOAD),
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr = gnrc_netif_hdr_build(NULL, 0, dst, 2);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL(hdr);
+    pkt = gnrc_pkt_prepend(pkt, hdr);
+    TEST_ASSERT(gnrc_netapi_send(_netif.pid, pkt) > 0);
+}
+
+/* checks type, destination and payload length of the last sent frame */
+static void _check_tx(uint8_t type, const uint8_t *dst, size_t payload_len)
+{
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];
+    le_uint16_t pan;
+    size_t mhr_len = ieee802154_get_frame_hdr_len(_tx_buf);
+
+    TEST_ASSERT(mhr_len > 0);
+    TEST_ASSERT(_tx_len >= mhr_len);
+    TEST_ASSERT_EQUAL_INT(type, _tx_buf[0] & IEEE802154_FCF_TYPE_MASK);
+    TEST_ASSERT_EQUAL_INT(2, ieee802154_get_dst(_tx_buf, addr, &pan));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(addr, dst, 2));
+    TEST_ASSERT_EQUAL_INT(payload_len, _tx_len - mhr_len);
+}
+
+static void set_up(void)
+{
+    _tx_count = 0;
+    _tx_len = 0;
+}
+
+static void test_indirect_hold_and_deliver(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_add(&_netif,
+                                                                _child_addr,
+                                                                2));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                    _child_addr,
+                                                                    2));
+
+    /* packets to other nodes are sent right away */
+    _send_pkt(_other_addr);
+    TEST_ASSERT_EQUAL_INT(1, _tx_count);
+
+    /* packets to the child are held */
+    _send_pkt(_child_addr);
+    _send_pkt(_child_addr);
+    TEST_ASSERT_EQUAL_INT(1, _tx_count);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                    _child_addr,
+                                                                    2));
+    TEST_ASSERT_EQUAL_INT(NETOPT_ENABLE, _ack_pending);
+
+    /* first poll: more data is pending */
+    _recv_data_req(_child_addr);
+    TEST_ASSERT_EQUAL_INT(2, _tx_count);
+    _check_tx(IEEE802154_FCF_TYPE_DATA, _child_addr, sizeof(PAYLOAD));
+    TEST_ASSERT(_tx_buf[0] & IEEE802154_FCF_FRAME_PEND);
+    TEST_ASSERT_EQUAL_INT(NETOPT_ENABLE, _ack_pending);
+
+    /* second poll: last packet */
+    _recv_data_req(_child_addr);
+    TEST_ASSERT_EQUAL_INT(3, _tx_count);
+    _check_tx(IEEE802154_FCF_TYPE_DATA, _child_addr, sizeof(PAYLOAD));
+    TEST_ASSERT(!(_tx_buf[0] & IEEE802154_FCF_FRAME_PEND));
+    TEST_ASSERT_EQUAL_INT(NETOPT_DISABLE, _ack_pending);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                    _child_addr,
+                                                                    2));
+
+    /* nothing pending and not claimed by the ACK: nothing to send */
+    _recv_data_req(_child_addr);
+    TEST_ASSERT_EQUAL_INT(3, _tx_count);
+
+    TEST_ASSERT_EQUAL_INT(2, _netif.ieee802154_indirect.stats.delivered);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_indirect_empty_frame(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_add(&_netif,
+                                                                _other_addr,
+                                                                2));
+    _send_pkt(_child_addr);
+    TEST_ASSERT_EQUAL_INT(0, _tx_count);
+    TEST_ASSERT_EQUAL_INT(NETOPT_ENABLE, _ack_pending);
+
+    /* the ACK claimed pending data, so the other child gets an empty frame */
+    _recv_data_req(_other_addr);
+    TEST_ASSERT_EQUAL_INT(1, _tx_count);
+    _check_tx(IEEE802154_FCF_TYPE_DATA, _other_addr, 0);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                    _child_addr,
+                                                                    2));
+
+    /* removing the child drops its packets */
+    gnrc_netif_ieee802154_indirect_remove(&_netif, _child_addr, 2);
+    TEST_ASSERT_EQUAL_INT(-ENOENT,
+                          gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                 _child_addr,
+                                                                 2));
+    TEST_ASSERT_EQUAL_INT(NETOPT_DISABLE, _ack_pending);
+    gnrc_netif_ieee802154_indirect_remove(&_netif, _other_addr, 2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_indirect_queue_full(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_add(&_netif,
+                                                                _child_addr,
+                                                                2));
+    for (unsigned i = 0; i <= CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_QUEUE_SIZE; i++) {
+        _send_pkt(_child_addr);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _tx_count);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_QUEUE_SIZE,
+                          gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                 _child_addr,
+                                                                 2));
+    TEST_ASSERT_EQUAL_INT(1, _netif.ieee802154_indirect.stats.dropped);
+    gnrc_netif_ieee802154_indirect_remove(&_netif, _child_addr, 2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_indirect_expire(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_add(&_netif,
+                                                                _child_addr,
+                                                                2));
+    _send_pkt(_child_addr);
+    ztimer_sleep(ZTIMER_MSEC, CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_TIMEOUT_MS / 2);
+    _send_pkt(_child_addr);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                    _child_addr,
+                                                                    2));
+
+    /* only the first packet timed out */
+    ztimer_sleep(ZTIMER_MSEC, CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_TIMEOUT_MS / 2 + 10);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                    _child_addr,
+                                                                    2));
+    TEST_ASSERT_EQUAL_INT(NETOPT_ENABLE, _ack_pending);
+
+    ztimer_sleep(ZTIMER_MSEC, CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_TIMEOUT_MS / 2);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_pending(&_netif,
+                                                                    _child_addr,
+                                                                    2));
+    TEST_ASSERT_EQUAL_INT(NETOPT_DISABLE, _ack_pending);
+    TEST_ASSERT_EQUAL_INT(2, _netif.ieee802154_indirect.stats.expired);
+    TEST_ASSERT_EQUAL_INT(0, _tx_count);
+    gnrc_netif_ieee802154_indirect_remove(&_netif, _child_addr, 2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_indirect_poll(void)
+{
+    static const uint8_t data[] = PAYLOAD;
+    gnrc_netif_ieee802154_indirect_stats_t *stats;
+
+    stats = &_netif.ieee802154_indirect.stats;
+    TEST_ASSERT_EQUAL_INT(-ENOTCONN, gnrc_netif_ieee802154_indirect_poll(&_netif));
+
+    /* the coordinator is polled once */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_set_parent(&_netif,
+                                                                       _other_addr,
+                                                                       2));
+    TEST_ASSERT_EQUAL_INT(1, _tx_count);
+    _check_tx(IEEE802154_FCF_TYPE_MACCMD, _other_addr, 1);
+    TEST_ASSERT_EQUAL_INT(IEEE802154_CMD_DATA_REQ, _tx_buf[_tx_len - 1]);
+    TEST_ASSERT(_tx_buf[0] & IEEE802154_FCF_ACK_REQ);
+
+    /* nothing pending: radio is switched off right away */
+    _trigger_event(NETDEV_EVENT_TX_COMPLETE);
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_SLEEP, _radio_state);
+
+    /* pending data: radio stays on until the last frame arrived */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_poll(&_netif));
+    TEST_ASSERT_EQUAL_INT(2, _tx_count);
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_IDLE, _radio_state);
+    _trigger_event(NETDEV_EVENT_TX_COMPLETE_DATA_PENDING);
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_IDLE, _radio_state);
+    /* a frame with frame pending set triggers another poll */
+    _recv_frame(_other_addr, IEEE802154_FCF_TYPE_DATA,
+                IEEE802154_FCF_FRAME_PEND, data, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(3, _tx_count);
+    _check_tx(IEEE802154_FCF_TYPE_MACCMD, _other_addr, 1);
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_IDLE, _radio_state);
+    _trigger_event(NETDEV_EVENT_TX_COMPLETE_DATA_PENDING);
+    _recv_frame(_other_addr, IEEE802154_FCF_TYPE_DATA, 0, data, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_SLEEP, _radio_state);
+
+    /* pending data that never arrives */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_poll(&_netif));
+    _trigger_event(NETDEV_EVENT_TX_COMPLETE_DATA_PENDING);
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_IDLE, _radio_state);
+    ztimer_sleep(ZTIMER_MSEC, CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MS + 10);
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_SLEEP, _radio_state);
+
+    TEST_ASSERT_EQUAL_INT(4, stats->polls);
+    TEST_ASSERT_EQUAL_INT(3, stats->polls_pending);
+    TEST_ASSERT(stats->radio_on_ms >= CONFIG_GNRC_NETIF_IEEE802154_INDIRECT_WAIT_MS);
+    printf("radio on for %" PRIu32 " ms in %" PRIu32 " polls\n",
+           stats->radio_on_ms, stats->polls);
+
+    /* stop polling */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_ieee802154_indirect_set_parent(&_netif,
+                                                                       NULL, 0));
+    TEST_ASSERT_EQUAL_INT(NETOPT_STATE_IDLE, _radio_state);
+    TEST_ASSERT_EQUAL_INT(-ENOTCONN, gnrc_netif_ieee802154_indirect_poll(&_netif));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_indirect(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_indirect_hold_and_deliver),
+        new_TestFixture(test_indirect_empty_frame),
+        new_TestFixture(test_indirect_queue_full),
+        new_TestFixture(test_indirect_expire),
+        new_TestFixture(test_indirect_poll),
+    };
+
+    EMB_UNIT_TESTCALLER(indirect_tests, set_up, NULL, fixtures);
+
+    return (Test *)&indirect_tests;
+}
+
+static void _init_dev(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_set_cb(&_dev, NETOPT_ACK_PENDING, _set_ack_pending);
+    netdev_test_set_set_cb(&_dev, NETOPT_STATE, _set_state);
+    _dev.netdev.pan = PAN;
+}
+
+int main(void)
+{
+    _init_dev();
+    gnrc_netif_ieee802154_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                 GNRC_NETIF_PRIO, "wpan", &_dev.netdev.netdev);
+
+    TESTS_START();
+    TESTS_RUN(tests_indirect());
+    TESTS_END();
+    return 0;
+}
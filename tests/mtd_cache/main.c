@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_cache.h"
+
+#define SECTOR_COUNT        (16U)
+#define PAGE_PER_SECTOR     (4U)
+#define PAGE_SIZE           (64U)
+#define SECTOR_SIZE         (PAGE_SIZE * PAGE_PER_SECTOR)
+
+#define CACHE_LINES         (2)
+
+/* RAM backed NOR flash, counting the operations reaching it. The cache only
+ * accesses it within page and device bounds. */
+static uint8_t _dummy_memory[SECTOR_SIZE * SECTOR_COUNT];
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static unsigned _erases;
+static unsigned _writes;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _power(mtd_dev_t *dev, enum mtd_power_state power)
+{
+    (void)dev;
+    (void)power;
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    memcpy(buff, &_dummy_memory[page * dev->page_size + offset], size);
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    uint8_t *mem = &_dummy_memory[page * dev->page_size + offset];
+    const uint8_t *in = buff;
+
+    for (uint32_t i = 0; i < size; i++) {
+        mem[i] &= in[i];
+    }
+    _writes++;
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t sector_size = dev->page_size * dev->pages_per_sector;
+
+    memset(&_dummy_memory[sector * sector_size], 0xff, count * sector_size);
+    _erases += count;
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init         = _init,
+    .power        = _power,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static uint8_t _cache_buf[CACHE_LINES * SECTOR_SIZE];
+static mtd_cache_line_t _cache_lines[CACHE_LINES];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&dev, _cache_lines, _cache_buf,
+                                           CACHE_LINES);
+
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static void _test_mem(uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void setup(void)
+{
+    memset(_dummy_memory, 0, sizeof(_dummy_memory));
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    _erases = 0;
+    _writes = 0;
+}
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+}
+
+static void test_mtd_cache_merge_writes(void)
+{
+    /* erase sector 1 twice and fill it byte by byte */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 1, 1));
+    for (uint32_t i = 0; i < SECTOR_SIZE; i++) {
+        uint8_t val = 0xAA;
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, &val, PAGE_PER_SECTOR, i, 1));
+    }
+
+    /* nothing reached the backing device yet */
+    TEST_ASSERT_EQUAL_INT(0, _erases);
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    _test_mem(&_dummy_memory[SECTOR_SIZE], SECTOR_SIZE, 0x00);
+
+    /* but reads see the new data */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, PAGE_PER_SECTOR, 0, SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, 0xAA);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _writes);
+    _test_mem(&_dummy_memory[SECTOR_SIZE], SECTOR_SIZE, 0xAA);
+
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.erases);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.erases_avoided);
+    TEST_ASSERT_EQUAL_INT(SECTOR_SIZE - PAGE_PER_SECTOR, _cache.stats.writes_merged);
+
+    /* flushing again is a no-op */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _writes);
+}
+
+static void test_mtd_cache_partial_write(void)
+{
+    /* write without erase only programs the dirty page */
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    memset(_buffer, 0x55, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, _buffer, 2, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(0, _erases);
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(&_dummy_memory[2 * PAGE_SIZE], PAGE_SIZE, 0x55);
+    _test_mem(&_dummy_memory[3 * PAGE_SIZE], PAGE_SIZE, 0xff);
+}
+
+static void test_mtd_cache_lru(void)
+{
+    /* touch one more sector than there are cache lines */
+    for (uint32_t sector = 0; sector <= CACHE_LINES; sector++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, sector, 1));
+    }
+
+    /* sector 0 was least recently used and got written back */
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    _test_mem(&_dummy_memory[0], SECTOR_SIZE, 0xff);
+    _test_mem(&_dummy_memory[SECTOR_SIZE], SECTOR_SIZE, 0x00);
+
+    /* power down writes back the rest */
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_DOWN));
+    TEST_ASSERT_EQUAL_INT(CACHE_LINES + 1, _erases);
+    _test_mem(&_dummy_memory[SECTOR_SIZE], CACHE_LINES * SECTOR_SIZE, 0xff);
+}
+
+static void test_mtd_cache_read_passthrough(void)
+{
+    memset(&_dummy_memory[3 * SECTOR_SIZE], 0x42, SECTOR_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 3 * SECTOR_SIZE, SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, 0x42);
+    TEST_ASSERT_EQUAL_INT(0, _cache.stats.hits);
+    TEST_ASSERT(_cache.stats.misses > 0);
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_merge_writes),
+        new_TestFixture(test_mtd_cache_partial_write),
+        new_TestFixture(test_mtd_cache_lru),
+        new_TestFixture(test_mtd_cache_read_passthrough),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
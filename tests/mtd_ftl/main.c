@@ -0,0 +1,397 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_ftl module test
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_ftl.h"
+
+/* Test mock object implementing a simple RAM-based mtd */
+#ifndef SECTOR_COUNT
+#define SECTOR_COUNT 8
+#endif
+#ifndef PAGE_PER_SECTOR
+#define PAGE_PER_SECTOR 4
+#endif
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 64
+#endif
+
+#define SECTOR_SIZE         (PAGE_SIZE * PAGE_PER_SECTOR)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static uint8_t _buffer[PAGE_SIZE];
+
+static unsigned _erases[SECTOR_COUNT];
+
+/* number of writes and erases until the power fails, 0 if it never does */
+static unsigned _power_fail_in;
+static bool _power_failed;
+
+/* returns -EIO if the power is gone, 1 if it fails during this operation */
+static int _power_fail(void)
+{
+    if (_power_failed) {
+        return -EIO;
+    }
+    if (_power_fail_in && (--_power_fail_in == 0)) {
+        _power_failed = true;
+        return 1;
+    }
+    return 0;
+}
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    memcpy(buff, _dummy_memory + addr, size);
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+    const uint8_t *in = buff;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    int fail = _power_fail();
+    if (fail < 0) {
+        return fail;
+    }
+
+    /* behave like NOR flash */
+    for (uint32_t i = 0; i < size; i++) {
+        _dummy_memory[addr + i] &= in[i];
+    }
+
+    if (fail) {
+        /* torn write: the lowest bit was not programmed yet */
+        _dummy_memory[addr] |= 0x01;
+        return -EIO;
+    }
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    int fail = _power_fail();
+    if (fail < 0) {
+        return fail;
+    }
+
+    if (fail) {
+        /* torn erase: the header page was not erased yet */
+        memset(_dummy_memory + addr + dev->page_size, 0xff,
+               dev->page_size * (dev->pages_per_sector - 1));
+        return -EIO;
+    }
+
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+    while (count--) {
+        _erases[sector++]++;
+    }
+
+    return 0;
+}
+
+static int _power(mtd_dev_t *dev, enum mtd_power_state power)
+{
+    (void)dev;
+    (void)power;
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .power = _power,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_ftl_sector_t _sectors[SECTOR_COUNT];
+static uint32_t _map[MTD_FTL_MAP_SIZE(SECTOR_COUNT, PAGE_PER_SECTOR)];
+static uint8_t _ftl_buf[2 * PAGE_SIZE];
+static mtd_ftl_t _ftl = MTD_FTL_INIT(&dev, _sectors, _map, _ftl_buf);
+
+static mtd_dev_t *_dev = &_ftl.mtd;
+
+static void _test_mem(uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static uint32_t _pages(void)
+{
+    return _dev->sector_count * _dev->pages_per_sector;
+}
+
+static int _write(uint32_t page, uint8_t val)
+{
+    memset(_buffer, val, PAGE_SIZE);
+    return mtd_write_page_raw(_dev, _buffer, page, 0, PAGE_SIZE);
+}
+
+static void setup(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    memset(_erases, 0, sizeof(_erases));
+    _power_fail_in = 0;
+    _power_failed = false;
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+}
+
+static void test_mtd_ftl_init(void)
+{
+    /* (8 - 2) * 3 = 18 data pages make 4 full logical sectors */
+    TEST_ASSERT_EQUAL_INT(4, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _ftl.free_sectors);
+
+    /* unwritten pages read as erased */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xff);
+}
+
+static void test_mtd_ftl_overwrite(void)
+{
+    /* rewrite a page without erasing */
+    TEST_ASSERT_EQUAL_INT(0, _write(5, 0x0f));
+    TEST_ASSERT_EQUAL_INT(0, _write(5, 0xf0));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 5, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xf0);
+
+    /* partial writes keep the rest of the page */
+    uint8_t val = 0x42;
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, &val, 5, 7, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 5, 0, PAGE_SIZE));
+    _test_mem(_buffer, 7, 0xf0);
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[7]);
+    _test_mem(_buffer + 8, PAGE_SIZE - 8, 0xf0);
+}
+
+static unsigned _total_erases(void)
+{
+    unsigned sum = 0;
+    for (unsigned i = 0; i < SECTOR_COUNT; i++) {
+        sum += _erases[i];
+    }
+    return sum;
+}
+
+static void test_mtd_ftl_erase(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _write(4, 0x00));
+    TEST_ASSERT_EQUAL_INT(0, _write(8, 0x00));
+
+    /* erasing a logical sector does not erase flash */
+    unsigned erases = _total_erases();
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 1, 1));
+    TEST_ASSERT_EQUAL_INT(erases, _total_erases());
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 4, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xff);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 8, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0x00);
+}
+
+static void test_mtd_ftl_remount(void)
+{
+    for (uint32_t page = 0; page < _pages(); page++) {
+        TEST_ASSERT_EQUAL_INT(0, _write(page, page));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _write(3, 0xaa));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 2, 1));
+
+    /* rebuild the page map from flash */
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+
+    for (uint32_t page = 0; page < _pages(); page++) {
+        uint8_t expected = page;
+        if (page == 3) {
+            expected = 0xaa;
+        }
+        else if (page / PAGE_PER_SECTOR == 2) {
+            expected = 0xff;
+        }
+        TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, page, 0, PAGE_SIZE));
+        _test_mem(_buffer, PAGE_SIZE, expected);
+    }
+
+    /* and keep going */
+    TEST_ASSERT_EQUAL_INT(0, _write(3, 0x55));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 3, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0x55);
+}
+
+static void test_mtd_ftl_wear_leveling(void)
+{
+    /* fill the device with static data */
+    for (uint32_t page = 0; page < _pages(); page++) {
+        TEST_ASSERT_EQUAL_INT(0, _write(page, page));
+    }
+
+    /* hammer a single page */
+    for (unsigned i = 0; i < 2000; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _write(0, i));
+        if ((i % 16) == 0) {
+            TEST_ASSERT(mtd_ftl_gc(&_ftl, 1) >= 0);
+        }
+    }
+
+    /* static data survived garbage collection */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 1999 & 0xff);
+    for (uint32_t page = 1; page < _pages(); page++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, page, 0, PAGE_SIZE));
+        _test_mem(_buffer, PAGE_SIZE, page);
+    }
+
+    /* all sectors took part */
+    uint32_t hist[4];
+    uint32_t min, max;
+    mtd_ftl_erase_histogram(&_ftl, hist, ARRAY_SIZE(hist), &min, &max);
+    printf("erase counts: %u..%u, write amplification: %u%%\n",
+           (unsigned)min, (unsigned)max,
+           (unsigned)mtd_ftl_write_amplification(&_ftl));
+    TEST_ASSERT(max - min <= CONFIG_MTD_FTL_WEAR_DELTA + 1);
+    for (unsigned i = 0; i < SECTOR_COUNT; i++) {
+        TEST_ASSERT(_erases[i] >= min);
+    }
+    TEST_ASSERT(mtd_ftl_write_amplification(&_ftl) >= 100);
+    TEST_ASSERT(_ftl.stats.relocations > 0);
+}
+
+static void test_mtd_ftl_power_loss(void)
+{
+    /* cut the power at every write and erase of a run of overwrites that
+     * spans garbage collection */
+    for (unsigned tear = 1;; tear++) {
+        memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+        _power_fail_in = 0;
+        _power_failed = false;
+        TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+        for (uint32_t page = 0; page < _pages(); page++) {
+            TEST_ASSERT_EQUAL_INT(0, _write(page, page));
+        }
+
+        _power_fail_in = tear;
+        uint32_t torn = 0;
+        while ((torn < _pages()) && (_write(torn, 0x80 | torn) == 0)) {
+            torn++;
+        }
+        if (!_power_failed) {
+            break;
+        }
+
+        _power_fail_in = 0;
+        _power_failed = false;
+        TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+
+        /* all completed writes survived, the torn one is old or new */
+        for (uint32_t page = 0; page < _pages(); page++) {
+            TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, page, 0,
+                                                   PAGE_SIZE));
+            if ((page == torn) && (_buffer[0] == page)) {
+                _test_mem(_buffer, PAGE_SIZE, page);
+            }
+            else {
+                _test_mem(_buffer, PAGE_SIZE,
+                          (page <= torn) ? (0x80 | page) : page);
+            }
+        }
+
+        /* and keep going */
+        TEST_ASSERT_EQUAL_INT(0, _write(torn, 0x55));
+        TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, torn, 0,
+                                               PAGE_SIZE));
+        _test_mem(_buffer, PAGE_SIZE, 0x55);
+    }
+}
+
+Test *tests_mtd_ftl_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_ftl_init),
+        new_TestFixture(test_mtd_ftl_overwrite),
+        new_TestFixture(test_mtd_ftl_erase),
+        new_TestFixture(test_mtd_ftl_remount),
+        new_TestFixture(test_mtd_ftl_wear_leveling),
+        new_TestFixture(test_mtd_ftl_power_loss),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_ftl_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_ftl_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_ftl_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for priority inheritance of mutexes
+ *
+ * A thread of low priority holds a lock that a thread of high priority
+ * waits for, while a thread of medium priority runs a busy loop. The time
+ * the high priority thread waits for the lock is measured. Finally, the
+ * low priority thread holds two nested locks and must keep the inherited
+ * priority until it releases the outer one. Last, a thread sleeps twice,
+ * which hands it the locked mutexes ztimer_sleep() waits on, and must still
+ * be able to lock and unlock a mutex.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "rmutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ROUNDS              (3U)
+
+#define PRIO_HIGH           (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_MID            (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_LOW            (THREAD_PRIORITY_MAIN - 1)
+
+#define HIGH_DELAY_MS       (10U)   /**< delay until the high prio thread locks */
+#define MID_DELAY_MS        (15U)   /**< delay until the mid prio thread spins */
+#define LOW_HOLD_MS         (30U)   /**< time the low prio thread holds the lock */
+#define MID_SPIN_MS         (100U)  /**< time the mid prio thread spins */
+#define ROUND_MS            (2 * (LOW_HOLD_MS + MID_SPIN_MS))
+
+typedef struct {
+    const char *name;
+    void (*lock)(void);
+    void (*unlock)(void);
+} lock_t;
+
+static char stack_high[THREAD_STACKSIZE_DEFAULT];
+static char stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char stack_low[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t mutex = MUTEX_INIT;
+static rmutex_t rmutex = RMUTEX_INIT;
+
+static mutex_t mutex_outer = MUTEX_INIT;
+static mutex_t mutex_inner = MUTEX_INIT;
+
+static const lock_t *lock;
+static uint32_t wait_ms;
+static uint8_t low_prio_max;
+static bool low_restored;
+static uint8_t nested_prio_inner;   /**< low prio after unlocking inner lock */
+static uint8_t nested_prio_outer;   /**< low prio after unlocking outer lock */
+static bool sleep_locked;
+
+static void _mutex_lock(void)
+{
+    mutex_lock(&mutex);
+}
+
+static void _mutex_unlock(void)
+{
+    mutex_unlock(&mutex);
+}
+
+static void _rmutex_lock(void)
+{
+    rmutex_lock(&rmutex);
+}
+
+static void _rmutex_unlock(void)
+{
+    rmutex_unlock(&rmutex);
+}
+
+static const lock_t locks[] = {
+    { "mutex", _mutex_lock, _mutex_unlock },
+    { "rmutex", _rmutex_lock, _rmutex_unlock },
+};
+
+static void _spin(uint32_t ms)
+{
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    while ((ztimer_now(ZTIMER_MSEC) - start) < ms) {}
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+    ztimer_sleep(ZTIMER_MSEC, HIGH_DELAY_MS);
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    lock->lock();
+    wait_ms = ztimer_now(ZTIMER_MSEC) - start;
+    lock->unlock();
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+    ztimer_sleep(ZTIMER_MSEC, MID_DELAY_MS);
+    _spin(MID_SPIN_MS);
+    return NULL;
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+    thread_t *me = thread_get_active();
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    lock->lock();
+    low_prio_max = me->priority;
+    while ((ztimer_now(ZTIMER_MSEC) - start) < LOW_HOLD_MS) {
+        if (me->priority < low_prio_max) {
+            low_prio_max = me->priority;
+        }
+    }
+    lock->unlock();
+    low_restored = (me->priority == PRIO_LOW);
+    return NULL;
+}
+
+static void *_nested_high(void *arg)
+{
+    (void)arg;
+    ztimer_sleep(ZTIMER_MSEC, HIGH_DELAY_MS);
+    mutex_lock(&mutex_outer);
+    mutex_unlock(&mutex_outer);
+    return NULL;
+}
+
+static void *_nested_low(void *arg)
+{
+    (void)arg;
+    thread_t *me = thread_get_active();
+
+    mutex_lock(&mutex_outer);
+    mutex_lock(&mutex_inner);
+    _spin(LOW_HOLD_MS);
+    mutex_unlock(&mutex_inner);
+    nested_prio_inner = me->priority;
+    mutex_unlock(&mutex_outer);
+    nested_prio_outer = me->priority;
+    return NULL;
+}
+
+static void *_sleep_lock(void *arg)
+{
+    (void)arg;
+    /* both sleeps use a mutex on the stack at the same address */
+    ztimer_sleep(ZTIMER_MSEC, 1);
+    ztimer_sleep(ZTIMER_MSEC, 1);
+    mutex_lock(&mutex);
+    mutex_unlock(&mutex);
+    sleep_locked = true;
+    return NULL;
+}
+
+int main(void)
+{
+    bool success = true;
+
+    puts("Mutex priority inheritance test");
+    printf("high prio thread waits %u ms after the lock, mid prio thread "
+           "spins for %u ms\n", HIGH_DELAY_MS, MID_SPIN_MS);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(locks); i++) {
+        lock = &locks[i];
+        uint32_t wait_max = 0;
+        uint32_t wait_sum = 0;
+
+        for (unsigned round = 0; round < ROUNDS; round++) {
+            /* the high and mid prio threads sleep first, so the low prio
+             * thread gets the lock */
+            thread_create(stack_high, sizeof(stack_high), PRIO_HIGH,
+                          THREAD_CREATE_STACKTEST, _high, NULL, "high");
+            thread_create(stack_mid, sizeof(stack_mid), PRIO_MID,
+                          THREAD_CREATE_STACKTEST, _mid, NULL, "mid");
+            thread_create(stack_low, sizeof(stack_low), PRIO_LOW,
+                          THREAD_CREATE_STACKTEST, _low, NULL, "low");
+            /* main has the lowest priority and runs again once all threads
+             * are done */
+            ztimer_sleep(ZTIMER_MSEC, ROUND_MS);
+
+            printf("%s round %u: waited %" PRIu32 " ms, owner prio %u -> %u, "
+                   "restored: %s\n", lock->name, round, wait_ms,
+                   (unsigned)PRIO_LOW, (unsigned)low_prio_max,
+                   low_restored ? "yes" : "no");
+            wait_sum += wait_ms;
+            if (wait_ms > wait_max) {
+                wait_max = wait_ms;
+            }
+            if ((wait_ms >= MID_SPIN_MS) || (low_prio_max != PRIO_HIGH) ||
+                !low_restored) {
+                success = false;
+            }
+        }
+        printf("%s: wait avg %" PRIu32 " ms, max %" PRIu32 " ms\n",
+               lock->name, wait_sum / ROUNDS, wait_max);
+    }
+
+    /* the high prio thread blocks on the outer lock while the low prio
+     * thread holds both */
+    thread_create(stack_high, sizeof(stack_high), PRIO_HIGH,
+                  THREAD_CREATE_STACKTEST, _nested_high, NULL, "high");
+    thread_create(stack_low, sizeof(stack_low), PRIO_LOW,
+                  THREAD_CREATE_STACKTEST, _nested_low, NULL, "low");
+    ztimer_sleep(ZTIMER_MSEC, ROUND_MS);
+
+    printf("nested: owner prio %u -> %u after inner unlock, %u after outer "
+           "unlock\n", (unsigned)PRIO_LOW, (unsigned)nested_prio_inner,
+           (unsigned)nested_prio_outer);
+    if ((nested_prio_inner != PRIO_HIGH) || (nested_prio_outer != PRIO_LOW)) {
+        success = false;
+    }
+
+    thread_create(stack_high, sizeof(stack_high), PRIO_HIGH,
+                  THREAD_CREATE_STACKTEST, _sleep_lock, NULL, "high");
+    ztimer_sleep(ZTIMER_MSEC, HIGH_DELAY_MS);
+
+    printf("sleep: locked after sleeping: %s\n", sleep_locked ? "yes" : "no");
+    if (!sleep_locked) {
+        success = false;
+    }
+
+    puts(success ? "SUCCESS" : "FAILURE");
+    return 0;
+}
@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+ROUNDS = 3
+MID_SPIN_MS = 100
+
+
+def testfunc(child):
+    child.expect_exact("Mutex priority inheritance test")
+    for name in ("mutex", "rmutex"):
+        for _ in range(ROUNDS):
+            child.expect(r"{} round \d+: waited (\d+) ms, owner prio (\d+) -> "
+                         r"(\d+), restored: (yes|no)".format(name))
+            assert int(child.match.group(1)) < MID_SPIN_MS
+            assert int(child.match.group(3)) < int(child.match.group(2))
+            assert child.match.group(4) == "yes"
+    child.expect(r"nested: owner prio (\d+) -> (\d+) after inner unlock, "
+                 r"(\d+) after outer unlock")
+    assert int(child.match.group(2)) < int(child.match.group(1))
+    assert int(child.match.group(3)) == int(child.match.group(1))
+    child.expect_exact("sleep: locked after sleeping: yes")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tickless idle governor test application
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "pm_governor.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define SLEEPS              (5U)
+#define SLEEP_MS            (100U)
+
+static void _cb(void *arg)
+{
+    (void)arg;
+}
+
+static unsigned _select_with_timer(uint32_t us)
+{
+    ztimer_t timer = { .callback = _cb };
+
+    ztimer_set(ZTIMER_USEC, &timer, us);
+    unsigned mode = pm_governor_select(0);
+    ztimer_remove(ZTIMER_USEC, &timer);
+
+    return mode;
+}
+
+static unsigned _lowest_unblocked(void)
+{
+    pm_blocker_t blocker = pm_get_blocker();
+    unsigned mode = PM_NUM_MODES;
+
+    while (mode && !blocker.val_u8[mode - 1]) {
+        mode--;
+    }
+    return mode;
+}
+
+int main(void)
+{
+    puts("pm_governor test");
+
+    /* deepest mode first */
+    const pm_governor_mode_t modes[] = {
+        { .latency_us = 5000, .residency_us = 20000 },
+        { .latency_us = 500, .residency_us = 2000 },
+        { .latency_us = 50, .residency_us = 100 },
+    };
+    for (unsigned mode = 0; mode < PM_NUM_MODES && mode < ARRAY_SIZE(modes);
+         mode++) {
+        pm_governor_set_mode(mode, &modes[mode]);
+    }
+
+    if (PM_NUM_MODES >= ARRAY_SIZE(modes)) {
+        expect(_select_with_timer(US_PER_SEC) == 0);
+        expect(_select_with_timer(10 * US_PER_MS) == 1);
+        expect(_select_with_timer(US_PER_MS) == 2);
+        expect(_select_with_timer(50) == PM_GOVERNOR_IDLE);
+        puts("selection ok");
+    }
+
+    pm_governor_reset_stats();
+    for (unsigned i = 0; i < SLEEPS; i++) {
+        ztimer_sleep(ZTIMER_MSEC, SLEEP_MS);
+        ztimer_sleep(ZTIMER_USEC, SLEEP_MS * US_PER_MS);
+    }
+
+    pm_governor_stats_t stats;
+    pm_governor_get_stats(&stats);
+    for (unsigned mode = 0; mode <= PM_GOVERNOR_IDLE; mode++) {
+        printf("mode %u: entries %" PRIu32 ", residency %" PRIu32 " us\n",
+               mode, stats.entries[mode], (uint32_t)stats.residency_us[mode]);
+    }
+    printf("limited %" PRIu32 ", suspended %" PRIu32 "\n",
+           stats.limited, stats.suspended);
+
+    /* all sleeps are long enough for the deepest mode not blocked */
+    unsigned lowest = _lowest_unblocked();
+    expect(stats.entries[lowest] >= 2 * SLEEPS);
+    expect(stats.residency_us[lowest] >= SLEEPS * SLEEP_MS * US_PER_MS);
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -18,14 +18,88 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 
+#include "event/thread.h"
+#include "net/af.h"
+#include "net/ipv6/addr.h"
+#include "net/sntp.h"
 #include "shell.h"
+#include "ztimer.h"
+
+#define DEFAULT_TIMEOUT     (500000LU)
 
 static char line_buf[SHELL_DEFAULT_BUFSIZE];
 
+static sntp_task_t task;
+static volatile bool running;
+static uint32_t start;
+
+static void _sync_done(sntp_task_t *task, int result)
+{
+    (void)task;
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - start;
+
+    running = false;
+    if (result < 0) {
+        printf("ntpdate_async: error %d after %" PRIu32 " us\n", result,
+               latency);
+        return;
+    }
+    printf("ntpdate_async: offset %" PRIi64 " us after %" PRIu32 " us\n",
+           sntp_get_offset(), latency);
+}
+
+static int _ntpdate_async(int argc, char **argv)
+{
+    sock_udp_ep_t server = { .port = NTP_PORT, .family = AF_INET6 };
+    uint32_t timeout = DEFAULT_TIMEOUT;
+
+    if (argc < 2) {
+        printf("Usage: %s <server addr>[%%<interface>] [<timeout in us>]\n",
+               argv[0]);
+        return 1;
+    }
+
+    char *iface = ipv6_addr_split_iface(argv[1]);
+
+    if (iface) {
+        server.netif = atoi(iface);
+    }
+    if (ipv6_addr_from_str((ipv6_addr_t *)&server.addr, argv[1]) == NULL) {
+        puts("error: malformed address");
+        return 1;
+    }
+    if (argc > 2) {
+        timeout = atoi(argv[2]);
+    }
+    /* the task can only run one synchronization at a time */
+    if (running) {
+        puts("error: synchronization in progress");
+        return 1;
+    }
+    running = true;
+
+    /* the synchronization runs on the shared event thread, instead of
+     * blocking the shell */
+    printf("ntpdate_async: task uses %u bytes instead of a stack of %u "
+           "bytes\n", (unsigned)sizeof(task), (unsigned)THREAD_STACKSIZE_DEFAULT);
+    start = ztimer_now(ZTIMER_USEC);
+    sntp_sync_async(&task, EVENT_PRIO_MEDIUM, &server, timeout, _sync_done);
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "ntpdate_async", "synchronizes with a remote time server without "
+      "blocking", _ntpdate_async },
+    { NULL, NULL, NULL }
+};
+
 int main(void)
 {
-    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
     return 0;
 }
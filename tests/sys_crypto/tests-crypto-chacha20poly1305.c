@@ -76,10 +76,69 @@ static void test_crypto_chacha20poly1305_1(void)
     _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1));
 }
 
+static void test_crypto_chacha20poly1305_incremental(void)
+{
+    static const size_t chunks[] = { 1, 3, 15, 16, 17, 64, 65 };
+    const size_t msglen = sizeof(msg_1);
+    chacha20poly1305_stream_ctx_t ctx;
+    uint8_t tag[CHACHA20POLY1305_TAG_BYTES];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        size_t chunk = chunks[i];
+
+        memset(ebuf, 0, sizeof(ebuf));
+        chacha20poly1305_init(&ctx, key_1, nonce_1);
+        chacha20poly1305_update_aad(&ctx, aad_1, 5);
+        chacha20poly1305_update_aad(&ctx, aad_1 + 5, sizeof(aad_1) - 5);
+        for (size_t pos = 0; pos < msglen; pos += chunk) {
+            size_t len = (msglen - pos < chunk) ? msglen - pos : chunk;
+            chacha20poly1305_encrypt_update(&ctx, msg_1 + pos, ebuf + pos, len);
+        }
+        chacha20poly1305_encrypt_finish(&ctx, tag);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, ciphertext_1, msglen));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(tag, ciphertext_1 + msglen, sizeof(tag)));
+
+        /* decrypt in place */
+        chacha20poly1305_init(&ctx, key_1, nonce_1);
+        chacha20poly1305_update_aad(&ctx, aad_1, sizeof(aad_1));
+        for (size_t pos = 0; pos < msglen; pos += chunk) {
+            size_t len = (msglen - pos < chunk) ? msglen - pos : chunk;
+            chacha20poly1305_decrypt_update(&ctx, ebuf + pos, ebuf + pos, len);
+        }
+        TEST_ASSERT_EQUAL_INT(1, chacha20poly1305_decrypt_finish(&ctx, tag));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, msg_1, msglen));
+    }
+
+    /* a modified tag is rejected */
+    tag[0] ^= 1;
+    chacha20poly1305_init(&ctx, key_1, nonce_1);
+    chacha20poly1305_update_aad(&ctx, aad_1, sizeof(aad_1));
+    chacha20poly1305_decrypt_update(&ctx, ciphertext_1, pbuf, msglen);
+    TEST_ASSERT_EQUAL_INT(0, chacha20poly1305_decrypt_finish(&ctx, tag));
+}
+
+static void test_crypto_chacha20poly1305_tampered(void)
+{
+    size_t len;
+
+    memcpy(ebuf, ciphertext_1, sizeof(ciphertext_1));
+    ebuf[10] ^= 0x80;
+    memset(pbuf, 0xaa, sizeof(msg_1));
+    TEST_ASSERT_EQUAL_INT(0,
+            chacha20poly1305_decrypt(ebuf, sizeof(ciphertext_1), pbuf, &len,
+                                     aad_1, sizeof(aad_1), key_1, nonce_1));
+    /* nothing is decrypted */
+    for (size_t i = 0; i < sizeof(msg_1); i++) {
+        TEST_ASSERT_EQUAL_INT(0xaa, pbuf[i]);
+    }
+}
+
 Test *tests_crypto_chacha20poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha20poly1305_1),
+        new_TestFixture(test_crypto_chacha20poly1305_incremental),
+        new_TestFixture(test_crypto_chacha20poly1305_tampered),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha20poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_chacha20poly1305_tests;
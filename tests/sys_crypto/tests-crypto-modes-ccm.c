@@ -1255,6 +1255,129 @@ static void test_crypto_modes_ccm_decrypt(void)
 }
 
 
+static void test_incremental_op(const uint8_t *key, const uint8_t *adata,
+                                size_t adata_len, const uint8_t *nonce,
+                                uint8_t nonce_len, const uint8_t *plain,
+                                size_t plain_len, const uint8_t *expected,
+                                uint8_t mac_length, size_t chunk)
+{
+    cipher_t cipher;
+    cipher_ccm_ctx_t ctx;
+    size_t len_encoding = nonce_and_len_encoding_size - nonce_len;
+    size_t off, n;
+
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&cipher, CIPHER_AES_128, key, 16));
+
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_init(&ctx, &cipher, mac_length,
+                                             len_encoding, nonce, nonce_len,
+                                             adata_len, plain_len));
+    for (off = 0; off < adata_len; off += n) {
+        n = (adata_len - off < chunk) ? adata_len - off : chunk;
+        TEST_ASSERT_EQUAL_INT(0, cipher_ccm_update_adata(&ctx, adata + off, n));
+    }
+    for (off = 0; off < plain_len; off += n) {
+        n = (plain_len - off < chunk) ? plain_len - off : chunk;
+        TEST_ASSERT_EQUAL_INT(0, cipher_ccm_encrypt_update(&ctx, plain + off,
+                                                           n, data + off));
+    }
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_encrypt_finish(&ctx, data + plain_len));
+    TEST_ASSERT(memcmp(expected, data, plain_len + mac_length) == 0);
+
+    /* decrypt in place */
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_init(&ctx, &cipher, mac_length,
+                                             len_encoding, nonce, nonce_len,
+                                             adata_len, plain_len));
+    for (off = 0; off < adata_len; off += n) {
+        n = (adata_len - off < chunk) ? adata_len - off : chunk;
+        TEST_ASSERT_EQUAL_INT(0, cipher_ccm_update_adata(&ctx, adata + off, n));
+    }
+    for (off = 0; off < plain_len; off += n) {
+        n = (plain_len - off < chunk) ? plain_len - off : chunk;
+        TEST_ASSERT_EQUAL_INT(0, cipher_ccm_decrypt_update(&ctx, data + off,
+                                                           n, data + off));
+    }
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_decrypt_finish(&ctx,
+                                                       expected + plain_len));
+    TEST_ASSERT(memcmp(plain, data, plain_len) == 0);
+}
+
+#define do_test_incremental_op(name, chunk) do { \
+        test_incremental_op(TEST_ ## name ## _KEY, \
+                            TEST_ ## name ## _INPUT, TEST_ ## name ## _ADATA_LEN, \
+                            TEST_ ## name ## _NONCE, TEST_ ## name ## _NONCE_LEN, \
+                            TEST_ ## name ## _INPUT + TEST_ ## name ## _ADATA_LEN, \
+                            TEST_ ## name ## _INPUT_LEN, \
+                            TEST_ ## name ## _EXPECTED + TEST_ ## name ## _ADATA_LEN, \
+                            TEST_ ## name ## _MAC_LEN, chunk); \
+} while (0)
+
+static void test_crypto_modes_ccm_incremental(void)
+{
+    static const size_t chunks[] = { 1, 3, 15, 16, 17, 64 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        do_test_incremental_op(RFC_4, chunks[i]);
+        do_test_incremental_op(NIST_3, chunks[i]);
+        do_test_incremental_op(CUSTOM_1, chunks[i]);
+    }
+}
+
+static void test_crypto_modes_ccm_iolist(void)
+{
+    cipher_t cipher;
+    cipher_ccm_ctx_t ctx;
+    uint8_t mac[TEST_RFC_1_MAC_LEN];
+    size_t plain_len = TEST_RFC_1_INPUT_LEN;
+    const uint8_t *plain = TEST_RFC_1_INPUT + TEST_RFC_1_ADATA_LEN;
+
+    iolist_t iol[3] = {
+        { .iol_next = &iol[1], .iol_base = data, .iol_len = 5 },
+        { .iol_next = &iol[2], .iol_base = data + 5, .iol_len = 0 },
+        { .iol_next = NULL, .iol_base = data + 5, .iol_len = plain_len - 5 },
+    };
+
+    cipher_init(&cipher, CIPHER_AES_128, TEST_RFC_1_KEY, TEST_RFC_1_KEY_LEN);
+    memcpy(data, plain, plain_len);
+
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_init(&ctx, &cipher, TEST_RFC_1_MAC_LEN,
+                                             2, TEST_RFC_1_NONCE,
+                                             TEST_RFC_1_NONCE_LEN,
+                                             TEST_RFC_1_ADATA_LEN, plain_len));
+    /* additional data has to come first */
+    TEST_ASSERT_EQUAL_INT(CIPHER_ERR_INVALID_LENGTH,
+                          cipher_ccm_encrypt_iol(&ctx, iol));
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_update_adata(&ctx, TEST_RFC_1_INPUT,
+                                                     TEST_RFC_1_ADATA_LEN));
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_encrypt_iol(&ctx, iol));
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_encrypt_finish(&ctx, mac));
+    TEST_ASSERT(memcmp(TEST_RFC_1_EXPECTED + TEST_RFC_1_ADATA_LEN, data,
+                       plain_len) == 0);
+    TEST_ASSERT(memcmp(TEST_RFC_1_EXPECTED + TEST_RFC_1_ADATA_LEN + plain_len,
+                       mac, sizeof(mac)) == 0);
+
+    /* a modified MAC is detected */
+    mac[0] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_init(&ctx, &cipher, TEST_RFC_1_MAC_LEN,
+                                             2, TEST_RFC_1_NONCE,
+                                             TEST_RFC_1_NONCE_LEN,
+                                             TEST_RFC_1_ADATA_LEN, plain_len));
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_update_adata(&ctx, TEST_RFC_1_INPUT,
+                                                     TEST_RFC_1_ADATA_LEN));
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_decrypt_iol(&ctx, iol));
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_CBC_MAC,
+                          cipher_ccm_decrypt_finish(&ctx, mac));
+    TEST_ASSERT(memcmp(plain, data, plain_len) == 0);
+
+    /* too little payload */
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_init(&ctx, &cipher, TEST_RFC_1_MAC_LEN,
+                                             2, TEST_RFC_1_NONCE,
+                                             TEST_RFC_1_NONCE_LEN, 0,
+                                             plain_len + 1));
+    TEST_ASSERT_EQUAL_INT(0, cipher_ccm_encrypt_iol(&ctx, iol));
+    TEST_ASSERT_EQUAL_INT(CIPHER_ERR_INVALID_LENGTH,
+                          cipher_ccm_encrypt_finish(&ctx, mac));
+}
+
 typedef int (*func_ccm_t)(const cipher_t *, const uint8_t *, uint32_t,
                           uint8_t, uint8_t, const uint8_t *, size_t,
                           const uint8_t *, size_t, uint8_t *);
@@ -1336,6 +1459,8 @@ Test *tests_crypto_modes_ccm_tests(void)
         new_TestFixture(test_crypto_modes_ccm_encrypt),
         new_TestFixture(test_crypto_modes_ccm_decrypt),
         new_TestFixture(test_crypto_modes_ccm_check_len),
+        new_TestFixture(test_crypto_modes_ccm_incremental),
+        new_TestFixture(test_crypto_modes_ccm_iolist),
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ccm_tests, NULL, NULL, fixtures);
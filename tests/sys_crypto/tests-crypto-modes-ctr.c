@@ -119,12 +119,36 @@ static void test_crypto_modes_ctr_decrypt(void)
                     TEST_1_CIPHER_LEN, TEST_1_PLAIN, TEST_1_PLAIN_LEN);
 }
 
+static void test_crypto_modes_ctr_incremental(void)
+{
+    static const size_t chunks[] = { 1, 7, 16, 17, 33 };
+    cipher_t cipher;
+    cipher_ctr_ctx_t ctx;
+    uint8_t data[64];
+
+    cipher_init(&cipher, CIPHER_AES_128, TEST_1_KEY, TEST_1_KEY_LEN);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        size_t n;
+
+        memset(data, 0, sizeof(data));
+        cipher_ctr_init(&ctx, &cipher, TEST_1_COUNTER, 0);
+        for (size_t off = 0; off < TEST_1_PLAIN_LEN; off += n) {
+            n = (TEST_1_PLAIN_LEN - off < chunks[i]) ? TEST_1_PLAIN_LEN - off
+                                                     : chunks[i];
+            TEST_ASSERT_EQUAL_INT(0, cipher_ctr_update(&ctx, TEST_1_PLAIN + off,
+                                                       n, data + off));
+        }
+        TEST_ASSERT(memcmp(TEST_1_CIPHER, data, TEST_1_CIPHER_LEN) == 0);
+    }
+}
 
 Test *tests_crypto_modes_ctr_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_modes_ctr_encrypt),
-        new_TestFixture(test_crypto_modes_ctr_decrypt)
+        new_TestFixture(test_crypto_modes_ctr_decrypt),
+        new_TestFixture(test_crypto_modes_ctr_incremental),
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ctr_tests, NULL, NULL, fixtures);
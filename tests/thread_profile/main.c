@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Thread profiling test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "irq.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_profile.h"
+
+#define WAKEUPS             (10U)
+#define CRITICAL_LOOPS      (10000U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static volatile unsigned _runs;
+static uint8_t _dump[THREAD_PROFILE_DUMP_SIZE_MAX];
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        _runs++;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("thread profile test");
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST, _worker, NULL,
+                                     "worker");
+
+    thread_profile_reset();
+
+    /* the worker has a higher priority, so it runs right away */
+    for (unsigned i = 0; i < WAKEUPS; i++) {
+        expect(thread_wakeup(pid) == 1);
+    }
+    expect(_runs == WAKEUPS);
+
+    /* a critical section of a known length */
+    unsigned state = irq_disable();
+    for (volatile unsigned i = 0; i < CRITICAL_LOOPS; i++) {}
+    irq_restore(state);
+
+    const thread_profile_t *worker = thread_profile_get(pid);
+    unsigned latencies = 0;
+    for (unsigned i = 0; i < CONFIG_THREAD_PROFILE_HIST_BUCKETS; i++) {
+        latencies += worker->latency.buckets[i];
+    }
+    expect(worker->schedules == WAKEUPS);
+    expect(latencies == WAKEUPS);
+    expect(thread_profile_irq_get()->hist.max > 0);
+
+    thread_profile_print();
+
+    ssize_t len = thread_profile_dump(_dump, sizeof(_dump));
+    expect(len > 0);
+    printf("dump %" PRIkernel_pid ": ", pid);
+    for (ssize_t i = 0; i < len; i++) {
+        printf("%02x", _dump[i]);
+    }
+    puts("");
+
+    puts("SUCCESS");
+    return 0;
+}
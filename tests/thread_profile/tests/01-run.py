@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import struct
+import sys
+from testrunner import run
+
+WAKEUPS = 10
+MAGIC = 0x46525054
+
+
+def parse_dump(data):
+    magic, version, buckets, records, ticks_per_sec = \
+        struct.unpack_from("<IBBHI", data)
+    assert magic == MAGIC
+    assert version == 1
+    assert ticks_per_sec > 0
+    offset = 12
+    threads = {}
+    for _ in range(records):
+        pid, _, schedules, runtime, lat_max = \
+            struct.unpack_from("<HHIQI", data, offset)
+        offset += 20
+        hist = struct.unpack_from("<{}I".format(buckets), data, offset)
+        offset += 4 * buckets
+        threads[pid] = (schedules, runtime, lat_max, hist)
+    longest_pid, _, longest, irq_max = struct.unpack_from("<HHQI", data, offset)
+    offset += 16
+    irq_hist = struct.unpack_from("<{}I".format(buckets), data, offset)
+    offset += 4 * buckets
+    assert offset == len(data)
+    return threads, (longest_pid, longest, irq_max, irq_hist)
+
+
+def testfunc(child):
+    child.expect_exact("thread profile test")
+    child.expect(r"\s+(\d+) \| worker\s+\|\s+\d+ \|\s+[\d.]+% \|\s+(\d+) \|")
+    assert int(child.match.group(2)) == WAKEUPS
+    child.expect(r"irq off max: \d+ us \((\d+) ticks\)")
+    assert int(child.match.group(1)) > 0
+    child.expect(r"dump (\d+): ([0-9a-f]+)\r?\n")
+    worker = int(child.match.group(1))
+    threads, irq = parse_dump(bytes.fromhex(child.match.group(2)))
+    schedules, runtime, lat_max, hist = threads[worker]
+    assert schedules == WAKEUPS
+    assert sum(hist) == WAKEUPS
+    assert lat_max > 0 or hist[0] == WAKEUPS
+    assert irq[2] > 0 and sum(irq[3]) > 0
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -11,6 +11,7 @@
 #include "embUnit/embUnit.h"
 
 #include "checksum/crc16_ccitt.h"
+#include "checksum/ucrc16.h"
 
 #include "tests-checksum.h"
 
@@ -88,6 +89,28 @@ static void test_checksum_crc16_ccitt_sequence_4bytes(void)
                 sizeof(buf) / 2, expect));
 }
 
+static void test_checksum_crc16_ccitt_lengths(void)
+{
+    unsigned char buf[67];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 37 + 11;
+    }
+
+    /* compare against the bitwise implementation for all lengths and
+     * alignments the sliced implementation distinguishes */
+    for (unsigned off = 0; off < 8; off++) {
+        for (unsigned len = 0; len <= sizeof(buf) - off; len++) {
+            uint16_t expect = ucrc16_calc_be(buf + off, len,
+                                             UCRC16_CCITT_POLY_BE, 0x1D0F);
+
+            TEST_ASSERT(calc_and_compare_crc(buf + off, len, expect));
+            TEST_ASSERT(calc_and_compare_crc_with_update(buf + off, len,
+                        len / 3, expect));
+        }
+    }
+}
+
 Test *tests_checksum_crc16_ccitt_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -98,6 +121,7 @@ Test *tests_checksum_crc16_ccitt_tests(void)
         new_TestFixture(test_checksum_crc16_ccitt_sequence_256a),
         new_TestFixture(test_checksum_crc16_ccitt_sequence_1to9),
         new_TestFixture(test_checksum_crc16_ccitt_sequence_4bytes),
+        new_TestFixture(test_checksum_crc16_ccitt_lengths),
     };
 
     EMB_UNIT_TESTCALLER(checksum_crc16_ccitt_tests, NULL, NULL, fixtures);
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdint.h>
+
+#include "embUnit/embUnit.h"
+
+#include "checksum/crc32.h"
+
+#include "tests-checksum.h"
+
+/* bitwise reference implementation */
+static uint32_t _crc32_ref(uint32_t poly, const uint8_t *buf, size_t len)
+{
+    uint32_t crc = 0xffffffff;
+
+    while (len--) {
+        crc ^= *buf++;
+        for (unsigned i = 0; i < 8; i++) {
+            crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+static void test_checksum_crc32_check_value(void)
+{
+    static const char buf[] = "123456789";
+
+    TEST_ASSERT_EQUAL_INT(0xcbf43926, crc32_ieee_calc(buf, sizeof(buf) - 1));
+    TEST_ASSERT_EQUAL_INT(0xe3069283, crc32c_calc(buf, sizeof(buf) - 1));
+    TEST_ASSERT_EQUAL_INT(0, crc32_ieee_calc(buf, 0));
+    TEST_ASSERT_EQUAL_INT(0, crc32c_calc(buf, 0));
+}
+
+static void test_checksum_crc32_update(void)
+{
+    uint8_t buf[67];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 37 + 11;
+    }
+
+    /* all lengths, offsets and split points hit every path of the
+     * sliced implementation */
+    for (unsigned off = 0; off < 8; off++) {
+        for (unsigned len = 0; len <= sizeof(buf) - off; len += 5) {
+            uint32_t ieee = _crc32_ref(0xedb88320, buf + off, len);
+            uint32_t c = _crc32_ref(0x82f63b78, buf + off, len);
+
+            TEST_ASSERT_EQUAL_INT(ieee, crc32_ieee_calc(buf + off, len));
+            TEST_ASSERT_EQUAL_INT(c, crc32c_calc(buf + off, len));
+
+            unsigned split = len / 3;
+            uint32_t crc = crc32_ieee_calc(buf + off, split);
+            TEST_ASSERT_EQUAL_INT(ieee, crc32_ieee_update(crc, buf + off + split,
+                                                          len - split));
+            crc = crc32c_calc(buf + off, split);
+            TEST_ASSERT_EQUAL_INT(c, crc32c_update(crc, buf + off + split,
+                                                   len - split));
+        }
+    }
+}
+
+Test *tests_checksum_crc32_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_checksum_crc32_check_value),
+        new_TestFixture(test_checksum_crc32_update),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc32_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc32_tests;
+}
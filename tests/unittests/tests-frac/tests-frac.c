@@ -141,10 +141,52 @@ static void test_frac_scale32(void)
     }
 }
 
+static const uint64_t u64_test_values[] = {
+    0ull,
+    1ull,
+    0xffffffffull,
+    0x100000000ull,
+    0x123456789ull,
+    1000000000000ull,
+    0x123456789abcdull,
+    0xfffffffffffffull,
+};
+
+#define N_U64_VALS ARRAY_SIZE(u64_test_values)
+
+static void test_frac_scale64(void)
+{
+    for (unsigned k = 0; k < N_U32_OPERANDS; ++k) {
+        for (unsigned j = 0; j < N_U32_OPERANDS; ++j) {
+            uint32_t num = u32_fraction_operands[j];
+            uint32_t den = u32_fraction_operands[k];
+            if (num > den) {
+                /* the result would overflow */
+                continue;
+            }
+            frac_t frac;
+            frac_init(&frac, num, den);
+            for (unsigned i = 0; i < N_U64_VALS; i++) {
+                uint64_t x = u64_test_values[i];
+                uint64_t expected = (x / den) * num + ((x % den) * num) / den;
+                uint64_t actual = frac_scale64(&frac, x);
+
+                /* frac is rounded up to 32 bit, the error grows with x */
+                TEST_ASSERT(actual >= expected);
+                TEST_ASSERT(actual - expected <= (x >> (frac.shift - 1)) + 1);
+                if (x <= UINT32_MAX) {
+                    TEST_ASSERT_EQUAL_INT(frac_scale(&frac, x), actual);
+                }
+            }
+        }
+    }
+}
+
 Test *tests_frac_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_frac_scale32),
+        new_TestFixture(test_frac_scale64),
     };
 
     EMB_UNIT_TESTCALLER(frac_tests, NULL, NULL, fixtures);
@@ -13,18 +13,89 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <string.h>
+
 #include "embUnit.h"
 
 #include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
 
 #include "tests-gnrc_netif_pktq.h"
 
-gnrc_netif_t _netif;
+#define TEST_HDR_SIZE   (sizeof(gnrc_netif_hdr_t) + 2)
+#define TEST_IP_SIZE    (sizeof(ipv6_hdr_t) + 8)
+
+typedef struct {
+    gnrc_pktsnip_t netif;
+    gnrc_pktsnip_t ip;
+    uint8_t netif_hdr[TEST_HDR_SIZE];
+    uint8_t ip_data[TEST_IP_SIZE];
+} _ip_pkt_t;
+
+static gnrc_pktsnip_t *_aggregate(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                                  gnrc_pktsnip_t *next);
+
+static const gnrc_netif_ops_t _ops = {
+    .aggregate = _aggregate,
+};
+static unsigned _aggregate_count;
+static unsigned _aggregate_max;
+
+gnrc_netif_t _netif = { .ops = &_ops };
+
+static gnrc_pktsnip_t *_aggregate(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                                  gnrc_pktsnip_t *next)
+{
+    (void)netif;
+    (void)next;
+    if (_aggregate_count >= _aggregate_max) {
+        return NULL;
+    }
+    _aggregate_count++;
+    return pkt;
+}
+
+static void _init_pkt(gnrc_pktsnip_t *pkt, uint8_t *hdr, uint8_t dst)
+{
+    const uint8_t addr[] = { 0x00, dst };
+
+    gnrc_netif_hdr_init((gnrc_netif_hdr_t *)hdr, 0, sizeof(addr));
+    gnrc_netif_hdr_set_dst_addr((gnrc_netif_hdr_t *)hdr, addr, sizeof(addr));
+    memset(pkt, 0, sizeof(*pkt));
+    pkt->data = hdr;
+    pkt->size = TEST_HDR_SIZE;
+    pkt->type = GNRC_NETTYPE_NETIF;
+}
+
+/* an IPv6 packet, of the control class with nh == PROTNUM_ICMPV6 */
+static gnrc_pktsnip_t *_init_ip_pkt(_ip_pkt_t *pkt, uint8_t dst, uint8_t nh)
+{
+    ipv6_hdr_t *hdr = (ipv6_hdr_t *)pkt->ip_data;
+
+    _init_pkt(&pkt->netif, pkt->netif_hdr, dst);
+    memset(&pkt->ip, 0, sizeof(pkt->ip));
+    memset(pkt->ip_data, 0, sizeof(pkt->ip_data));
+    ipv6_hdr_set_version(hdr);
+    hdr->nh = nh;
+    pkt->ip.data = pkt->ip_data;
+    pkt->ip.size = sizeof(pkt->ip_data);
+    pkt->ip.type = GNRC_NETTYPE_IPV6;
+    pkt->netif.next = &pkt->ip;
+    return &pkt->netif;
+}
 
 static void set_up(void)
 {
     while (gnrc_netif_pktq_get(&_netif)) { }
+    memset(&_netif.send_queue.stats, 0, sizeof(_netif.send_queue.stats));
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    memset(&_netif.send_queue.fq, 0, sizeof(_netif.send_queue.fq));
+#endif
+    _aggregate_count = 0;
+    _aggregate_max = 0;
 }
 
 static void test_pktq_get__empty(void)
@@ -39,12 +110,14 @@ static void test_pktq_usage__empty(void)
 
 static void test_pktq_put__full(void)
 {
-    gnrc_pktsnip_t pkt;
+    _ip_pkt_t pkt;
 
+    /* of the control class, so no flow limit applies */
+    _init_ip_pkt(&pkt, 1, PROTNUM_ICMPV6);
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
-        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt));
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt.netif));
     }
-    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_put(&_netif, &pkt));
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_put(&_netif, &pkt.netif));
     TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE,
                           gnrc_netif_pktq_usage());
 }
@@ -52,7 +125,9 @@ static void test_pktq_put__full(void)
 static void test_pktq_put_get1(void)
 {
     gnrc_pktsnip_t pkt_in, *pkt_out;
+    uint8_t hdr[TEST_HDR_SIZE];
 
+    _init_pkt(&pkt_in, hdr, 1);
     TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in));
     TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage());
     TEST_ASSERT_NOT_NULL((pkt_out = gnrc_netif_pktq_get(&_netif)));
@@ -63,8 +138,10 @@ static void test_pktq_put_get1(void)
 static void test_pktq_put_get3(void)
 {
     gnrc_pktsnip_t pkt_in[3];
+    uint8_t hdr[3][TEST_HDR_SIZE];
 
     for (unsigned i = 0; i < 3; i++) {
+        _init_pkt(&pkt_in[i], hdr[i], 1);
         TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in[i]));
     }
     TEST_ASSERT_EQUAL_INT(3, gnrc_netif_pktq_usage());
@@ -79,12 +156,13 @@ static void test_pktq_put_get3(void)
 
 static void test_pktq_push_back__full(void)
 {
-    gnrc_pktsnip_t pkt;
+    _ip_pkt_t pkt;
 
+    _init_ip_pkt(&pkt, 1, PROTNUM_ICMPV6);
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
-        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt));
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt.netif));
     }
-    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_push_back(&_netif, &pkt));
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_push_back(&_netif, &pkt.netif));
     TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE,
                           gnrc_netif_pktq_usage());
 }
@@ -92,7 +170,9 @@ static void test_pktq_push_back__full(void)
 static void test_pktq_push_back_get1(void)
 {
     gnrc_pktsnip_t pkt_in, *pkt_out;
+    uint8_t hdr[TEST_HDR_SIZE];
 
+    _init_pkt(&pkt_in, hdr, 1);
     TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, &pkt_in));
     TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage());
     TEST_ASSERT_NOT_NULL((pkt_out = gnrc_netif_pktq_get(&_netif)));
@@ -103,8 +183,10 @@ static void test_pktq_push_back_get1(void)
 static void test_pktq_push_back_get3(void)
 {
     gnrc_pktsnip_t pkt_in[3];
+    uint8_t hdr[3][TEST_HDR_SIZE];
 
     for (unsigned i = 0; i < 3; i++) {
+        _init_pkt(&pkt_in[i], hdr[i], 1);
         TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, &pkt_in[i]));
     }
     TEST_ASSERT_EQUAL_INT(3, gnrc_netif_pktq_usage());
@@ -120,7 +202,9 @@ static void test_pktq_push_back_get3(void)
 static void test_pktq_empty(void)
 {
     gnrc_pktsnip_t pkt_in;
+    uint8_t hdr[TEST_HDR_SIZE];
 
+    _init_pkt(&pkt_in, hdr, 1);
     TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
     TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in));
     TEST_ASSERT(!gnrc_netif_pktq_empty(&_netif));
@@ -132,6 +216,154 @@ static void test_pktq_empty(void)
     TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
 }
 
+static void test_pktq_stats(void)
+{
+    gnrc_pktsnip_t pkt_in[3];
+    uint8_t hdr[3][TEST_HDR_SIZE];
+
+    for (unsigned i = 0; i < 3; i++) {
+        _init_pkt(&pkt_in[i], hdr[i], 1);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(3, _netif.send_queue.stats.queued);
+    TEST_ASSERT_EQUAL_INT(3, _netif.send_queue.stats.depth);
+    TEST_ASSERT_NOT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_NOT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(1, _netif.send_queue.stats.depth);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, &pkt_in[1]));
+    TEST_ASSERT_EQUAL_INT(3, _netif.send_queue.stats.queued);
+    TEST_ASSERT_EQUAL_INT(2, _netif.send_queue.stats.depth);
+    TEST_ASSERT_EQUAL_INT(3, _netif.send_queue.stats.depth_max);
+}
+
+static void test_pktq_coalesce(void)
+{
+    gnrc_pktsnip_t pkt_in[4], *pkt_out;
+    uint8_t hdr[4][TEST_HDR_SIZE];
+    const uint8_t dst[] = { 1, 1, 1, 2 };
+
+    for (unsigned i = 0; i < 4; i++) {
+        _init_pkt(&pkt_in[i], hdr[i], dst[i]);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in[i]));
+    }
+    _aggregate_max = 4;
+    TEST_ASSERT_NOT_NULL((pkt_out = gnrc_netif_pktq_get(&_netif)));
+    TEST_ASSERT(&pkt_in[0] == gnrc_netif_pktq_coalesce(&_netif, pkt_out));
+    /* only packets to the same destination are coalesced */
+    TEST_ASSERT_EQUAL_INT(2, _aggregate_count);
+    TEST_ASSERT_EQUAL_INT(2, _netif.send_queue.stats.coalesced);
+    TEST_ASSERT_EQUAL_INT(1, _netif.send_queue.stats.depth);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage());
+    TEST_ASSERT(&pkt_in[3] == gnrc_netif_pktq_get(&_netif));
+}
+
+static void test_pktq_coalesce__rejected(void)
+{
+    gnrc_pktsnip_t pkt_in[2], *pkt_out;
+    uint8_t hdr[2][TEST_HDR_SIZE];
+
+    for (unsigned i = 0; i < 2; i++) {
+        _init_pkt(&pkt_in[i], hdr[i], 1);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in[i]));
+    }
+    TEST_ASSERT_NOT_NULL((pkt_out = gnrc_netif_pktq_get(&_netif)));
+    TEST_ASSERT(&pkt_in[0] == gnrc_netif_pktq_coalesce(&_netif, pkt_out));
+    TEST_ASSERT_EQUAL_INT(0, _netif.send_queue.stats.coalesced);
+    TEST_ASSERT_EQUAL_INT(1, _netif.send_queue.stats.depth);
+    TEST_ASSERT(&pkt_in[1] == gnrc_netif_pktq_get(&_netif));
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+static void test_pktq_fq_control_first(void)
+{
+    _ip_pkt_t bulk[2], control[2];
+
+    for (unsigned i = 0; i < 2; i++) {
+        _init_ip_pkt(&bulk[i], 1, PROTNUM_UDP);
+        _init_ip_pkt(&control[i], 1, PROTNUM_ICMPV6);
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &bulk[0].netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &control[0].netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &bulk[1].netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &control[1].netif));
+    /* control packets overtake bulk packets, but keep their own order */
+    TEST_ASSERT(&control[0].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&control[1].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&bulk[0].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&bulk[1].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(2, _netif.send_queue.fq.stats[GNRC_NETIF_PKTQ_FQ_CONTROL].packets);
+    TEST_ASSERT_EQUAL_INT(2, _netif.send_queue.fq.stats[GNRC_NETIF_PKTQ_FQ_BULK].packets);
+}
+
+static void test_pktq_fq_round_robin(void)
+{
+    _ip_pkt_t a[3], b[2];
+
+    /* destinations 1 and 2 hash into different flows */
+    for (unsigned i = 0; i < 3; i++) {
+        _init_ip_pkt(&a[i], 1, PROTNUM_UDP);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &a[i].netif));
+    }
+    for (unsigned i = 0; i < 2; i++) {
+        _init_ip_pkt(&b[i], 2, PROTNUM_UDP);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &b[i].netif));
+    }
+    /* flows of packets of the same size alternate */
+    TEST_ASSERT(&a[0].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&b[0].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&a[1].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&b[1].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&a[2].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+}
+
+static void test_pktq_fq_flow_limit(void)
+{
+    _ip_pkt_t a[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT + 1], b, control;
+
+    TEST_ASSERT(CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT + 2 <=
+                CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE);
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT; i++) {
+        _init_ip_pkt(&a[i], 1, PROTNUM_UDP);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &a[i].netif));
+    }
+    _init_ip_pkt(&a[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT], 1, PROTNUM_UDP);
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_put(
+        &_netif, &a[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT].netif));
+    /* other flows and control packets are still queued */
+    _init_ip_pkt(&b, 2, PROTNUM_UDP);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &b.netif));
+    _init_ip_pkt(&control, 1, PROTNUM_ICMPV6);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &control.netif));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT + 2,
+                          gnrc_netif_pktq_usage());
+    /* the flow takes packets again once one was sent */
+    TEST_ASSERT(&control.netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&a[0].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(
+        &_netif, &a[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOW_LIMIT].netif));
+}
+
+static void test_pktq_fq_push_back(void)
+{
+    _ip_pkt_t bulk[2], control;
+
+    for (unsigned i = 0; i < 2; i++) {
+        _init_ip_pkt(&bulk[i], 1, PROTNUM_UDP);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &bulk[i].netif));
+    }
+    _init_ip_pkt(&control, 1, PROTNUM_ICMPV6);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &control.netif));
+    TEST_ASSERT(&control.netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&bulk[0].netif == gnrc_netif_pktq_get(&_netif));
+    /* a packet pushed back is sent next, whatever its class */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, &bulk[0].netif));
+    TEST_ASSERT(&bulk[0].netif == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(&bulk[1].netif == gnrc_netif_pktq_get(&_netif));
+}
+#endif
+
 static Test *test_gnrc_netif_pktq(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -144,6 +376,15 @@ static Test *test_gnrc_netif_pktq(void)
         new_TestFixture(test_pktq_push_back_get1),
         new_TestFixture(test_pktq_push_back_get3),
         new_TestFixture(test_pktq_empty),
+        new_TestFixture(test_pktq_stats),
+        new_TestFixture(test_pktq_coalesce),
+        new_TestFixture(test_pktq_coalesce__rejected),
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+        new_TestFixture(test_pktq_fq_control_first),
+        new_TestFixture(test_pktq_fq_round_robin),
+        new_TestFixture(test_pktq_fq_flow_limit),
+        new_TestFixture(test_pktq_fq_push_back),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(pktq_tests, set_up, NULL, fixtures);
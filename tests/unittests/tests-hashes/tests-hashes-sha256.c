@@ -266,6 +266,46 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_multi(void)
+{
+    static const char *teststrings[] = {
+        "0123456789abcde-0123456789abcde-0123456789abcde-0123456789abcde-"
+        "0123456789abcde-0123456789abcde-0123456789abcde-0123456789abcde-",
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopqabcdbcde"
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopqabcdbcde",
+        "Franz jagt im komplett verwahrlosten Taxi quer durch Bayern....."
+        "Frank jagt im komplett verwahrlosten Taxi quer durch Bayern.....",
+    };
+    static unsigned char hashes[3][SHA256_DIGEST_LENGTH];
+    unsigned char expected[SHA256_DIGEST_LENGTH];
+    void *digests[] = { hashes[0], hashes[1], hashes[2] };
+    const void *data[] = { teststrings[0], teststrings[1], teststrings[2] };
+
+    /* equal length buffers, hashed in one go */
+    sha256_multi(data, 128, digests, 3);
+    for (unsigned i = 0; i < 3; i++) {
+        sha256(teststrings[i], 128, expected);
+        TEST_ASSERT(memcmp(expected, hashes[i], SHA256_DIGEST_LENGTH) == 0);
+    }
+
+    /* and in pieces via the streaming interface */
+    sha256_context_t ctx[3];
+    sha256_context_t *ctxs[] = { &ctx[0], &ctx[1], &ctx[2] };
+    for (unsigned i = 0; i < 3; i++) {
+        sha256_init(&ctx[i]);
+    }
+    sha256_update_multi(ctxs, data, 64, 3);
+    for (unsigned i = 0; i < 3; i++) {
+        data[i] = teststrings[i] + 64;
+    }
+    sha256_update_multi(ctxs, data, 64, 3);
+    for (unsigned i = 0; i < 3; i++) {
+        sha256_final(&ctx[i], hashes[i]);
+        sha256(teststrings[i], 128, expected);
+        TEST_ASSERT(memcmp(expected, hashes[i], SHA256_DIGEST_LENGTH) == 0);
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -284,6 +324,8 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_multi),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
@@ -12,6 +12,7 @@
  * @file
  */
 #include <errno.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
 #include "embUnit.h"
@@ -165,6 +166,50 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* straightforward byte-wise implementation to compare against */
+static uint16_t _reference(uint16_t sum, const uint8_t *buf, uint16_t len,
+                           size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (uint16_t i = 0; i < len; i++, accum_len++) {
+        csum += (accum_len & 1) ? buf[i] : (uint16_t)(buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint32_t _rand(void)
+{
+    static uint32_t state = 0x2f6b6d59;
+
+    state = state * 1103515245 + 12345;
+    return state >> 8;
+}
+
+static void test_inet_csum__reference(void)
+{
+    static uint8_t data[520];
+
+    for (unsigned round = 0; round < 2000; round++) {
+        /* all ones maximizes carries */
+        bool ones = (round % 8) == 0;
+        for (unsigned i = 0; i < sizeof(data); i++) {
+            data[i] = ones ? 0xff : _rand();
+        }
+
+        unsigned offset = _rand() % 8;
+        uint16_t len = _rand() % (sizeof(data) - offset + 1);
+        uint16_t sum = (round & 1) ? _rand() : 0;
+        size_t accum_len = _rand() % 2;
+
+        TEST_ASSERT_EQUAL_INT(_reference(sum, data + offset, len, accum_len),
+                              inet_csum_slice(sum, data + offset, len, accum_len));
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +221,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__reference),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
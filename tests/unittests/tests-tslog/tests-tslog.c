@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "tslog.h"
+
+#include "tests-tslog.h"
+
+/* Test mock object implementing a simple RAM-based NOR flash */
+#define SECTOR_COUNT    (4U)
+#define PAGE_PER_SECTOR (2U)
+#define PAGE_SIZE       (64U)
+#define SECTOR_SIZE     (PAGE_SIZE * PAGE_PER_SECTOR)
+
+/* 24 bytes per record, 4 records per sector */
+#define PAYLOAD_SIZE        (13U)
+#define RECORDS_PER_SECTOR  ((SECTOR_SIZE - TSLOG_SECTOR_HDR_SIZE) / \
+                             TSLOG_RECORD_SIZE(PAYLOAD_SIZE))
+
+static uint8_t _memory[SECTOR_SIZE * SECTOR_COUNT];
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    if (size > dev->page_size - offset) {
+        size = dev->page_size - offset;
+    }
+    memcpy(buff, _memory + page * dev->page_size + offset, size);
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    const uint8_t *in = buff;
+    uint8_t *out = _memory + page * dev->page_size + offset;
+
+    if (size > dev->page_size - offset) {
+        size = dev->page_size - offset;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        out[i] &= in[i];
+    }
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    (void)dev;
+
+    memset(_memory + sector * SECTOR_SIZE, 0xff, count * SECTOR_SIZE);
+    return 0;
+}
+
+static const mtd_desc_t _driver = {
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static tslog_t _log;
+
+static int _append(uint32_t time)
+{
+    uint8_t data[PAYLOAD_SIZE];
+
+    memset(data, time, sizeof(data));
+    return tslog_append(&_log, time, data, sizeof(data));
+}
+
+static void _check(tslog_pos_t *pos, uint32_t time)
+{
+    uint8_t data[PAYLOAD_SIZE];
+    uint32_t t;
+
+    TEST_ASSERT_EQUAL_INT(PAYLOAD_SIZE,
+                          tslog_read(&_log, pos, &t, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(time, t);
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        TEST_ASSERT_EQUAL_INT(time & 0xff, data[i]);
+    }
+}
+
+static void set_up(void)
+{
+    memset(_memory, 0xff, sizeof(_memory));
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, &_dev, 0, SECTOR_COUNT));
+}
+
+static void test_tslog_empty(void)
+{
+    tslog_pos_t pos;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_seek(&_log, &pos, 0));
+}
+
+static void test_tslog_append_read(void)
+{
+    tslog_pos_t pos;
+
+    for (uint32_t t = 1; t <= 6; t++) {
+        TEST_ASSERT_EQUAL_INT(0, _append(t * 10));
+    }
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _append(10));
+
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, 0));
+    for (uint32_t t = 1; t <= 6; t++) {
+        _check(&pos, t * 10);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_read(&_log, &pos, NULL, NULL, 0));
+
+    /* new records show up at the end */
+    TEST_ASSERT_EQUAL_INT(0, _append(70));
+    _check(&pos, 70);
+}
+
+static void test_tslog_seek(void)
+{
+    tslog_pos_t pos;
+
+    /* wrap around the ring a few times */
+    uint32_t records = 3 * SECTOR_COUNT * RECORDS_PER_SECTOR;
+    for (uint32_t t = 1; t <= records; t++) {
+        TEST_ASSERT_EQUAL_INT(0, _append(t * 2));
+    }
+
+    /* only the newest sectors are kept */
+    uint32_t oldest = records - SECTOR_COUNT * RECORDS_PER_SECTOR + 1;
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, 0));
+    _check(&pos, oldest * 2);
+
+    /* exact and in between matches */
+    for (uint32_t t = oldest; t <= records; t++) {
+        TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, t * 2));
+        _check(&pos, t * 2);
+        TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, t * 2 - 1));
+        _check(&pos, t * 2);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_seek(&_log, &pos, records * 2 + 1));
+}
+
+static void test_tslog_recover(void)
+{
+    tslog_pos_t pos;
+
+    for (uint32_t t = 1; t <= RECORDS_PER_SECTOR + 2; t++) {
+        TEST_ASSERT_EQUAL_INT(0, _append(t));
+    }
+
+    /* reopen and continue */
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, &_dev, 0, SECTOR_COUNT));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _append(1));
+    TEST_ASSERT_EQUAL_INT(0, _append(RECORDS_PER_SECTOR + 3));
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, 0));
+    for (uint32_t t = 1; t <= RECORDS_PER_SECTOR + 3; t++) {
+        _check(&pos, t);
+    }
+
+    /* simulate a torn write: payload programmed, header missing */
+    uint32_t end = SECTOR_SIZE + TSLOG_SECTOR_HDR_SIZE
+                 + 3 * TSLOG_RECORD_SIZE(PAYLOAD_SIZE);
+    _memory[end + TSLOG_RECORD_HDR_SIZE] = 0x00;
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, &_dev, 0, SECTOR_COUNT));
+
+    /* the rest of the sector is skipped */
+    TEST_ASSERT_EQUAL_INT(0, _append(100));
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, RECORDS_PER_SECTOR + 3));
+    _check(&pos, RECORDS_PER_SECTOR + 3);
+    _check(&pos, 100);
+    TEST_ASSERT_EQUAL_INT(2, pos.sector);
+
+    /* a corrupted record ends its sector */
+    _memory[TSLOG_SECTOR_HDR_SIZE + TSLOG_RECORD_SIZE(PAYLOAD_SIZE)
+            + TSLOG_RECORD_HDR_SIZE] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, 2));
+    _check(&pos, RECORDS_PER_SECTOR + 1);
+}
+
+static void test_tslog_recover_sector_hdr(void)
+{
+    tslog_pos_t pos;
+
+    for (uint32_t t = 1; t <= RECORDS_PER_SECTOR; t++) {
+        TEST_ASSERT_EQUAL_INT(0, _append(t));
+    }
+
+    /* simulate a torn sector header: magic and sequence number programmed,
+     * time stamp missing */
+    static const uint8_t hdr[] = { 0x47, 0x4c, 0x53, 0x54, 0x02, 0x00, 0x00, 0x00 };
+    memcpy(_memory + SECTOR_SIZE, hdr, sizeof(hdr));
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, &_dev, 0, SECTOR_COUNT));
+
+    /* the sector is not part of the log */
+    TEST_ASSERT_EQUAL_INT(0, _append(RECORDS_PER_SECTOR + 1));
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, 0));
+    for (uint32_t t = 1; t <= RECORDS_PER_SECTOR + 1; t++) {
+        _check(&pos, t);
+    }
+    TEST_ASSERT_EQUAL_INT(1, pos.sector);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_read(&_log, &pos, NULL, NULL, 0));
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _append(UINT32_MAX));
+}
+
+static void test_tslog_clear(void)
+{
+    tslog_pos_t pos;
+
+    for (uint32_t t = 1; t <= 2 * RECORDS_PER_SECTOR; t++) {
+        TEST_ASSERT_EQUAL_INT(0, _append(t));
+    }
+    TEST_ASSERT_EQUAL_INT(0, tslog_clear(&_log));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_seek(&_log, &pos, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, &_dev, 0, SECTOR_COUNT));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_seek(&_log, &pos, 0));
+    TEST_ASSERT_EQUAL_INT(0, _append(1));
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &pos, 0));
+    _check(&pos, 1);
+}
+
+static void test_tslog_too_large(void)
+{
+    static uint8_t data[SECTOR_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(-EMSGSIZE, tslog_append(&_log, 1, data, sizeof(data)));
+}
+
+static Test *tests_tslog_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_tslog_empty),
+        new_TestFixture(test_tslog_append_read),
+        new_TestFixture(test_tslog_seek),
+        new_TestFixture(test_tslog_recover),
+        new_TestFixture(test_tslog_recover_sector_hdr),
+        new_TestFixture(test_tslog_clear),
+        new_TestFixture(test_tslog_too_large),
+    };
+
+    EMB_UNIT_TESTCALLER(tslog_tests, set_up, NULL, fixtures);
+
+    return (Test *)&tslog_tests;
+}
+
+void tests_tslog(void)
+{
+    TESTS_RUN(tests_tslog_tests());
+}
+/** @} */
@@ -29,12 +29,14 @@
 static uint8_t _tsrb_buffer[BUFFER_SIZE];
 static uint8_t _io_buffer[BUFFER_SIZE * 2];
 static tsrb_t _tsrb = TSRB_INIT(_tsrb_buffer);
+static tsrb_mp_t _tsrb_mp = TSRB_MP_INIT(_tsrb_buffer);
 
 static void tear_down(void)
 {
     memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
     memset(_tsrb_buffer, 0, sizeof(_tsrb_buffer));
     tsrb_init(&_tsrb, _tsrb_buffer, BUFFER_SIZE);
+    tsrb_mp_init(&_tsrb_mp, _tsrb_buffer, BUFFER_SIZE);
 }
 
 static void test_empty(void)
@@ -162,6 +164,107 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move start of data close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_add(&_tsrb, _io_buffer,
+                                                    BUFFER_SIZE - 3));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_drop(&_tsrb, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_reserve_commit(void)
+{
+    uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_reserve(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    data[0] = TEST_INPUT;
+    data[1] = TEST_INPUT + 1;
+    tsrb_commit(&_tsrb, 2);
+    TEST_ASSERT_EQUAL_INT(2, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, tsrb_get_one(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + 1, tsrb_get_one(&_tsrb));
+
+    /* only the space up to the end of the buffer is returned */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 2, tsrb_reserve(&_tsrb, &data));
+    TEST_ASSERT(data == &_tsrb_buffer[2]);
+    tsrb_commit(&_tsrb, BUFFER_SIZE - 2);
+    TEST_ASSERT_EQUAL_INT(2, tsrb_reserve(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    tsrb_commit(&_tsrb, 2);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_reserve(&_tsrb, &data));
+}
+
+static void test_peek_consume(void)
+{
+    const uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek(&_tsrb, &data));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_peek(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    tsrb_consume(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, tsrb_avail(&_tsrb));
+
+    /* only the bytes up to the end of the buffer are returned */
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_add(&_tsrb, _io_buffer,
+                                                  sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_peek(&_tsrb, &data));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + TEST_DROP_NUM, data[0]);
+    tsrb_consume(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_peek(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    tsrb_consume(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_mp_add(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    TEST_ASSERT_EQUAL_INT(0, tsrb_mp_add(&_tsrb_mp, _io_buffer, 0));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_mp_add(&_tsrb_mp, _io_buffer,
+                                                     TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_avail(&_tsrb_mp.rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_mp_add(&_tsrb_mp, &_io_buffer[TEST_DROP_NUM],
+                                      sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb_mp.rb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_mp_add(&_tsrb_mp, _io_buffer, 1));
+
+    /* wrap around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1, tsrb_drop(&_tsrb_mp.rb,
+                                                     BUFFER_SIZE - 1));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1, tsrb_mp_add(&_tsrb_mp, _io_buffer,
+                                                       sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb_mp.rb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + BUFFER_SIZE - 1),
+                          _io_buffer[0]);
+    for (int i = 1; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i - 1), _io_buffer[i]);
+    }
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -174,6 +277,10 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_reserve_commit),
+        new_TestFixture(test_peek_consume),
+        new_TestFixture(test_mp_add),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
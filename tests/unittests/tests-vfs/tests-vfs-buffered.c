@@ -0,0 +1,307 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief Unit tests of the vfs_buffered read-ahead/write-back layer
+ *
+ * The file system used here keeps a single file in RAM and counts the writes
+ * reaching the driver, so the tests can tell what is still buffered.
+ */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "embUnit/embUnit.h"
+
+#include "vfs.h"
+
+#include "tests-vfs.h"
+
+/* small enough to cross several buffer boundaries in each test */
+#define TEST_BUF_SIZE   (16U)
+#define RAM_FILE_SIZE   (128U)
+
+static uint8_t _ram_file[RAM_FILE_SIZE];
+static size_t _ram_file_len;
+static unsigned _ram_writes;
+static uint8_t _pattern[RAM_FILE_SIZE];
+
+static int _ram_fstat(vfs_file_t *filp, struct stat *buf)
+{
+    (void)filp;
+    memset(buf, 0, sizeof(*buf));
+    buf->st_size = _ram_file_len;
+    return 0;
+}
+
+static ssize_t _ram_read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    if ((size_t)filp->pos >= _ram_file_len) {
+        return 0;
+    }
+    if (nbytes > _ram_file_len - filp->pos) {
+        nbytes = _ram_file_len - filp->pos;
+    }
+    memcpy(dest, &_ram_file[filp->pos], nbytes);
+    filp->pos += nbytes;
+    return nbytes;
+}
+
+static ssize_t _ram_write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    if (filp->flags & O_APPEND) {
+        filp->pos = _ram_file_len;
+    }
+    if ((size_t)filp->pos + nbytes > RAM_FILE_SIZE) {
+        return -ENOSPC;
+    }
+    memcpy(&_ram_file[filp->pos], src, nbytes);
+    filp->pos += nbytes;
+    if ((size_t)filp->pos > _ram_file_len) {
+        _ram_file_len = filp->pos;
+    }
+    _ram_writes++;
+    return nbytes;
+}
+
+static const vfs_file_ops_t ram_file_ops = {
+    .fstat = _ram_fstat,
+    .read  = _ram_read,
+    .write = _ram_write,
+};
+
+static const vfs_file_system_t ram_file_system = {
+    .f_op = &ram_file_ops,
+};
+
+static vfs_mount_t _test_vfs_mount_ram = {
+    .mount_point = "/test",
+    .fs = &ram_file_system,
+    .private_data = NULL,
+};
+
+static void setup(void)
+{
+    for (unsigned i = 0; i < sizeof(_pattern); i++) {
+        _pattern[i] = i * 7 + 1;
+    }
+    memset(_ram_file, 0, sizeof(_ram_file));
+    _ram_file_len = 0;
+    _ram_writes = 0;
+    vfs_mount(&_test_vfs_mount_ram);
+}
+
+static void teardown(void)
+{
+    vfs_umount(&_test_vfs_mount_ram);
+}
+
+static int _open_buffered(int flags)
+{
+    int fd = vfs_open("/test/file", flags, 0);
+    if ((fd >= 0) && (vfs_buffer_attach(fd, TEST_BUF_SIZE) < 0)) {
+        vfs_close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void _prefill(size_t len)
+{
+    memcpy(_ram_file, _pattern, len);
+    _ram_file_len = len;
+}
+
+static void test_vfs_buffered_attach(void)
+{
+    int fd = vfs_open("/test/file", O_RDWR, 0);
+    TEST_ASSERT(fd >= 0);
+    int res = vfs_buffer_attach(fd, CONFIG_VFS_BUFFER_SIZE + 1);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, res);
+    res = vfs_buffer_attach(fd, 0);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_buffer_attach(fd, 0);
+    TEST_ASSERT_EQUAL_INT(-EALREADY, res);
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_buffer_attach(fd, 0);
+    TEST_ASSERT_EQUAL_INT(-EBADF, res);
+}
+
+static void test_vfs_buffered_write_read_back(void)
+{
+    int fd = _open_buffered(O_WRONLY);
+    TEST_ASSERT(fd >= 0);
+    for (unsigned i = 0; i < 100; i += 5) {
+        ssize_t res = vfs_write(fd, &_pattern[i], 5);
+        TEST_ASSERT_EQUAL_INT(5, res);
+    }
+    /* 20 writes of 5 bytes through a 16 byte buffer */
+    TEST_ASSERT_EQUAL_INT(6, _ram_writes);
+    TEST_ASSERT_EQUAL_INT(90, _ram_file_len);
+    /* close writes back the rest */
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(100, _ram_file_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ram_file, _pattern, 100));
+
+    uint8_t data[100];
+    fd = _open_buffered(O_RDONLY);
+    TEST_ASSERT(fd >= 0);
+    for (unsigned i = 0; i < 98; i += 7) {
+        ssize_t res = vfs_read(fd, &data[i], 7);
+        TEST_ASSERT_EQUAL_INT(7, res);
+    }
+    ssize_t res = vfs_read(fd, &data[98], 7);
+    TEST_ASSERT_EQUAL_INT(2, res);
+    res = vfs_read(fd, data, 7);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _pattern, 100));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_buffered_large_transfers(void)
+{
+    int fd = _open_buffered(O_RDWR);
+    TEST_ASSERT(fd >= 0);
+    /* a small write stays buffered, a large one must not overtake it */
+    TEST_ASSERT_EQUAL_INT(3, vfs_write(fd, _pattern, 3));
+    TEST_ASSERT_EQUAL_INT(40, vfs_write(fd, &_pattern[3], 40));
+    TEST_ASSERT_EQUAL_INT(43, _ram_file_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ram_file, _pattern, 43));
+
+    uint8_t data[43];
+    TEST_ASSERT_EQUAL_INT(0, vfs_lseek(fd, 0, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(5, vfs_read(fd, data, 5));
+    /* served from the read-ahead first, the rest directly */
+    TEST_ASSERT_EQUAL_INT(38, vfs_read(fd, &data[5], 38));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _pattern, 43));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_buffered_interleaved(void)
+{
+    static const uint8_t patch[] = { 0xaa, 0xbb, 0xcc };
+    uint8_t expect[64];
+    uint8_t data[20];
+
+    _prefill(64);
+    memcpy(expect, _pattern, 64);
+    int fd = _open_buffered(O_RDWR);
+    TEST_ASSERT(fd >= 0);
+
+    /* the driver reads ahead to 16, the user is at 5 */
+    TEST_ASSERT_EQUAL_INT(5, vfs_read(fd, data, 5));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _pattern, 5));
+
+    /* writing must land at the user's position, not the driver's */
+    TEST_ASSERT_EQUAL_INT(3, vfs_write(fd, patch, sizeof(patch)));
+    memcpy(&expect[5], patch, sizeof(patch));
+    TEST_ASSERT_EQUAL_INT(8, vfs_lseek(fd, 0, SEEK_CUR));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ram_file, expect, 64));
+
+    /* reading across the next buffer boundary */
+    TEST_ASSERT_EQUAL_INT(10, vfs_read(fd, data, 10));
+    TEST_ASSERT_EQUAL_INT(10, vfs_read(fd, &data[10], 10));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, &expect[8], 20));
+    TEST_ASSERT_EQUAL_INT(28, vfs_lseek(fd, 0, SEEK_CUR));
+
+    /* write back over data read earlier, straddling a buffer boundary */
+    TEST_ASSERT_EQUAL_INT(2, vfs_lseek(fd, 2, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(5, vfs_read(fd, data, 5));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, &expect[2], 5));
+    for (unsigned i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_INT(3, vfs_write(fd, patch, sizeof(patch)));
+        memcpy(&expect[7 + 3 * i], patch, sizeof(patch));
+    }
+    TEST_ASSERT_EQUAL_INT(3, vfs_read(fd, data, 3));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, &expect[25], 3));
+    TEST_ASSERT_EQUAL_INT(28, vfs_lseek(fd, 0, SEEK_CUR));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(64, _ram_file_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ram_file, expect, 64));
+}
+
+static void test_vfs_buffered_detach(void)
+{
+    int fd = _open_buffered(O_RDWR);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(10, vfs_write(fd, _pattern, 10));
+    TEST_ASSERT_EQUAL_INT(0, _ram_file_len);
+
+    struct stat st;
+    TEST_ASSERT_EQUAL_INT(0, vfs_fstat(fd, &st));
+    TEST_ASSERT_EQUAL_INT(10, st.st_size);
+
+    TEST_ASSERT_EQUAL_INT(4, vfs_write(fd, &_pattern[10], 4));
+    TEST_ASSERT_EQUAL_INT(10, _ram_file_len);
+    TEST_ASSERT_EQUAL_INT(0, vfs_buffer_detach(fd));
+    TEST_ASSERT_EQUAL_INT(14, _ram_file_len);
+
+    /* unbuffered from here on */
+    TEST_ASSERT_EQUAL_INT(2, vfs_write(fd, &_pattern[14], 2));
+    TEST_ASSERT_EQUAL_INT(16, _ram_file_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ram_file, _pattern, 16));
+
+    /* detaching read-ahead rewinds to the user's position */
+    TEST_ASSERT_EQUAL_INT(0, vfs_lseek(fd, 0, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(0, vfs_buffer_attach(fd, TEST_BUF_SIZE));
+    uint8_t data[4];
+    TEST_ASSERT_EQUAL_INT(4, vfs_read(fd, data, 4));
+    TEST_ASSERT_EQUAL_INT(0, vfs_buffer_detach(fd));
+    TEST_ASSERT_EQUAL_INT(4, vfs_read(fd, data, 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, &_pattern[4], 4));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_buffer_detach(fd));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_buffered_append(void)
+{
+    _prefill(20);
+    int fd = _open_buffered(O_RDWR | O_APPEND);
+    TEST_ASSERT(fd >= 0);
+
+    uint8_t data[6];
+    TEST_ASSERT_EQUAL_INT(6, vfs_read(fd, data, 6));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _pattern, 6));
+
+    /* appended writes end up at the end of the file, not at the position */
+    for (unsigned i = 0; i < 30; i += 6) {
+        TEST_ASSERT_EQUAL_INT(6, vfs_write(fd, &_pattern[20 + i], 6));
+    }
+    TEST_ASSERT(_ram_file_len < 50);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(50, _ram_file_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ram_file, _pattern, 50));
+}
+
+Test *tests_vfs_buffered_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_buffered_attach),
+        new_TestFixture(test_vfs_buffered_write_read_back),
+        new_TestFixture(test_vfs_buffered_large_transfers),
+        new_TestFixture(test_vfs_buffered_interleaved),
+        new_TestFixture(test_vfs_buffered_detach),
+        new_TestFixture(test_vfs_buffered_append),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_buffered_tests, setup, teardown, fixtures);
+
+    return (Test *)&vfs_buffered_tests;
+}
+
+/** @} */
@@ -56,6 +56,27 @@ static void test_ztimer_convert_muldiv64_now(void)
     test_ztimer_convert_muldiv64_now_helper(15625, 512);
 }
 
+/**
+ * @brief   ztimer_now64() scales the 64 bit time of the lower clock
+ */
+static void test_ztimer_convert_muldiv64_now64(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_convert_muldiv64_t zc;
+    ztimer_clock_t *z = &zc.super.super;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_convert_muldiv64_init(&zc, &zmock.super, 15625, 512);
+    TEST_ASSERT(ztimer_now64(z) == 0);
+
+    for (unsigned i = 0; i < 5; i++) {
+        ztimer_mock_advance(&zmock, 0x80000000ul);
+    }
+    TEST_ASSERT(ztimer_now64(z) == 0x280000000ull * 15625 / 512);
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT(ztimer_now64(z) == (0x280000000ull + 1000) * 15625 / 512);
+}
+
 static void _set_cb(void *arg)
 {
     int *val = arg;
@@ -206,6 +227,7 @@ Test *tests_ztimer_convert_muldiv64_tests(void)
         new_TestFixture(test_ztimer_convert_muldiv64_set_speedup),
         new_TestFixture(test_ztimer_convert_muldiv64_set_slowdown),
         new_TestFixture(test_ztimer_convert_muldiv64_now),
+        new_TestFixture(test_ztimer_convert_muldiv64_now64),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
@@ -15,6 +15,7 @@
  * @author      Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 
+#include "kernel_defines.h"
 #include "ztimer.h"
 #include "ztimer/mock.h"
 
@@ -284,6 +285,150 @@ static void test_ztimer_mock_is_set(void)
     TEST_ASSERT(!ztimer_is_set(z, &alarm2));
 }
 
+/**
+ * @brief   Periodic timer setting itself again from its callback
+ */
+typedef struct {
+    ztimer_clock_t *clock;
+    ztimer_t timer;
+    uint32_t period;
+    uint32_t count;
+} periodic_t;
+
+static void cb_periodic(void *arg)
+{
+    periodic_t *periodic = arg;
+
+    periodic->count++;
+    ztimer_set(periodic->clock, &periodic->timer, periodic->period);
+}
+
+/**
+ * @brief   Testing the clock is set once after firing all timers due
+ */
+static void test_ztimer_mock_handler_batch(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    periodic_t periodic[3];
+
+    ztimer_mock_init(&zmock, 32);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(periodic); i++) {
+        periodic[i] = (periodic_t){
+            .clock = z,
+            .timer = { .callback = cb_periodic, .arg = &periodic[i], },
+            .period = 100 + i,
+        };
+        ztimer_set(z, &periodic[i].timer, 100);
+    }
+
+    unsigned sets = zmock.calls.set;
+    ztimer_mock_advance(&zmock, 100);
+    for (unsigned i = 0; i < ARRAY_SIZE(periodic); i++) {
+        TEST_ASSERT_EQUAL_INT(1, periodic[i].count);
+    }
+    TEST_ASSERT_EQUAL_INT(sets + 1, zmock.calls.set);
+    TEST_ASSERT_EQUAL_INT(100, zmock.target);
+
+    ztimer_mock_advance(&zmock, 102);
+    for (unsigned i = 0; i < ARRAY_SIZE(periodic); i++) {
+        TEST_ASSERT_EQUAL_INT(2, periodic[i].count);
+        ztimer_remove(z, &periodic[i].timer);
+    }
+}
+
+/**
+ * @brief   Testing ztimer_set_with_slack()
+ */
+static void test_ztimer_mock_set_with_slack(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm2 = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm3 = { .callback = cb_incr, .arg = &count, };
+
+    /* joins alarm inside of its window */
+    ztimer_set(z, &alarm, 1000);
+    ztimer_set_with_slack(z, &alarm2, 900, 200);
+    /* no timer in its window, fires at its end */
+    ztimer_set_with_slack(z, &alarm3, 1100, 100);
+
+    ztimer_mock_advance(&zmock, 999);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 199);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, count);
+
+    /* a later timer joins a timer at the end of its window */
+    ztimer_set_with_slack(z, &alarm, 1000, 100);
+    ztimer_set_with_slack(z, &alarm2, 1050, 100);
+    ztimer_mock_advance(&zmock, 1099);
+    TEST_ASSERT_EQUAL_INT(3, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(5, count);
+
+    /* a window saturates instead of overflowing */
+    ztimer_set_with_slack(z, &alarm, UINT32_MAX - 10, 100);
+    ztimer_mock_advance(&zmock, UINT32_MAX - 1);
+    TEST_ASSERT_EQUAL_INT(5, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(6, count);
+}
+
+/**
+ * @brief   Testing ztimer_now64() across wraps of ztimer_now()
+ */
+static void test_ztimer_mock_now64(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_advance(&zmock, 123);
+    TEST_ASSERT(ztimer_now64(z) == 123);
+
+    /* the idle clock wakes up every half wrap to observe it */
+    ztimer_mock_advance(&zmock, 0xfffffff0ul);
+    TEST_ASSERT(ztimer_now64(z) == 0x10000006bull);
+    ztimer_mock_advance(&zmock, 0x80000000ul);
+    ztimer_mock_advance(&zmock, 0x80000000ul);
+    ztimer_mock_advance(&zmock, 0x80000000ul);
+    TEST_ASSERT(ztimer_now64(z) == 0x28000006bull);
+
+    /* a timer set far ahead does not hide a wrap */
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_set(z, &alarm, UINT32_MAX);
+    ztimer_mock_advance(&zmock, UINT32_MAX);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(ztimer_now64(z) == 0x38000006aull);
+}
+
+/**
+ * @brief   Testing ztimer_now64() on an extended 16 bit clock
+ */
+static void test_ztimer_mock_now64_16(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 16);
+    TEST_ASSERT(ztimer_now64(z) == 0);
+    for (unsigned i = 0; i < 3; i++) {
+        ztimer_mock_advance(&zmock, 0x80000000ul);
+    }
+    TEST_ASSERT(ztimer_now64(z) == 0x180000000ull);
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -294,6 +439,10 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
+        new_TestFixture(test_ztimer_mock_set_with_slack),
+        new_TestFixture(test_ztimer_mock_handler_batch),
+        new_TestFixture(test_ztimer_mock_now64),
+        new_TestFixture(test_ztimer_mock_now64_16),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer coalescing test application
+ *
+ * Runs periodic timers with slightly different periods, first without and
+ * then with slack, and compares the wakeups of the clock.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define TIMERS              (8U)
+#define PERIOD_MS           (100U)
+#define PERIOD_STEP_MS      (7U)
+#define SLACK_MS            (20U)
+#define RUN_MS              (2000U)
+
+typedef struct {
+    ztimer_t timer;
+    uint32_t period;
+    uint32_t slack;
+    uint32_t count;
+} periodic_t;
+
+static periodic_t _periodic[TIMERS];
+
+static void _cb(void *arg)
+{
+    periodic_t *periodic = arg;
+
+    periodic->count++;
+    ztimer_set_with_slack(ZTIMER_MSEC, &periodic->timer, periodic->period,
+                          periodic->slack);
+}
+
+static uint32_t _run(uint32_t slack)
+{
+    for (unsigned i = 0; i < TIMERS; i++) {
+        _periodic[i] = (periodic_t){
+            .timer = { .callback = _cb, .arg = &_periodic[i] },
+            .period = PERIOD_MS + i * PERIOD_STEP_MS,
+            .slack = slack,
+        };
+    }
+
+    unsigned state = irq_disable();
+    memset(&ZTIMER_MSEC_BASE->stats, 0, sizeof(ZTIMER_MSEC_BASE->stats));
+    for (unsigned i = 0; i < TIMERS; i++) {
+        ztimer_set_with_slack(ZTIMER_MSEC, &_periodic[i].timer,
+                              _periodic[i].period, slack);
+    }
+    irq_restore(state);
+
+    ztimer_sleep(ZTIMER_MSEC, RUN_MS);
+
+    state = irq_disable();
+    ztimer_stats_t stats = ZTIMER_MSEC_BASE->stats;
+    for (unsigned i = 0; i < TIMERS; i++) {
+        ztimer_remove(ZTIMER_MSEC, &_periodic[i].timer);
+    }
+    irq_restore(state);
+
+    uint32_t count = 0;
+    for (unsigned i = 0; i < TIMERS; i++) {
+        count += _periodic[i].count;
+    }
+
+    printf("slack %" PRIu32 " ms: %" PRIu32 " callbacks, %" PRIu32
+           " irqs, %" PRIu32 " wakeups/s\n",
+           slack, count, stats.irqs, (stats.wakeups * 1000) / RUN_MS);
+
+    /* every timer fires at least once per period plus slack */
+    expect(count >= (TIMERS * RUN_MS) /
+           (PERIOD_MS + (TIMERS - 1) * PERIOD_STEP_MS + slack));
+
+    return stats.wakeups;
+}
+
+int main(void)
+{
+    puts("ztimer coalesce test");
+
+    uint32_t exact = _run(0);
+    uint32_t coalesced = _run(SLACK_MS);
+
+    expect(coalesced < exact);
+
+    puts("SUCCESS");
+
+    return 0;
+}
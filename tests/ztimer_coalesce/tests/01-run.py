@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("ztimer coalesce test")
+    child.expect(r"slack 0 ms: \d+ callbacks, \d+ irqs, (\d+) wakeups/s")
+    exact = int(child.match.group(1))
+    child.expect(r"slack \d+ ms: \d+ callbacks, \d+ irqs, (\d+) wakeups/s")
+    assert int(child.match.group(1)) < exact
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
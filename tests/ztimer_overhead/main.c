@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -28,6 +29,21 @@
 
 #define BASE    1000
 #define SAMPLES 1024
+#define CALLS   10000
+
+/* returns the time one call of ztimer_now() or ztimer_now64() takes in ns */
+static uint32_t _now_ns(bool now64)
+{
+    volatile uint64_t sink;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < CALLS; i++) {
+        sink = now64 ? ztimer_now64(ZTIMER_USEC) : ztimer_now(ZTIMER_USEC);
+    }
+    (void)sink;
+
+    return ((ztimer_now(ZTIMER_USEC) - start) * 1000LU) / CALLS;
+}
 
 int main(void)
 {
@@ -55,5 +71,11 @@ int main(void)
     printf("min=%" PRIi32 " max=%" PRIi32 " avg_diff=%" PRIi32 "\n", min, max,
            (total / SAMPLES));
 
+    /* the first call of ztimer_now64() starts tracking wraps */
+    ztimer_now64(ZTIMER_USEC);
+    uint32_t now_ns = _now_ns(false);
+    uint32_t now64_ns = _now_ns(true);
+    printf("now=%" PRIu32 "ns now64=%" PRIu32 "ns\n", now_ns, now64_ns);
+
     return 0;
 }
@@ -12,6 +12,7 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"min=-?\d+ max=-?\d+ avg_diff=\d+\r\n")
+    child.expect(r"now=\d+ns now64=\d+ns\r\n")
 
 
 if __name__ == "__main__":